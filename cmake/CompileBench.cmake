@@ -0,0 +1,68 @@
+#
+# Copyright (C) 2018 Dr. Michael Steffens
+#
+# SPDX-License-Identifier:	BSL-1.0
+#
+
+# Compile SOURCE with COMPILER and FLAGS, once header only and once declaring the specializations of the
+# Polymorphic::Instantiations library extern, and report median wall clock time and object size of REPETITIONS runs
+# each. Runs alternate, so that drift of the machine affects both alike. Invoked by the compileBench target:
+#
+#   cmake -DCOMPILER=<c++> -DFLAGS=<flags> -DINCLUDE_DIR=<dir> -DSOURCE=<file> -DOBJECT_DIR=<dir> -P CompileBench.cmake
+
+cmake_minimum_required(VERSION 3.23)
+
+if(NOT REPETITIONS)
+	set(REPETITIONS 5)
+endif()
+separate_arguments(FLAGS)
+
+function(compile definitions object milliseconds bytes)
+	string(TIMESTAMP start "%s%f")
+	execute_process(
+		COMMAND ${COMPILER} ${FLAGS} ${definitions} -I${INCLUDE_DIR} -c ${SOURCE} -o ${object}
+		RESULT_VARIABLE result)
+	string(TIMESTAMP stop "%s%f")
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "CompileBench: compiling ${SOURCE} failed")
+	endif()
+	math(EXPR elapsed "(${stop} - ${start}) / 1000")
+	file(SIZE ${object} size)
+	set(${milliseconds} ${elapsed} PARENT_SCOPE)
+	set(${bytes} ${size} PARENT_SCOPE)
+endfunction()
+
+function(median values result)
+	list(SORT ${values} COMPARE NATURAL)
+	list(LENGTH ${values} length)
+	math(EXPR middle "${length} / 2")
+	list(GET ${values} ${middle} value)
+	set(${result} ${value} PARENT_SCOPE)
+endfunction()
+
+function(report name reference candidate unit)
+	math(EXPR diff "(${candidate} - ${reference}) * 1000 / ${reference}")
+	if(diff LESS 0)
+		set(sign "-")
+		math(EXPR diff "-${diff}")
+	else()
+		set(sign "+")
+	endif()
+	math(EXPR whole "${diff} / 10")
+	math(EXPR fraction "${diff} % 10")
+	message("${name}: ${reference} ${unit} header only, ${candidate} ${unit} extern templates, ${sign}${whole}.${fraction}%")
+endfunction()
+
+message("Benchmarking ${SOURCE} compilation, extern templates vs header only, median of ${REPETITIONS} runs ...")
+foreach(i RANGE 1 ${REPETITIONS})
+	compile("" ${OBJECT_DIR}/compileBenchHeaderOnly.o milliseconds bytes)
+	list(APPEND referenceTimes ${milliseconds})
+	set(referenceBytes ${bytes})
+	compile(-DPOLYMORPHIC_EXTERN_TEMPLATES ${OBJECT_DIR}/compileBenchExtern.o milliseconds bytes)
+	list(APPEND candidateTimes ${milliseconds})
+	set(candidateBytes ${bytes})
+endforeach()
+median(referenceTimes referenceTime)
+median(candidateTimes candidateTime)
+report("compile time" ${referenceTime} ${candidateTime} ms)
+report("object size" ${referenceBytes} ${candidateBytes} bytes)
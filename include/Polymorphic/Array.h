@@ -0,0 +1,487 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_Array_INCLUDED
+#define Polymorphic_Array_INCLUDED
+
+#include "Polymorphic/Relocation.h"
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Polymorphic {
+
+template<typename T, std::size_t N>
+class Array;
+
+template<typename T, std::size_t N>
+bool operator==(const Array<T, N>& lhs, const Array<T, N>& rhs);
+
+template<typename T, std::size_t N>
+bool operator!=(const Array<T, N>& lhs, const Array<T, N>& rhs);
+
+template<typename T, std::size_t N>
+bool operator<(const Array<T, N>& lhs, const Array<T, N>& rhs);
+
+template<typename T, std::size_t N>
+bool operator<=(const Array<T, N>& lhs, const Array<T, N>& rhs);
+
+template<typename T, std::size_t N>
+bool operator>(const Array<T, N>& lhs, const Array<T, N>& rhs);
+
+template<typename T, std::size_t N>
+bool operator>=(const Array<T, N>& lhs, const Array<T, N>& rhs);
+
+template<std::size_t I, typename T, std::size_t N>
+T& get(Array<T, N>& array) noexcept;
+
+template<std::size_t I, typename T, std::size_t N>
+constexpr const T& get(const Array<T, N>& array) noexcept;
+
+template<std::size_t I, typename T, std::size_t N>
+T&& get(Array<T, N>&& array) noexcept;
+
+namespace detail {
+
+template<bool... Conditions>
+struct all_of : std::true_type
+{
+};
+
+template<bool Condition, bool... Conditions>
+struct all_of<Condition, Conditions...> : std::integral_constant<bool, Condition && all_of<Conditions...>::value>
+{
+};
+
+/// True if Args may initialize the N elements of an Array<T, N> like an aggregate initializer list would, but are not a
+/// single Array or std::array argument, which is taken by the copy and move constructors instead.
+template<typename T, std::size_t N, typename... Args>
+struct is_array_initializer
+	: std::integral_constant<
+		  bool,
+		  sizeof...(Args) != 0 && sizeof...(Args) <= N && all_of<std::is_convertible<Args, T>::value...>::value>
+{
+};
+
+template<typename T, std::size_t N, typename Arg>
+struct is_array_initializer<T, N, Arg>
+	: std::integral_constant<
+		  bool,
+		  N != 0 && std::is_convertible<Arg, T>::value &&
+			  !std::is_base_of<Array<T, N>, typename std::decay<Arg>::type>::value &&
+			  !std::is_same<std::array<T, N>, typename std::decay<Arg>::type>::value>
+{
+};
+
+} // namespace detail
+
+/// Polymorphic decorator composing std::array<T, N> with the sole purpose of adding a virtual destructor..
+///
+/// Classes derived from Polymorphic::Array<T, N> can be safely used as targets of smart pointers.
+/// Note: forwarding member functions are *not* declared virtual! They are not meant to be overriden
+/// in subclasses. Add new behavior using new virtual members instead.
+///
+/// Elements are stored in place, like those of std::array, so fixed size buffers do not need the heap allocation of a
+/// Vector. The virtual destructor keeps the decorator from being an aggregate, though. Instead of aggregate
+/// initialization it offers a constructor taking up to N element initializers, value initializing the remaining
+/// elements, and default initializing all elements when called without arguments.
+template<typename T, std::size_t N>
+class Array
+{
+public:
+	typedef std::array<T, N> DelegateType;
+	typedef T value_type;
+	typedef value_type& reference;
+	typedef const value_type& const_reference;
+	typedef typename DelegateType::pointer pointer;
+	typedef typename DelegateType::const_pointer const_pointer;
+	typedef typename DelegateType::iterator iterator;
+	typedef typename DelegateType::const_iterator const_iterator;
+	typedef typename DelegateType::reverse_iterator reverse_iterator;
+	typedef typename DelegateType::const_reverse_iterator const_reverse_iterator;
+	typedef typename DelegateType::difference_type difference_type;
+	typedef typename DelegateType::size_type size_type;
+
+	/// Default initialize elements, like std::array<T, N> without initializer does.
+	Array()
+	{
+	}
+
+	/// Initialize the first element from arg, and value initialize the remaining ones. Explicit, as std::array<T, N>
+	/// does not convert from a single element either.
+	template<typename Arg, typename = typename std::enable_if<detail::is_array_initializer<T, N, Arg>::value>::type>
+	explicit Array(Arg&& arg) : delegate{{static_cast<value_type>(std::forward<Arg>(arg))}}
+	{
+	}
+
+	/// Initialize the leading elements from args, and value initialize the remaining ones, like aggregate
+	/// initialization of std::array<T, N> does.
+	template<
+		typename First,
+		typename Second,
+		typename... Args,
+		typename = typename std::enable_if<detail::is_array_initializer<T, N, First, Second, Args...>::value>::type>
+	Array(First&& first, Second&& second, Args&&... args) :
+		delegate{{static_cast<value_type>(std::forward<First>(first)),
+				  static_cast<value_type>(std::forward<Second>(second)),
+				  static_cast<value_type>(std::forward<Args>(args))...}}
+	{
+	}
+
+	/// Copy constructor.
+	Array(const Array& other) : delegate(other.delegate)
+	{
+	}
+
+	/// Move constructor.
+	Array(Array&& other) noexcept(std::is_nothrow_move_constructible<DelegateType>::value) :
+		delegate(std::move(other.delegate))
+	{
+	}
+
+	/// Copy construct from std::array<T, N>.
+	Array(const DelegateType& other) : delegate(other)
+	{
+	}
+
+	/// Move construct from std::array<T, N>.
+	Array(DelegateType&& other) noexcept(std::is_nothrow_move_constructible<DelegateType>::value) :
+		delegate(std::move(other))
+	{
+	}
+
+	/// Virtual destructor permitting derived classes to be deleted safely via an Array pointer.
+	virtual ~Array()
+	{
+	}
+
+	/// Copy assignment operator
+	Array& operator=(const Array& other)
+	{
+		delegate = other.delegate;
+		return *this;
+	}
+
+	/// Move assignment operator
+	Array& operator=(Array&& other) noexcept(std::is_nothrow_move_assignable<DelegateType>::value)
+	{
+		delegate = std::move(other.delegate);
+		return *this;
+	}
+
+	/// Copy assignment from std::array<T, N>.
+	Array& operator=(const DelegateType& other)
+	{
+		delegate = other;
+		return *this;
+	}
+
+	/// Move assignment from std::array<T, N>.
+	Array& operator=(DelegateType&& other)
+	{
+		delegate = std::move(other);
+		return *this;
+	}
+
+	/// Implicit type conversion into std::array<T, N> reference.
+	operator DelegateType&()
+	{
+		return delegate;
+	}
+
+	/// Implicit type conversion into const std::array<T, N> reference.
+	operator const DelegateType&() const
+	{
+		return delegate;
+	}
+
+	/// Explicit type conversion into std::array<T, N> rvalue reference.
+	explicit operator DelegateType &&()
+	{
+		return std::move(delegate);
+	}
+
+	/// Forwarded to std::array<T, N>::fill(const value_type& value).
+	void fill(const value_type& value)
+	{
+		delegate.fill(value);
+	}
+
+	/// Forwarded to std::array<T, N>::swap(std::array<T, N>& other).
+	void swap(Array& other) noexcept(noexcept(std::declval<DelegateType&>().swap(std::declval<DelegateType&>())))
+	{
+		delegate.swap(other.delegate);
+	}
+
+	/// Forwarded to std::array<T, N>::begin() noexcept.
+	iterator begin() noexcept
+	{
+		return delegate.begin();
+	}
+
+	/// Forwarded to std::array<T, N>::begin() const noexcept.
+	const_iterator begin() const noexcept
+	{
+		return delegate.begin();
+	}
+
+	/// Forwarded to std::array<T, N>::end() noexcept.
+	iterator end() noexcept
+	{
+		return delegate.end();
+	}
+
+	/// Forwarded to std::array<T, N>::end() const noexcept.
+	const_iterator end() const noexcept
+	{
+		return delegate.end();
+	}
+
+	/// Forwarded to std::array<T, N>::rbegin() noexcept.
+	reverse_iterator rbegin() noexcept
+	{
+		return delegate.rbegin();
+	}
+
+	/// Forwarded to std::array<T, N>::rbegin() const noexcept.
+	const_reverse_iterator rbegin() const noexcept
+	{
+		return delegate.rbegin();
+	}
+
+	/// Forwarded to std::array<T, N>::rend() noexcept.
+	reverse_iterator rend() noexcept
+	{
+		return delegate.rend();
+	}
+
+	/// Forwarded to std::array<T, N>::rend() const noexcept.
+	const_reverse_iterator rend() const noexcept
+	{
+		return delegate.rend();
+	}
+
+	/// Forwarded to std::array<T, N>::cbegin() const noexcept.
+	const_iterator cbegin() const noexcept
+	{
+		return delegate.cbegin();
+	}
+
+	/// Forwarded to std::array<T, N>::cend() const noexcept.
+	const_iterator cend() const noexcept
+	{
+		return delegate.cend();
+	}
+
+	/// Forwarded to std::array<T, N>::crbegin() const noexcept.
+	const_reverse_iterator crbegin() const noexcept
+	{
+		return delegate.crbegin();
+	}
+
+	/// Forwarded to std::array<T, N>::crend() const noexcept.
+	const_reverse_iterator crend() const noexcept
+	{
+		return delegate.crend();
+	}
+
+	/// Forwarded to std::array<T, N>::size() const noexcept.
+	constexpr size_type size() const noexcept
+	{
+		return N;
+	}
+
+	/// Forwarded to std::array<T, N>::max_size() const noexcept.
+	constexpr size_type max_size() const noexcept
+	{
+		return N;
+	}
+
+	/// Forwarded to std::array<T, N>::empty() const noexcept.
+	constexpr bool empty() const noexcept
+	{
+		return N == 0;
+	}
+
+	/// Forwarded to std::array<T, N>::operator[](size_type n).
+	reference operator[](size_type n)
+	{
+		return delegate[n];
+	}
+
+	/// Forwarded to std::array<T, N>::operator[](size_type n) const.
+	constexpr const_reference operator[](size_type n) const
+	{
+		return delegate[n];
+	}
+
+	/// Forwarded to std::array<T, N>::at(size_type n).
+	reference at(size_type n)
+	{
+		return delegate.at(n);
+	}
+
+	/// Forwarded to std::array<T, N>::at(size_type n) const.
+	constexpr const_reference at(size_type n) const
+	{
+		return delegate.at(n);
+	}
+
+	/// Forwarded to std::array<T, N>::front().
+	reference front()
+	{
+		return delegate.front();
+	}
+
+	/// Forwarded to std::array<T, N>::front() const.
+	constexpr const_reference front() const
+	{
+		return delegate.front();
+	}
+
+	/// Forwarded to std::array<T, N>::back().
+	reference back()
+	{
+		return delegate.back();
+	}
+
+	/// Forwarded to std::array<T, N>::back() const.
+	constexpr const_reference back() const
+	{
+		return delegate.back();
+	}
+
+	/// Forwarded to std::array<T, N>::data() noexcept.
+	pointer data() noexcept
+	{
+		return delegate.data();
+	}
+
+	/// Forwarded to std::array<T, N>::data() const noexcept.
+	const_pointer data() const noexcept
+	{
+		return delegate.data();
+	}
+
+private:
+	DelegateType delegate;
+
+	// clang-format off
+	friend bool operator== <T, N>(const Array& lhs, const Array& rhs);
+	friend bool operator!= <T, N>(const Array& lhs, const Array& rhs);
+	friend bool operator< <T, N>(const Array& lhs, const Array& rhs);
+	friend bool operator<= <T, N>(const Array& lhs, const Array& rhs);
+	friend bool operator> <T, N>(const Array& lhs, const Array& rhs);
+	friend bool operator>= <T, N>(const Array& lhs, const Array& rhs);
+	// clang-format on
+	template<std::size_t I, typename U, std::size_t M>
+	friend U& get(Array<U, M>& array) noexcept;
+	template<std::size_t I, typename U, std::size_t M>
+	friend constexpr const U& get(const Array<U, M>& array) noexcept;
+	template<std::size_t I, typename U, std::size_t M>
+	friend U&& get(Array<U, M>&& array) noexcept;
+};
+
+/// Forwarded to operator==(const std::array<T, N>& lhs, const std::array<T, N>& rhs).
+template<typename T, std::size_t N>
+bool operator==(const Array<T, N>& lhs, const Array<T, N>& rhs)
+{
+	return lhs.delegate == rhs.delegate;
+}
+
+/// Forwarded to operator!=(const std::array<T, N>& lhs, const std::array<T, N>& rhs).
+template<typename T, std::size_t N>
+bool operator!=(const Array<T, N>& lhs, const Array<T, N>& rhs)
+{
+	return lhs.delegate != rhs.delegate;
+}
+
+/// Forwarded to operator<(const std::array<T, N>& lhs, const std::array<T, N>& rhs).
+template<typename T, std::size_t N>
+bool operator<(const Array<T, N>& lhs, const Array<T, N>& rhs)
+{
+	return lhs.delegate < rhs.delegate;
+}
+
+/// Forwarded to operator<=(const std::array<T, N>& lhs, const std::array<T, N>& rhs).
+template<typename T, std::size_t N>
+bool operator<=(const Array<T, N>& lhs, const Array<T, N>& rhs)
+{
+	return lhs.delegate <= rhs.delegate;
+}
+
+/// Forwarded to operator>(const std::array<T, N>& lhs, const std::array<T, N>& rhs).
+template<typename T, std::size_t N>
+bool operator>(const Array<T, N>& lhs, const Array<T, N>& rhs)
+{
+	return lhs.delegate > rhs.delegate;
+}
+
+/// Forwarded to operator>=(const std::array<T, N>& lhs, const std::array<T, N>& rhs).
+template<typename T, std::size_t N>
+bool operator>=(const Array<T, N>& lhs, const Array<T, N>& rhs)
+{
+	return lhs.delegate >= rhs.delegate;
+}
+
+/// Forwarded to swap(std::array<T, N>& lhs, std::array<T, N>& rhs).
+template<typename T, std::size_t N>
+void swap(Array<T, N>& lhs, Array<T, N>& rhs) noexcept(noexcept(lhs.swap(rhs)))
+{
+	lhs.swap(rhs);
+}
+
+/// Forwarded to get<I>(std::array<T, N>& array) noexcept.
+template<std::size_t I, typename T, std::size_t N>
+T& get(Array<T, N>& array) noexcept
+{
+	return std::get<I>(array.delegate);
+}
+
+/// Forwarded to get<I>(const std::array<T, N>& array) noexcept.
+template<std::size_t I, typename T, std::size_t N>
+constexpr const T& get(const Array<T, N>& array) noexcept
+{
+	return std::get<I>(array.delegate);
+}
+
+/// Forwarded to get<I>(std::array<T, N>&& array) noexcept.
+template<std::size_t I, typename T, std::size_t N>
+T&& get(Array<T, N>&& array) noexcept
+{
+	return std::get<I>(std::move(array.delegate));
+}
+
+/// Arrays are trivially relocatable if their elements are.
+template<typename T, std::size_t N>
+struct is_trivially_relocatable<Array<T, N>> : is_trivially_relocatable<T>
+{
+};
+
+} // namespace Polymorphic
+
+namespace std {
+
+/// Number of elements of Polymorphic::Array<T, N>, as a compile time constant.
+template<typename T, std::size_t N>
+struct tuple_size<Polymorphic::Array<T, N>> : integral_constant<size_t, N>
+{
+};
+
+/// Element type of Polymorphic::Array<T, N>.
+template<std::size_t I, typename T, std::size_t N>
+struct tuple_element<I, Polymorphic::Array<T, N>>
+{
+	static_assert(I < N, "Polymorphic::Array index out of bounds");
+	typedef T type;
+};
+
+} // namespace std
+
+#endif // Polymorphic_Array_INCLUDED
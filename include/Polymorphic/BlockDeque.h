@@ -0,0 +1,1001 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_BlockDeque_INCLUDED
+#define Polymorphic_BlockDeque_INCLUDED
+
+#include "Polymorphic/Relocation.h"
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace Polymorphic {
+
+template<typename T, std::size_t BlockBytes, typename Allocator>
+class BlockDeque;
+
+template<typename T, std::size_t BlockBytes, typename Allocator>
+bool operator==(const BlockDeque<T, BlockBytes, Allocator>& lhs, const BlockDeque<T, BlockBytes, Allocator>& rhs);
+
+template<typename T, std::size_t BlockBytes, typename Allocator>
+bool operator!=(const BlockDeque<T, BlockBytes, Allocator>& lhs, const BlockDeque<T, BlockBytes, Allocator>& rhs);
+
+template<typename T, std::size_t BlockBytes, typename Allocator>
+bool operator<(const BlockDeque<T, BlockBytes, Allocator>& lhs, const BlockDeque<T, BlockBytes, Allocator>& rhs);
+
+template<typename T, std::size_t BlockBytes, typename Allocator>
+bool operator<=(const BlockDeque<T, BlockBytes, Allocator>& lhs, const BlockDeque<T, BlockBytes, Allocator>& rhs);
+
+template<typename T, std::size_t BlockBytes, typename Allocator>
+bool operator>(const BlockDeque<T, BlockBytes, Allocator>& lhs, const BlockDeque<T, BlockBytes, Allocator>& rhs);
+
+template<typename T, std::size_t BlockBytes, typename Allocator>
+bool operator>=(const BlockDeque<T, BlockBytes, Allocator>& lhs, const BlockDeque<T, BlockBytes, Allocator>& rhs);
+
+template<typename T, std::size_t BlockBytes, typename Allocator>
+void swap(BlockDeque<T, BlockBytes, Allocator>& lhs, BlockDeque<T, BlockBytes, Allocator>& rhs);
+
+namespace detail {
+
+/// Largest power of two not greater than n, or 1 if n is 0.
+constexpr std::size_t floorPowerOfTwo(std::size_t n, std::size_t result = 1)
+{
+	return result <= n / 2 ? floorPowerOfTwo(n, result * 2) : result;
+}
+
+} // namespace detail
+
+/// Double-ended queue providing the std::deque<T> interface, storing elements in blocks of a compile time size.
+///
+/// Each block holds block_size() elements, the largest power of two fitting into BlockBytes, but at least one. Tune
+/// BlockBytes to the element size: std::deque implementations use small fixed blocks, holding a single element each
+/// for large T, and allocating frequently for small T. A map of block pointers provides random access in constant time.
+///
+/// Blocks emptied by pop and erase are freed. With recycling enabled they are kept for reuse instead, so a queue
+/// oscillating around a block boundary, or a sliding window, runs allocation free at steady state. shrink_to_fit()
+/// frees kept blocks.
+///
+/// Like the decorators, BlockDeque has a virtual destructor. Add new behavior in subclasses using new virtual members.
+template<typename T, std::size_t BlockBytes = 4096, typename Allocator = std::allocator<T>>
+class BlockDeque
+{
+	typedef std::allocator_traits<Allocator> AllocatorTraits;
+
+	template<bool isConst>
+	class Iterator;
+
+public:
+	typedef T value_type;
+	typedef Allocator allocator_type;
+	typedef value_type& reference;
+	typedef const value_type& const_reference;
+	typedef typename AllocatorTraits::pointer pointer;
+	typedef typename AllocatorTraits::const_pointer const_pointer;
+	typedef Iterator<false> iterator;
+	typedef Iterator<true> const_iterator;
+	typedef std::reverse_iterator<iterator> reverse_iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+	typedef typename AllocatorTraits::difference_type difference_type;
+	typedef typename AllocatorTraits::size_type size_type;
+
+	/// Construct empty deque without allocating.
+	explicit BlockDeque(const allocator_type& allocator = allocator_type()) :
+		allocator(allocator),
+		map(MapAllocator(allocator)),
+		spareBlocks(MapAllocator(allocator)),
+		firstBlock(0),
+		blockCount(0),
+		head(0),
+		count(0),
+		recyclingEnabled(false)
+	{
+	}
+
+	/// Construct deque holding n value initialized elements.
+	explicit BlockDeque(size_type n) : BlockDeque()
+	{
+		resize(n);
+	}
+
+	/// Construct deque holding n copies of value.
+	BlockDeque(size_type n, const value_type& value, const allocator_type& allocator = allocator_type()) : BlockDeque(allocator)
+	{
+		assign(n, value);
+	}
+
+	/// Construct deque holding copies of elements in range [first, last).
+	template<typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+	BlockDeque(InputIterator first, InputIterator last, const allocator_type& allocator = allocator_type()) : BlockDeque(allocator)
+	{
+		assign(first, last);
+	}
+
+	/// Copy constructor.
+	BlockDeque(const BlockDeque& other) :
+		BlockDeque(other, AllocatorTraits::select_on_container_copy_construction(other.allocator))
+	{
+	}
+
+	/// Copy constructor.
+	BlockDeque(const BlockDeque& other, const allocator_type& allocator) : BlockDeque(allocator)
+	{
+		recyclingEnabled = other.recyclingEnabled;
+		assign(other.begin(), other.end());
+	}
+
+	/// Move constructor.
+	BlockDeque(BlockDeque&& other) noexcept : BlockDeque(std::move(other.allocator))
+	{
+		steal(other);
+	}
+
+	/// Move constructor.
+	BlockDeque(BlockDeque&& other, const allocator_type& allocator) : BlockDeque(allocator)
+	{
+		if (this->allocator == other.allocator) {
+			steal(other);
+		} else {
+			recyclingEnabled = other.recyclingEnabled;
+			assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+			other.clear();
+		}
+	}
+
+	/// Construct deque holding copies of initializer list elements.
+	BlockDeque(std::initializer_list<value_type> initializerList, const allocator_type& allocator = allocator_type()) :
+		BlockDeque(allocator)
+	{
+		assign(initializerList);
+	}
+
+	/// Virtual destructor permitting derived classes to be deleted safely via a BlockDeque pointer.
+	virtual ~BlockDeque()
+	{
+		release();
+	}
+
+	/// Copy assignment operator
+	BlockDeque& operator=(const BlockDeque& other)
+	{
+		if (this != &other) {
+			recyclingEnabled = other.recyclingEnabled;
+			assign(other.begin(), other.end());
+		}
+		return *this;
+	}
+
+	/// Move assignment operator
+	BlockDeque& operator=(BlockDeque&& other)
+	{
+		if (this != &other) {
+			if (AllocatorTraits::propagate_on_container_move_assignment::value || allocator == other.allocator) {
+				release();
+				if (AllocatorTraits::propagate_on_container_move_assignment::value) {
+					allocator = std::move(other.allocator);
+				}
+				steal(other);
+			} else {
+				recyclingEnabled = other.recyclingEnabled;
+				assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+				other.clear();
+			}
+		}
+		return *this;
+	}
+
+	/// Initializer list assignment operator
+	BlockDeque& operator=(std::initializer_list<value_type> initializerList)
+	{
+		assign(initializerList);
+		return *this;
+	}
+
+	/// Iterator to the first element.
+	iterator begin() noexcept
+	{
+		return iteratorAt<iterator>(0);
+	}
+
+	/// Iterator to the first element.
+	const_iterator begin() const noexcept
+	{
+		return iteratorAt<const_iterator>(0);
+	}
+
+	/// Iterator past the last element.
+	iterator end() noexcept
+	{
+		return iteratorAt<iterator>(count);
+	}
+
+	/// Iterator past the last element.
+	const_iterator end() const noexcept
+	{
+		return iteratorAt<const_iterator>(count);
+	}
+
+	/// Reverse iterator to the last element.
+	reverse_iterator rbegin() noexcept
+	{
+		return reverse_iterator(end());
+	}
+
+	/// Reverse iterator to the last element.
+	const_reverse_iterator rbegin() const noexcept
+	{
+		return const_reverse_iterator(end());
+	}
+
+	/// Reverse iterator before the first element.
+	reverse_iterator rend() noexcept
+	{
+		return reverse_iterator(begin());
+	}
+
+	/// Reverse iterator before the first element.
+	const_reverse_iterator rend() const noexcept
+	{
+		return const_reverse_iterator(begin());
+	}
+
+	/// Const iterator to the first element.
+	const_iterator cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	/// Const iterator past the last element.
+	const_iterator cend() const noexcept
+	{
+		return end();
+	}
+
+	/// Const reverse iterator to the last element.
+	const_reverse_iterator crbegin() const noexcept
+	{
+		return rbegin();
+	}
+
+	/// Const reverse iterator before the first element.
+	const_reverse_iterator crend() const noexcept
+	{
+		return rend();
+	}
+
+	/// True if there are no elements.
+	bool empty() const noexcept
+	{
+		return count == 0;
+	}
+
+	/// Number of elements.
+	size_type size() const noexcept
+	{
+		return count;
+	}
+
+	/// Maximum number of elements the allocator can provide.
+	size_type max_size() const noexcept
+	{
+		return AllocatorTraits::max_size(allocator);
+	}
+
+	/// Number of elements per block, the largest power of two fitting into BlockBytes, but at least one.
+	static constexpr size_type block_size() noexcept
+	{
+		return detail::floorPowerOfTwo(BlockBytes / sizeof(T));
+	}
+
+	/// Enable or disable recycling. When enabled, emptied blocks are kept for reuse instead of being freed.
+	void set_recycling(bool enabled) noexcept
+	{
+		recyclingEnabled = enabled;
+	}
+
+	/// True if recycling is enabled.
+	bool recycles() const noexcept
+	{
+		return recyclingEnabled;
+	}
+
+	/// Number of empty blocks kept for reuse.
+	size_type spare_blocks() const noexcept
+	{
+		return spareBlocks.size();
+	}
+
+	/// Free blocks kept for reuse, and shrink the block map to the blocks in use.
+	void shrink_to_fit()
+	{
+		freeSpareBlocks();
+		MapType(spareBlocks.get_allocator()).swap(spareBlocks);
+		MapType shrunk(map.begin() + firstBlock, map.begin() + (firstBlock + blockCount), map.get_allocator());
+		shrunk.push_back(pointer());
+		map.swap(shrunk);
+		firstBlock = 0;
+	}
+
+	/// Resize to n elements, appending value initialized elements or erasing from the back as required.
+	void resize(size_type n)
+	{
+		if (n < count) {
+			truncate(n);
+		} else {
+			while (count < n) {
+				appendBack();
+			}
+		}
+	}
+
+	/// Resize to n elements, appending copies of value or erasing from the back as required.
+	void resize(size_type n, const value_type& value)
+	{
+		if (n < count) {
+			truncate(n);
+		} else {
+			value_type copy(value);
+			while (count < n) {
+				appendBack(copy);
+			}
+		}
+	}
+
+	/// Resize to n elements, constructing appended ones without arguments. With a DefaultInitAllocator these are left
+	/// uninitialized if trivially default constructible, to be overwritten by the caller. Other allocators value
+	/// initialize them, like resize(size_type n) does.
+	void resize_default_init(size_type n)
+	{
+		resize(n);
+	}
+
+	/// Resize to n elements like resize_default_init(n), let operation(iterator first, size_type n) overwrite them in
+	/// place, and keep the first operation result elements, clamped to n.
+	template<typename Operation>
+	void resize_and_overwrite(size_type n, Operation operation)
+	{
+		resize(n);
+		resize(std::min(n, static_cast<size_type>(operation(begin(), n))));
+	}
+
+	/// Unchecked access to n-th element.
+	reference operator[](size_type n)
+	{
+		return *element(n);
+	}
+
+	/// Unchecked access to n-th element.
+	const_reference operator[](size_type n) const
+	{
+		return *element(n);
+	}
+
+	/// Checked access to n-th element, throwing std::out_of_range if n >= size().
+	reference at(size_type n)
+	{
+		checkRange(n);
+		return *element(n);
+	}
+
+	/// Checked access to n-th element, throwing std::out_of_range if n >= size().
+	const_reference at(size_type n) const
+	{
+		checkRange(n);
+		return *element(n);
+	}
+
+	/// First element.
+	reference front()
+	{
+		return *element(0);
+	}
+
+	/// First element.
+	const_reference front() const
+	{
+		return *element(0);
+	}
+
+	/// Last element.
+	reference back()
+	{
+		return *element(count - 1);
+	}
+
+	/// Last element.
+	const_reference back() const
+	{
+		return *element(count - 1);
+	}
+
+	/// Replace contents by copies of elements in range [first, last).
+	template<typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+	void assign(InputIterator first, InputIterator last)
+	{
+		clear();
+		for (; first != last; ++first) {
+			appendBack(*first);
+		}
+	}
+
+	/// Replace contents by n copies of value.
+	void assign(size_type n, const value_type& value)
+	{
+		value_type copy(value);
+		clear();
+		while (count < n) {
+			appendBack(copy);
+		}
+	}
+
+	/// Replace contents by copies of initializer list elements.
+	void assign(std::initializer_list<value_type> initializerList)
+	{
+		assign(initializerList.begin(), initializerList.end());
+	}
+
+	/// Construct element in front of the first one.
+	template<class... Args>
+	void emplace_front(Args&&... args)
+	{
+		appendFront(std::forward<Args>(args)...);
+	}
+
+	/// Copy element in front of the first one.
+	void push_front(const value_type& value)
+	{
+		appendFront(value);
+	}
+
+	/// Move element in front of the first one.
+	void push_front(value_type&& value)
+	{
+		appendFront(std::move(value));
+	}
+
+	/// Erase the first element, releasing its block if emptied.
+	void pop_front()
+	{
+		AllocatorTraits::destroy(allocator, element(0));
+		++head;
+		--count;
+		if (head >= block_size()) {
+			releaseBlock(map[firstBlock++]);
+			--blockCount;
+			head -= block_size();
+		}
+	}
+
+	/// Construct element behind the last one.
+	template<class... Args>
+	void emplace_back(Args&&... args)
+	{
+		appendBack(std::forward<Args>(args)...);
+	}
+
+	/// Copy element behind the last one.
+	void push_back(const value_type& value)
+	{
+		appendBack(value);
+	}
+
+	/// Move element behind the last one.
+	void push_back(value_type&& value)
+	{
+		appendBack(std::move(value));
+	}
+
+	/// Erase the last element, releasing its block if emptied.
+	void pop_back()
+	{
+		AllocatorTraits::destroy(allocator, element(count - 1));
+		--count;
+		if (blockCount * block_size() - (head + count) >= block_size()) {
+			releaseBlock(map[firstBlock + --blockCount]);
+			map[firstBlock + blockCount] = pointer();
+		}
+	}
+
+	/// Construct element before position, shifting elements towards the nearer end.
+	template<typename... Args>
+	iterator emplace(const_iterator position, Args&&... args)
+	{
+		size_type offset = static_cast<size_type>(position - cbegin());
+		value_type value(std::forward<Args>(args)...);
+		if (offset < count / 2) {
+			appendFront(std::move(value));
+			std::rotate(begin(), begin() + 1, begin() + (offset + 1));
+		} else {
+			appendBack(std::move(value));
+			std::rotate(begin() + offset, end() - 1, end());
+		}
+		return begin() + offset;
+	}
+
+	/// Copy element before position.
+	iterator insert(const_iterator position, const value_type& value)
+	{
+		return emplace(position, value);
+	}
+
+	/// Insert n copies of value before position.
+	iterator insert(const_iterator position, size_type n, const value_type& value)
+	{
+		size_type offset = static_cast<size_type>(position - cbegin());
+		size_type oldCount = count;
+		value_type copy(value);
+		for (size_type i = 0; i < n; ++i) {
+			appendBack(copy);
+		}
+		std::rotate(begin() + offset, begin() + oldCount, end());
+		return begin() + offset;
+	}
+
+	/// Insert copies of elements in range [first, last) before position.
+	template<typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+	iterator insert(const_iterator position, InputIterator first, InputIterator last)
+	{
+		size_type offset = static_cast<size_type>(position - cbegin());
+		size_type oldCount = count;
+		for (; first != last; ++first) {
+			appendBack(*first);
+		}
+		std::rotate(begin() + offset, begin() + oldCount, end());
+		return begin() + offset;
+	}
+
+	/// Move element before position.
+	iterator insert(const_iterator position, value_type&& value)
+	{
+		return emplace(position, std::move(value));
+	}
+
+	/// Insert copies of initializer list elements before position.
+	iterator insert(const_iterator position, std::initializer_list<value_type> initializerList)
+	{
+		return insert(position, initializerList.begin(), initializerList.end());
+	}
+
+	/// Erase element at position, shifting elements from the nearer end.
+	iterator erase(const_iterator position)
+	{
+		return erase(position, position + 1);
+	}
+
+	/// Erase elements in range [first, last), shifting elements from the nearer end.
+	iterator erase(const_iterator first, const_iterator last)
+	{
+		size_type offset = static_cast<size_type>(first - cbegin());
+		size_type n = static_cast<size_type>(last - first);
+		if (n == 0) {
+			// Shifting would move elements onto themselves, and self move assignment may empty them.
+			return begin() + offset;
+		}
+		if (offset < count - offset - n) {
+			std::move_backward(begin(), begin() + offset, begin() + (offset + n));
+			for (size_type i = 0; i < n; ++i) {
+				pop_front();
+			}
+		} else {
+			std::move(begin() + (offset + n), end(), begin() + offset);
+			truncate(count - n);
+		}
+		return begin() + offset;
+	}
+
+	/// Exchange contents, blocks, recycling mode and allocator with other.
+	void swap(BlockDeque& other)
+	{
+		using std::swap;
+		swap(allocator, other.allocator);
+		map.swap(other.map);
+		spareBlocks.swap(other.spareBlocks);
+		swap(firstBlock, other.firstBlock);
+		swap(blockCount, other.blockCount);
+		swap(head, other.head);
+		swap(count, other.count);
+		swap(recyclingEnabled, other.recyclingEnabled);
+	}
+
+	/// Erase all elements, releasing their blocks.
+	void clear() noexcept
+	{
+		truncate(0);
+	}
+
+	/// Copy of the allocator.
+	allocator_type get_allocator() const noexcept
+	{
+		return allocator;
+	}
+
+private:
+	/// Random access iterator walking the elements block by block. Positioned on a block boundary behind the last block,
+	/// as end() may be, it refers to the map slot behind the blocks in use, which is kept empty for that purpose.
+	template<bool isConst>
+	class Iterator
+	{
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef T value_type;
+		typedef typename BlockDeque::difference_type difference_type;
+		typedef typename std::conditional<isConst, const T*, T*>::type pointer;
+		typedef typename std::conditional<isConst, const T&, T&>::type reference;
+		typedef const typename BlockDeque::pointer* NodePointer;
+
+		Iterator() noexcept : node(nullptr), block(nullptr), current(nullptr)
+		{
+		}
+
+		Iterator(NodePointer node, pointer block, pointer current) noexcept : node(node), block(block), current(current)
+		{
+		}
+
+		/// Implicit conversion from iterator to const_iterator.
+		template<bool otherIsConst, typename = typename std::enable_if<isConst && !otherIsConst>::type>
+		Iterator(const Iterator<otherIsConst>& other) noexcept :
+			node(other.node), block(other.block), current(other.current)
+		{
+		}
+
+		reference operator*() const
+		{
+			return *current;
+		}
+
+		pointer operator->() const
+		{
+			return current;
+		}
+
+		reference operator[](difference_type n) const
+		{
+			return *(*this + n);
+		}
+
+		Iterator& operator++() noexcept
+		{
+			if (++current == block + block_size()) {
+				block = current = *++node;
+			}
+			return *this;
+		}
+
+		Iterator operator++(int) noexcept
+		{
+			Iterator result(*this);
+			++*this;
+			return result;
+		}
+
+		Iterator& operator--() noexcept
+		{
+			if (current == block) {
+				block = *--node;
+				current = block + block_size();
+			}
+			--current;
+			return *this;
+		}
+
+		Iterator operator--(int) noexcept
+		{
+			Iterator result(*this);
+			--*this;
+			return result;
+		}
+
+		Iterator& operator+=(difference_type n) noexcept
+		{
+			const difference_type blockSize = static_cast<difference_type>(block_size());
+			difference_type offset = (current - block) + n;
+			if (offset >= 0 && offset < blockSize) {
+				current += n;
+			} else {
+				difference_type nodeOffset = offset >= 0 ? offset / blockSize : -((-offset - 1) / blockSize) - 1;
+				node += nodeOffset;
+				block = *node;
+				current = block + (offset - nodeOffset * blockSize);
+			}
+			return *this;
+		}
+
+		Iterator& operator-=(difference_type n) noexcept
+		{
+			return *this += -n;
+		}
+
+		friend Iterator operator+(Iterator it, difference_type n) noexcept
+		{
+			return it += n;
+		}
+
+		friend Iterator operator+(difference_type n, Iterator it) noexcept
+		{
+			return it += n;
+		}
+
+		friend Iterator operator-(Iterator it, difference_type n) noexcept
+		{
+			return it -= n;
+		}
+
+		friend difference_type operator-(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return (lhs.node - rhs.node) * static_cast<difference_type>(block_size()) + (lhs.current - lhs.block) -
+				   (rhs.current - rhs.block);
+		}
+
+		friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return lhs.current == rhs.current && lhs.node == rhs.node;
+		}
+
+		friend bool operator!=(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return !(lhs == rhs);
+		}
+
+		friend bool operator<(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return lhs.node == rhs.node ? lhs.current < rhs.current : lhs.node < rhs.node;
+		}
+
+		friend bool operator<=(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return !(rhs < lhs);
+		}
+
+		friend bool operator>(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return rhs < lhs;
+		}
+
+		friend bool operator>=(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return !(lhs < rhs);
+		}
+
+	private:
+		NodePointer node;
+		pointer block;
+		pointer current;
+
+		friend class Iterator<!isConst>;
+	};
+
+	typedef typename AllocatorTraits::template rebind_alloc<pointer> MapAllocator;
+	typedef std::vector<pointer, MapAllocator> MapType;
+
+	allocator_type allocator;
+	MapType map;
+	MapType spareBlocks;
+	size_type firstBlock;
+	size_type blockCount;
+	size_type head;
+	size_type count;
+	bool recyclingEnabled;
+
+	/// Pointer to n-th element. Blocks in use are map[firstBlock] to map[firstBlock + blockCount - 1], the first element
+	/// being at offset head of the first one.
+	pointer element(size_type n) const noexcept
+	{
+		size_type position = head + n;
+		return map[firstBlock + position / block_size()] + position % block_size();
+	}
+
+	/// Iterator to n-th element, or end() if n is size().
+	template<typename IteratorType>
+	IteratorType iteratorAt(size_type n) const noexcept
+	{
+		size_type position = head + n;
+		const pointer* node = map.data() + (firstBlock + position / block_size());
+		pointer block = position / block_size() < blockCount ? *node : pointer();
+		return IteratorType(node, block, block + position % block_size());
+	}
+
+	void checkRange(size_type n) const
+	{
+		if (n >= count) {
+			throw std::out_of_range("Polymorphic::BlockDeque::at");
+		}
+	}
+
+	/// Spare or newly allocated block.
+	pointer acquireBlock()
+	{
+		if (spareBlocks.empty()) {
+			return AllocatorTraits::allocate(allocator, block_size());
+		}
+		pointer block = spareBlocks.back();
+		spareBlocks.pop_back();
+		return block;
+	}
+
+	/// Keep emptied block for reuse if recycling, free it otherwise.
+	void releaseBlock(pointer block) noexcept
+	{
+		if (recyclingEnabled) {
+			try {
+				spareBlocks.push_back(block);
+				return;
+			} catch (...) {
+			}
+		}
+		AllocatorTraits::deallocate(allocator, block, block_size());
+	}
+
+	void freeSpareBlocks() noexcept
+	{
+		for (pointer block : spareBlocks) {
+			AllocatorTraits::deallocate(allocator, block, block_size());
+		}
+		spareBlocks.clear();
+	}
+
+	/// Make room in the map for another block at the front or back, keeping an empty slot behind the last one, by
+	/// centering the blocks in use if the map is less than half full, or by moving them into a map of twice the size.
+	void reserveMap(bool atFront)
+	{
+		size_type needed = blockCount + 1;
+		size_type newFirstBlock;
+		if (map.size() >= 2 * needed + 2) {
+			newFirstBlock = (map.size() - needed) / 2 + (atFront ? 1 : 0);
+			if (newFirstBlock < firstBlock) {
+				std::copy(map.begin() + firstBlock, map.begin() + (firstBlock + blockCount), map.begin() + newFirstBlock);
+			} else {
+				std::copy_backward(
+					map.begin() + firstBlock,
+					map.begin() + (firstBlock + blockCount),
+					map.begin() + (newFirstBlock + blockCount));
+			}
+			std::fill(map.begin(), map.begin() + newFirstBlock, pointer());
+			std::fill(map.begin() + (newFirstBlock + blockCount), map.end(), pointer());
+		} else {
+			size_type newSize = std::max<size_type>(std::max<size_type>(2 * map.size(), 2 * needed + 2), 8);
+			MapType newMap(newSize, pointer(), map.get_allocator());
+			newFirstBlock = (newMap.size() - needed) / 2 + (atFront ? 1 : 0);
+			std::copy(map.begin() + firstBlock, map.begin() + (firstBlock + blockCount), newMap.begin() + newFirstBlock);
+			map.swap(newMap);
+		}
+		firstBlock = newFirstBlock;
+	}
+
+	/// Construct element behind the last one, adding a block if the last one is full.
+	template<typename... Args>
+	void appendBack(Args&&... args)
+	{
+		if (head + count == blockCount * block_size()) {
+			if (firstBlock + blockCount + 1 >= map.size()) {
+				reserveMap(false);
+			}
+			map[firstBlock + blockCount] = acquireBlock();
+			++blockCount;
+		}
+		AllocatorTraits::construct(allocator, element(count), std::forward<Args>(args)...);
+		++count;
+	}
+
+	/// Construct element in front of the first one, adding a block if the first one is full.
+	template<typename... Args>
+	void appendFront(Args&&... args)
+	{
+		if (head == 0) {
+			if (firstBlock == 0) {
+				reserveMap(true);
+			}
+			map[firstBlock - 1] = acquireBlock();
+			--firstBlock;
+			++blockCount;
+			head = block_size();
+		}
+		AllocatorTraits::construct(allocator, map[firstBlock] + (head - 1), std::forward<Args>(args)...);
+		--head;
+		++count;
+	}
+
+	/// Destroy elements from the back until n remain.
+	void truncate(size_type n) noexcept
+	{
+		while (count > n) {
+			pop_back();
+		}
+	}
+
+	/// Destroy all elements and free all blocks.
+	void release() noexcept
+	{
+		clear();
+		for (; blockCount > 0; --blockCount) {
+			AllocatorTraits::deallocate(allocator, map[firstBlock + blockCount - 1], block_size());
+			map[firstBlock + blockCount - 1] = pointer();
+		}
+		head = 0;
+		freeSpareBlocks();
+	}
+
+	/// Take over blocks and elements of other, leaving other empty without blocks.
+	void steal(BlockDeque& other) noexcept
+	{
+		map.swap(other.map);
+		MapType(other.map.get_allocator()).swap(other.map);
+		spareBlocks.swap(other.spareBlocks);
+		firstBlock = other.firstBlock;
+		blockCount = other.blockCount;
+		head = other.head;
+		count = other.count;
+		recyclingEnabled = other.recyclingEnabled;
+		other.firstBlock = 0;
+		other.blockCount = 0;
+		other.head = 0;
+		other.count = 0;
+	}
+};
+
+/// Element-wise comparison.
+template<typename T, std::size_t BlockBytes, typename Allocator>
+bool operator==(const BlockDeque<T, BlockBytes, Allocator>& lhs, const BlockDeque<T, BlockBytes, Allocator>& rhs)
+{
+	return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+/// Element-wise comparison.
+template<typename T, std::size_t BlockBytes, typename Allocator>
+bool operator!=(const BlockDeque<T, BlockBytes, Allocator>& lhs, const BlockDeque<T, BlockBytes, Allocator>& rhs)
+{
+	return !(lhs == rhs);
+}
+
+/// Lexicographical comparison.
+template<typename T, std::size_t BlockBytes, typename Allocator>
+bool operator<(const BlockDeque<T, BlockBytes, Allocator>& lhs, const BlockDeque<T, BlockBytes, Allocator>& rhs)
+{
+	return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+/// Lexicographical comparison.
+template<typename T, std::size_t BlockBytes, typename Allocator>
+bool operator<=(const BlockDeque<T, BlockBytes, Allocator>& lhs, const BlockDeque<T, BlockBytes, Allocator>& rhs)
+{
+	return !(rhs < lhs);
+}
+
+/// Lexicographical comparison.
+template<typename T, std::size_t BlockBytes, typename Allocator>
+bool operator>(const BlockDeque<T, BlockBytes, Allocator>& lhs, const BlockDeque<T, BlockBytes, Allocator>& rhs)
+{
+	return rhs < lhs;
+}
+
+/// Lexicographical comparison.
+template<typename T, std::size_t BlockBytes, typename Allocator>
+bool operator>=(const BlockDeque<T, BlockBytes, Allocator>& lhs, const BlockDeque<T, BlockBytes, Allocator>& rhs)
+{
+	return !(lhs < rhs);
+}
+
+/// Forwarded to BlockDeque<T, BlockBytes, Allocator>::swap(BlockDeque& other).
+template<typename T, std::size_t BlockBytes, typename Allocator>
+void swap(BlockDeque<T, BlockBytes, Allocator>& lhs, BlockDeque<T, BlockBytes, Allocator>& rhs)
+{
+	lhs.swap(rhs);
+}
+
+/// BlockDeques are trivially relocatable if their allocator is, and std::vector holding the block map is, see
+/// POLYMORPHIC_RELOCATABLE_DELEGATES.
+template<typename T, std::size_t BlockBytes, typename Allocator>
+struct is_trivially_relocatable<BlockDeque<T, BlockBytes, Allocator>>
+	: std::integral_constant<bool, POLYMORPHIC_RELOCATABLE_DELEGATES && is_trivially_relocatable<Allocator>::value>
+{
+};
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_BlockDeque_INCLUDED
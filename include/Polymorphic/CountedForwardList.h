@@ -0,0 +1,779 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_CountedForwardList_INCLUDED
+#define Polymorphic_CountedForwardList_INCLUDED
+
+#include "Polymorphic/ExecutionFwd.h"
+#include "Polymorphic/SerializationFwd.h"
+#include <cstddef>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+
+namespace Polymorphic {
+
+template<typename T, typename Allocator>
+class CountedForwardList;
+
+template<typename T, typename Allocator>
+bool operator==(const CountedForwardList<T, Allocator>& lhs, const CountedForwardList<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+bool operator!=(const CountedForwardList<T, Allocator>& lhs, const CountedForwardList<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+bool operator<(const CountedForwardList<T, Allocator>& lhs, const CountedForwardList<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+bool operator<=(const CountedForwardList<T, Allocator>& lhs, const CountedForwardList<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+bool operator>(const CountedForwardList<T, Allocator>& lhs, const CountedForwardList<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+bool operator>=(const CountedForwardList<T, Allocator>& lhs, const CountedForwardList<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+void swap(CountedForwardList<T, Allocator>& lhs, CountedForwardList<T, Allocator>& rhs);
+
+/// Polymorphic decorator composing std::forward_list<T> with a virtual destructor and an element count, adding size()
+/// in constant time.
+///
+/// Every mutator maintains the count, at the cost of one increment per element inserted or removed. Range operations
+/// not reporting their extent, i.e. range insert_after, erase_after and splice_after, walk the affected range once,
+/// which std::forward_list does anyway. Operations failing part way through recount all elements before rethrowing.
+/// Unlike Polymorphic::ForwardList there is no implicit conversion into a mutable std::forward_list<T> reference, which
+/// would bypass the count.
+template<typename T, typename Allocator = std::allocator<T>>
+class CountedForwardList
+{
+public:
+	typedef std::forward_list<T, Allocator> DelegateType;
+	typedef T value_type;
+	typedef Allocator allocator_type;
+	typedef value_type& reference;
+	typedef const value_type& const_reference;
+	typedef typename DelegateType::pointer pointer;
+	typedef typename DelegateType::const_pointer const_pointer;
+	typedef typename DelegateType::iterator iterator;
+	typedef typename DelegateType::const_iterator const_iterator;
+	typedef typename DelegateType::difference_type difference_type;
+	typedef typename DelegateType::size_type size_type;
+
+	/// Forwarded to std::forward_list<T>::forward_list(const allocator_type& allocator = allocator_type()).
+	explicit CountedForwardList(const allocator_type& allocator = allocator_type()) : delegate(allocator), count(0)
+	{
+	}
+
+	/// Forwarded to std::forward_list<T>::forward_list(size_type n).
+	explicit CountedForwardList(size_type n) : delegate(n), count(n)
+	{
+	}
+
+	/// Forwarded to std::forward_list<T>::forward_list(size_type n, const value_type& value, const allocator_type& allocator =
+	/// allocator_type()).
+	CountedForwardList(size_type n, const value_type& value, const allocator_type& allocator = allocator_type()) :
+		delegate(n, value, allocator), count(n)
+	{
+	}
+
+	/// Forwarded to std::forward_list<T>::forward_list(InputIterator first, InputIterator last, const allocator_type& allocator =
+	/// allocator_type()).
+	template<typename InputIterator>
+	CountedForwardList(InputIterator first, InputIterator last, const allocator_type& allocator = allocator_type()) :
+		delegate(first, last, allocator), count(0)
+	{
+		recount();
+	}
+
+	/// Copy constructor.
+	CountedForwardList(const CountedForwardList& other) : delegate(other.delegate), count(other.count)
+	{
+	}
+
+	/// Copy constructor.
+	CountedForwardList(const CountedForwardList& other, const allocator_type& allocator) :
+		delegate(other.delegate, allocator), count(other.count)
+	{
+	}
+
+	/// Move constructor, leaving other empty.
+	CountedForwardList(CountedForwardList&& other) : delegate(std::move(other.delegate)), count(other.count)
+	{
+		other.clear();
+	}
+
+	/// Move constructor, leaving other empty.
+	CountedForwardList(CountedForwardList&& other, const allocator_type& allocator) :
+		delegate(std::move(other.delegate), allocator), count(other.count)
+	{
+		other.clear();
+	}
+
+	/// Forwarded to std::forward_list<T>::forward_list(std::initializer_list<value_type> initializerList, const allocator_type&
+	/// allocator = allocator_type()).
+	CountedForwardList(std::initializer_list<value_type> initializerList, const allocator_type& allocator = allocator_type()) :
+		delegate(initializerList, allocator), count(initializerList.size())
+	{
+	}
+
+	/// Copy construct from std::forward_list<T>, counting its elements.
+	CountedForwardList(const DelegateType& other) : delegate(other), count(0)
+	{
+		recount();
+	}
+
+	/// Copy construct from std::forward_list<T> with allocator, counting its elements.
+	CountedForwardList(const DelegateType& other, const allocator_type& allocator) : delegate(other, allocator), count(0)
+	{
+		recount();
+	}
+
+	/// Move construct from std::forward_list<T>, counting its elements.
+	CountedForwardList(DelegateType&& other) : delegate(std::move(other)), count(0)
+	{
+		recount();
+	}
+
+	/// Move construct from std::forward_list<T> with allocator, counting its elements.
+	CountedForwardList(DelegateType&& other, const allocator_type& allocator) : delegate(std::move(other), allocator), count(0)
+	{
+		recount();
+	}
+
+	/// Virtual destructor permitting derived classes to be deleted safely via a CountedForwardList pointer.
+	virtual ~CountedForwardList()
+	{
+	}
+
+	/// Copy assignment operator
+	CountedForwardList& operator=(const CountedForwardList& other)
+	{
+		try {
+			delegate = other.delegate;
+		} catch (...) {
+			recount();
+			throw;
+		}
+		count = other.count;
+		return *this;
+	}
+
+	/// Move assignment operator, leaving other empty.
+	CountedForwardList& operator=(CountedForwardList&& other)
+	{
+		if (this != &other) {
+			delegate = std::move(other.delegate);
+			count = other.count;
+			other.clear();
+		}
+		return *this;
+	}
+
+	/// Initializer forward_list assignment operator
+	CountedForwardList& operator=(std::initializer_list<value_type> initializerList)
+	{
+		assign(initializerList);
+		return *this;
+	}
+
+	/// Copy assignment from std::forward_list<T>, counting its elements.
+	CountedForwardList& operator=(const DelegateType& other)
+	{
+		try {
+			delegate = other;
+		} catch (...) {
+			recount();
+			throw;
+		}
+		recount();
+		return *this;
+	}
+
+	/// Move assignment from std::forward_list<T>, counting its elements.
+	CountedForwardList& operator=(DelegateType&& other)
+	{
+		delegate = std::move(other);
+		recount();
+		return *this;
+	}
+
+	/// Implicit type conversion into const std::forward_list<T> reference.
+	operator const DelegateType&() const
+	{
+		return delegate;
+	}
+
+	/// Forwarded to std::forward_list<T>::before_begin() noexcept.
+	iterator before_begin() noexcept
+	{
+		return delegate.before_begin();
+	}
+
+	/// Forwarded to std::forward_list<T>::before_begin() const noexcept.
+	const_iterator before_begin() const noexcept
+	{
+		return delegate.before_begin();
+	}
+
+	/// Forwarded to std::forward_list<T>::begin() noexcept.
+	iterator begin() noexcept
+	{
+		return delegate.begin();
+	}
+
+	/// Forwarded to std::forward_list<T>::begin() const noexcept.
+	const_iterator begin() const noexcept
+	{
+		return delegate.begin();
+	}
+
+	/// Forwarded to std::forward_list<T>::end() noexcept.
+	iterator end() noexcept
+	{
+		return delegate.end();
+	}
+
+	/// Forwarded to std::forward_list<T>::end() const noexcept.
+	const_iterator end() const noexcept
+	{
+		return delegate.end();
+	}
+
+	/// Forwarded to std::forward_list<T>::cbefore_begin() const noexcept.
+	const_iterator cbefore_begin() const noexcept
+	{
+		return delegate.cbefore_begin();
+	}
+
+	/// Forwarded to std::forward_list<T>::cbegin() const noexcept.
+	const_iterator cbegin() const noexcept
+	{
+		return delegate.cbegin();
+	}
+
+	/// Forwarded to std::forward_list<T>::cend() const noexcept.
+	const_iterator cend() const noexcept
+	{
+		return delegate.cend();
+	}
+
+	/// Forwarded to std::forward_list<T>::empty() const noexcept.
+	bool empty() const noexcept
+	{
+		return delegate.empty();
+	}
+
+	/// Number of elements, in constant time.
+	size_type size() const noexcept
+	{
+		return count;
+	}
+
+	/// Forwarded to std::forward_list<T>::max_size() const noexcept.
+	size_type max_size() const noexcept
+	{
+		return delegate.max_size();
+	}
+
+	/// Forwarded to std::forward_list<T>::front().
+	reference front()
+	{
+		return delegate.front();
+	}
+
+	/// Forwarded to std::forward_list<T>::front(size_type n) const.
+	const_reference front() const
+	{
+		return delegate.front();
+	}
+
+	/// Forwarded to std::forward_list<T>::assign(InputIterator first, InputIterator last).
+	template<typename InputIterator>
+	void assign(InputIterator first, InputIterator last)
+	{
+		try {
+			delegate.assign(first, last);
+		} catch (...) {
+			recount();
+			throw;
+		}
+		recount();
+	}
+
+	/// Forwarded to std::forward_list<T>::assign(size_type n, const value_type& value).
+	void assign(size_type n, const value_type& value)
+	{
+		try {
+			delegate.assign(n, value);
+		} catch (...) {
+			recount();
+			throw;
+		}
+		count = n;
+	}
+
+	/// Forwarded to std::forward_list<T>::assign(std::initializer_list<value_type> initializerList).
+	void assign(std::initializer_list<value_type> initializerList)
+	{
+		try {
+			delegate.assign(initializerList);
+		} catch (...) {
+			recount();
+			throw;
+		}
+		count = initializerList.size();
+	}
+
+	/// Forwarded to std::forward_list<T>::emplace_front(Args&&... args).
+	template<class... Args>
+	void emplace_front(Args&&... args)
+	{
+		delegate.emplace_front(std::forward<Args>(args)...);
+		++count;
+	}
+
+	/// Forwarded to std::forward_list<T>::push_front(const value_type& value).
+	void push_front(const value_type& value)
+	{
+		delegate.push_front(value);
+		++count;
+	}
+
+	/// Forwarded to std::forward_list<T>::push_front(value_type&& value).
+	void push_front(value_type&& value)
+	{
+		delegate.push_front(std::move(value));
+		++count;
+	}
+
+	/// Forwarded to std::forward_list<T>::pop_front().
+	void pop_front()
+	{
+		delegate.pop_front();
+		--count;
+	}
+
+	/// Forwarded to std::forward_list<T>::emplace_after(const_iterator position, Args&&... args).
+	template<typename... Args>
+	iterator emplace_after(const_iterator position, Args&&... args)
+	{
+		iterator result = delegate.emplace_after(position, std::forward<Args>(args)...);
+		++count;
+		return result;
+	}
+
+	/// Forwarded to std::forward_list<T>::insert_after(const_iterator position, const value_type& value).
+	iterator insert_after(const_iterator position, const value_type& value)
+	{
+		iterator result = delegate.insert_after(position, value);
+		++count;
+		return result;
+	}
+
+	/// Forwarded to std::forward_list<T>::insert_after(const_iterator position, size_type n, const value_type& value).
+	iterator insert_after(const_iterator position, size_type n, const value_type& value)
+	{
+		try {
+			iterator result = delegate.insert_after(position, n, value);
+			count += n;
+			return result;
+		} catch (...) {
+			recount();
+			throw;
+		}
+	}
+
+	/// Forwarded to std::forward_list<T>::insert_after(const_iterator position, InputIterator first, InputIterator last).
+	/// Counts inserted elements by walking from position to the last of them.
+	template<typename InputIterator>
+	iterator insert_after(const_iterator position, InputIterator first, InputIterator last)
+	{
+		try {
+			iterator result = delegate.insert_after(position, first, last);
+			count += static_cast<size_type>(std::distance(position, const_iterator(result)));
+			return result;
+		} catch (...) {
+			recount();
+			throw;
+		}
+	}
+
+	/// Forwarded to std::forward_list<T>::insert_after(const_iterator position, value_type&& value).
+	iterator insert_after(const_iterator position, value_type&& value)
+	{
+		iterator result = delegate.insert_after(position, std::move(value));
+		++count;
+		return result;
+	}
+
+	/// Forwarded to std::forward_list<T>::insert_after(const_iterator position, std::initializer_list<value_type> initializerList).
+	iterator insert_after(const_iterator position, std::initializer_list<value_type> initializerList)
+	{
+		try {
+			iterator result = delegate.insert_after(position, initializerList);
+			count += initializerList.size();
+			return result;
+		} catch (...) {
+			recount();
+			throw;
+		}
+	}
+
+	/// Forwarded to std::forward_list<T>::erase_after(const_iterator position).
+	iterator erase_after(const_iterator position)
+	{
+		iterator result = delegate.erase_after(position);
+		--count;
+		return result;
+	}
+
+	/// Forwarded to std::forward_list<T>::erase_after(const_iterator first, const_iterator last). Counts erased elements by
+	/// walking the range.
+	iterator erase_after(const_iterator first, const_iterator last)
+	{
+		size_type erased = between(first, last);
+		iterator result = delegate.erase_after(first, last);
+		count -= erased;
+		return result;
+	}
+
+	/// Write elements to sink as chunked stream, encoding each by codec and writing chunks of at least chunkBytes.
+	/// Memory overhead is bounded by the chunk size. Throws serialization::Error if writing fails.
+	template<typename Codec = serialization::Codec<value_type>>
+	void serialize(
+		std::ostream& sink, const Codec& codec = Codec(), std::size_t chunkBytes = serialization::defaultChunkBytes) const
+	{
+		serialization::write_chunks(sink, delegate.begin(), delegate.end(), count, codec, chunkBytes);
+	}
+
+	/// Replace elements by those of the chunked stream read from source, decoding each by codec. Throws
+	/// serialization::Error if the stream is truncated, corrupt or incompatible, leaving this container unchanged.
+	template<typename Codec = serialization::Codec<value_type>>
+	void deserialize(std::istream& source, const Codec& codec = Codec())
+	{
+		DelegateType loaded(delegate.get_allocator());
+		size_type loadedCount = 0;
+		serialization::AfterEmplacer<DelegateType> emplacer(loaded);
+		serialization::read_chunks(source, codec, [](std::size_t) {}, [&emplacer, &loadedCount](value_type&& value) {
+			emplacer(std::move(value));
+			++loadedCount;
+		});
+		delegate.swap(loaded);
+		count = loadedCount;
+	}
+
+	/// Forwarded to std::forward_list<T>::swap(std::forward_list<bool>& other).
+	void swap(CountedForwardList& other)
+	{
+		delegate.swap(other.delegate);
+		std::swap(count, other.count);
+	}
+
+	/// Forwarded to std::forward_list<T>::resize(size_type n).
+	void resize(size_type n)
+	{
+		try {
+			delegate.resize(n);
+		} catch (...) {
+			recount();
+			throw;
+		}
+		count = n;
+	}
+
+	/// Forwarded to std::forward_list<T>::resize(size_type n, const value_type& value).
+	void resize(size_type n, const value_type& value)
+	{
+		try {
+			delegate.resize(n, value);
+		} catch (...) {
+			recount();
+			throw;
+		}
+		count = n;
+	}
+
+	/// Forwarded to std::forward_list<T>::clear() noexcept.
+	void clear() noexcept
+	{
+		delegate.clear();
+		count = 0;
+	}
+
+	/// Forwarded to std::forward_list<T>::splice_after(const_iterator position, forward_list& other).
+	void splice_after(const_iterator position, CountedForwardList& other)
+	{
+		delegate.splice_after(position, other.delegate);
+		count += other.count;
+		other.count = 0;
+	}
+
+	/// Forwarded to std::forward_list<T>::splice_after(const_iterator position, forward_list&& other).
+	void splice_after(const_iterator position, CountedForwardList&& other)
+	{
+		splice_after(position, other);
+	}
+
+	/// Forwarded to std::forward_list<T>::splice_after(const_iterator position, forward_list& other, const_iterator i).
+	void splice_after(const_iterator position, CountedForwardList& other, const_iterator i)
+	{
+		delegate.splice_after(position, other.delegate, i);
+		--other.count;
+		++count;
+	}
+
+	/// Forwarded to std::forward_list<T>::splice_after(const_iterator position, forward_list&& other, const_iterator i).
+	void splice_after(const_iterator position, CountedForwardList&& other, const_iterator i)
+	{
+		splice_after(position, other, i);
+	}
+
+	/// Forwarded to std::forward_list<T>::splice_after(const_iterator position, forward_list& other, const_iterator first,
+	/// const_iterator last). Counts moved elements by walking the range.
+	void splice_after(const_iterator position, CountedForwardList& other, const_iterator first, const_iterator last)
+	{
+		size_type moved = between(first, last);
+		delegate.splice_after(position, other.delegate, first, last);
+		other.count -= moved;
+		count += moved;
+	}
+
+	/// Forwarded to std::forward_list<T>::splice_after(const_iterator position, forward_list&& other, const_iterator first,
+	/// const_iterator last). Counts moved elements by walking the range.
+	void splice_after(const_iterator position, CountedForwardList&& other, const_iterator first, const_iterator last)
+	{
+		splice_after(position, other, first, last);
+	}
+
+	/// Forwarded to std::forward_list<T>::remove(const value_type& value). Before C++20, which reports the number of
+	/// removed elements, recounts the remaining ones.
+	void remove(const value_type& value)
+	{
+		try {
+#if defined(__cpp_lib_list_remove_return_type)
+			count -= delegate.remove(value);
+#else
+			delegate.remove(value);
+			recount();
+#endif
+		} catch (...) {
+			recount();
+			throw;
+		}
+	}
+
+	/// Forwarded to std::forward_list<T>::remove_if(Predicate predicate), counting elements it is true for.
+	template<typename Predicate>
+	void remove_if(Predicate predicate)
+	{
+		size_type removed = 0;
+		try {
+			delegate.remove_if([&predicate, &removed](const value_type& element) {
+				if (predicate(element)) {
+					++removed;
+					return true;
+				}
+				return false;
+			});
+		} catch (...) {
+			count -= removed;
+			throw;
+		}
+		count -= removed;
+	}
+
+	/// Forwarded to std::forward_list<T>::unique().
+	void unique()
+	{
+		unique(std::equal_to<value_type>());
+	}
+
+	/// Forwarded to std::forward_list<T>::unique(BinaryPredicate predicate), counting pairs it is true for.
+	template<typename BinaryPredicate>
+	void unique(BinaryPredicate predicate)
+	{
+		size_type removed = 0;
+		try {
+			delegate.unique([&predicate, &removed](const value_type& lhs, const value_type& rhs) {
+				if (predicate(lhs, rhs)) {
+					++removed;
+					return true;
+				}
+				return false;
+			});
+		} catch (...) {
+			count -= removed;
+			throw;
+		}
+		count -= removed;
+	}
+
+	/// Forwarded to std::forward_list<T>::merge(CountedForwardList& other).
+	void merge(CountedForwardList& other)
+	{
+		merge(other, std::less<value_type>());
+	}
+
+	/// Forwarded to std::forward_list<T>::merge(CountedForwardList&& other).
+	void merge(CountedForwardList&& other)
+	{
+		merge(other, std::less<value_type>());
+	}
+
+	/// Forwarded to std::forward_list<T>::merge(CountedForwardList& other, Compare compare).
+	template<typename Compare>
+	void merge(CountedForwardList& other, Compare compare)
+	{
+		if (&other == this) {
+			return;
+		}
+		try {
+			delegate.merge(other.delegate, compare);
+		} catch (...) {
+			recount();
+			other.recount();
+			throw;
+		}
+		count += other.count;
+		other.count = 0;
+	}
+
+	/// Forwarded to std::forward_list<T>::merge(CountedForwardList&& other, Compare compare).
+	template<typename Compare>
+	void merge(CountedForwardList&& other, Compare compare)
+	{
+		merge(other, compare);
+	}
+
+	/// Forwarded to std::forward_list<T>::sort().
+	void sort()
+	{
+		delegate.sort();
+	}
+
+	/// Forwarded to std::forward_list<T>::sort(Compare compare).
+	template<typename Compare>
+	void sort(Compare compare)
+	{
+		delegate.sort(compare);
+	}
+
+	/// Stable sort in ascending order per execution policy, see sort(const ExecutionPolicy& policy, Compare compare).
+	void sort(const execution::sequenced_policy& policy)
+	{
+		sort(policy, std::less<value_type>());
+	}
+
+	/// Stable sort in ascending order per execution policy, see sort(const ExecutionPolicy& policy, Compare compare).
+	void sort(const execution::parallel_policy& policy)
+	{
+		sort(policy, std::less<value_type>());
+	}
+
+	/// Stable sort with respect to compare, sorting a contiguous buffer of element positions per execution policy and
+	/// relinking nodes in that order. Elements are neither copied nor moved. Parallel policies call compare
+	/// concurrently, so it must be safe to do so.
+	template<typename ExecutionPolicy, typename Compare>
+	void sort(const ExecutionPolicy& policy, Compare compare)
+	{
+		execution::detail::stable_sort_list(policy, delegate, compare);
+	}
+
+	/// Forwarded to std::forward_list<T>::reverse() noexcept.
+	void reverse() noexcept
+	{
+		delegate.reverse();
+	}
+
+	/// Forwarded to std::forward_list<T>::get_allocator() const noexcept.
+	allocator_type get_allocator() const noexcept
+	{
+		return delegate.get_allocator();
+	}
+
+private:
+	/// Number of elements strictly between first and last.
+	static size_type between(const_iterator first, const_iterator last)
+	{
+		difference_type distance = std::distance(first, last);
+		return distance > 0 ? static_cast<size_type>(distance - 1) : 0;
+	}
+
+	/// Count elements by walking the list, after it changed by an unknown number of them.
+	void recount() noexcept
+	{
+		count = static_cast<size_type>(std::distance(delegate.begin(), delegate.end()));
+	}
+
+	DelegateType delegate;
+	size_type count;
+
+	// clang-format off
+	friend bool operator== <T, Allocator>(const CountedForwardList& lhs, const CountedForwardList& rhs);
+	friend bool operator!= <T, Allocator>(const CountedForwardList& lhs, const CountedForwardList& rhs);
+	friend bool operator< <T, Allocator>(const CountedForwardList& lhs, const CountedForwardList& rhs);
+	friend bool operator<= <T, Allocator>(const CountedForwardList& lhs, const CountedForwardList& rhs);
+	friend bool operator> <T, Allocator>(const CountedForwardList& lhs, const CountedForwardList& rhs);
+	friend bool operator>= <T, Allocator>(const CountedForwardList& lhs, const CountedForwardList& rhs);
+	// clang-format on
+};
+
+/// Compares counts first, then forwarded to operator==(const std::forward_list<T, Allocator>& lhs, const
+/// std::forward_list<T, Allocator>& rhs).
+template<typename T, typename Allocator>
+bool operator==(const CountedForwardList<T, Allocator>& lhs, const CountedForwardList<T, Allocator>& rhs)
+{
+	return lhs.count == rhs.count && lhs.delegate == rhs.delegate;
+}
+
+/// Negation of operator==(const CountedForwardList<T, Allocator>& lhs, const CountedForwardList<T, Allocator>& rhs).
+template<typename T, typename Allocator>
+bool operator!=(const CountedForwardList<T, Allocator>& lhs, const CountedForwardList<T, Allocator>& rhs)
+{
+	return !(lhs == rhs);
+}
+
+/// Forwarded to operator<(const std::forward_list<T, Allocator>& lhs, const std::forward_list<T, Allocator>& rhs).
+template<typename T, typename Allocator>
+bool operator<(const CountedForwardList<T, Allocator>& lhs, const CountedForwardList<T, Allocator>& rhs)
+{
+	return lhs.delegate < rhs.delegate;
+}
+
+/// Forwarded to operator<=(const std::forward_list<T, Allocator>& lhs, const std::forward_list<T, Allocator>& rhs).
+template<typename T, typename Allocator>
+bool operator<=(const CountedForwardList<T, Allocator>& lhs, const CountedForwardList<T, Allocator>& rhs)
+{
+	return lhs.delegate <= rhs.delegate;
+}
+
+/// Forwarded to operator>(const std::forward_list<T, Allocator>& lhs, const std::forward_list<T, Allocator>& rhs).
+template<typename T, typename Allocator>
+bool operator>(const CountedForwardList<T, Allocator>& lhs, const CountedForwardList<T, Allocator>& rhs)
+{
+	return lhs.delegate > rhs.delegate;
+}
+
+/// Forwarded to operator>=(const std::forward_list<T, Allocator>& lhs, const std::forward_list<T, Allocator>& rhs).
+template<typename T, typename Allocator>
+bool operator>=(const CountedForwardList<T, Allocator>& lhs, const CountedForwardList<T, Allocator>& rhs)
+{
+	return lhs.delegate >= rhs.delegate;
+}
+
+/// Forwarded to CountedForwardList<T, Allocator>::swap(CountedForwardList& other).
+template<typename T, typename Allocator>
+void swap(CountedForwardList<T, Allocator>& lhs, CountedForwardList<T, Allocator>& rhs)
+{
+	lhs.swap(rhs);
+}
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_CountedForwardList_INCLUDED
@@ -0,0 +1,77 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_DefaultInitAllocator_INCLUDED
+#define Polymorphic_DefaultInitAllocator_INCLUDED
+
+#include "Polymorphic/Relocation.h"
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Polymorphic {
+
+/// Allocator adaptor default initializing elements constructed without arguments, instead of value initializing them.
+///
+/// Containers construct appended elements of resize(n) without arguments, which the standard allocator turns into value
+/// initialization, zero filling trivially constructible elements. Using this adaptor, e.g. as allocator of
+/// Polymorphic::Vector<std::uint8_t, DefaultInitAllocator<std::uint8_t>>, leaves such elements uninitialized instead,
+/// saving a pass over memory about to be overwritten anyway. All other operations are forwarded to Allocator.
+template<typename T, typename Allocator = std::allocator<T>>
+class DefaultInitAllocator : public Allocator
+{
+	typedef std::allocator_traits<Allocator> AllocatorTraits;
+
+public:
+	template<typename U>
+	struct rebind
+	{
+		typedef DefaultInitAllocator<U, typename AllocatorTraits::template rebind_alloc<U>> other;
+	};
+
+	/// Default construct underlying allocator.
+	DefaultInitAllocator() noexcept(std::is_nothrow_default_constructible<Allocator>::value) : Allocator()
+	{
+	}
+
+	/// Construct from underlying allocator.
+	DefaultInitAllocator(const Allocator& allocator) noexcept : Allocator(allocator)
+	{
+	}
+
+	/// Construct from adaptor of another value type.
+	template<typename U, typename OtherAllocator>
+	DefaultInitAllocator(const DefaultInitAllocator<U, OtherAllocator>& other) noexcept :
+		Allocator(static_cast<const OtherAllocator&>(other))
+	{
+	}
+
+	/// Default initialize element at pointer.
+	template<typename U>
+	void construct(U* pointer) noexcept(std::is_nothrow_default_constructible<U>::value)
+	{
+		::new (static_cast<void*>(pointer)) U;
+	}
+
+	/// Forwarded to std::allocator_traits<Allocator>::construct(allocator, pointer, args...).
+	template<typename U, typename... Args>
+	void construct(U* pointer, Args&&... args)
+	{
+		AllocatorTraits::construct(static_cast<Allocator&>(*this), pointer, std::forward<Args>(args)...);
+	}
+};
+
+/// DefaultInitAllocators are trivially relocatable if their underlying allocator is.
+template<typename T, typename Allocator>
+struct is_trivially_relocatable<DefaultInitAllocator<T, Allocator>> : is_trivially_relocatable<Allocator>
+{
+};
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_DefaultInitAllocator_INCLUDED
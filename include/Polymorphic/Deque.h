@@ -8,6 +8,11 @@
 #ifndef Polymorphic_Deque_INCLUDED
 #define Polymorphic_Deque_INCLUDED
 
+#include "Polymorphic/DefaultInitAllocator.h"
+#include "Polymorphic/ExecutionFwd.h"
+#include "Polymorphic/Relocation.h"
+#include "Polymorphic/SerializationFwd.h"
+#include <algorithm>
 #include <deque>
 
 namespace Polymorphic {
@@ -60,7 +65,9 @@ public:
 	typedef typename DelegateType::size_type size_type;
 
 	/// Forwarded to std::deque<T>::deque(const allocator_type& allocator = allocator_type()).
-	explicit Deque(const allocator_type& allocator = allocator_type()) : delegate(allocator)
+	explicit Deque(const allocator_type& allocator = allocator_type()) noexcept(
+		std::is_nothrow_constructible<DelegateType, const allocator_type&>::value) :
+		delegate(allocator)
 	{
 	}
 
@@ -93,8 +100,19 @@ public:
 	{
 	}
 
+	/// Copy constructor, copying partitions concurrently per execution policy.
+	template<
+		typename ExecutionPolicy,
+		typename = typename std::enable_if<execution::is_execution_policy<ExecutionPolicy>::value>::type>
+	Deque(const ExecutionPolicy& policy, const Deque& other) :
+		delegate(std::allocator_traits<allocator_type>::select_on_container_copy_construction(other.get_allocator()))
+	{
+		execution::assign(policy, delegate, other.begin(), other.end());
+	}
+
 	/// Move constructor.
-	Deque(Deque&& other) : delegate(std::move(other.delegate))
+	Deque(Deque&& other) noexcept(std::is_nothrow_move_constructible<DelegateType>::value) :
+		delegate(std::move(other.delegate))
 	{
 	}
 
@@ -121,7 +139,8 @@ public:
 	}
 
 	/// Move construct from std::deque<T>.
-	Deque(DelegateType&& other) : delegate(std::move(other))
+	Deque(DelegateType&& other) noexcept(std::is_nothrow_move_constructible<DelegateType>::value) :
+		delegate(std::move(other))
 	{
 	}
 
@@ -143,7 +162,7 @@ public:
 	}
 
 	/// Move assignment operator
-	Deque& operator=(Deque&& other)
+	Deque& operator=(Deque&& other) noexcept(std::is_nothrow_move_assignable<DelegateType>::value)
 	{
 		delegate = std::move(other.delegate);
 		return *this;
@@ -290,6 +309,33 @@ public:
 		delegate.resize(n, value);
 	}
 
+	/// Resize to n elements, default initializing appended ones. With a DefaultInitAllocator these are left
+	/// uninitialized if trivially default constructible, to be overwritten by the caller. Other allocators value
+	/// initialize them, like resize(size_type n) does.
+	void resize_default_init(size_type n)
+	{
+		delegate.resize(n);
+	}
+
+	/// Resize to n elements default initialized like resize_default_init(n), let operation(iterator first, size_type n)
+	/// overwrite them in place, and keep the first operation result elements, clamped to n. Deque storage is not contiguous,
+	/// so operation receives a random access iterator rather than a pointer.
+	template<typename Operation>
+	void resize_and_overwrite(size_type n, Operation operation)
+	{
+		delegate.resize(n);
+		delegate.resize(std::min(n, static_cast<size_type>(operation(delegate.begin(), n))));
+	}
+
+	/// Forwarded to std::deque<T>::resize(size_type n, const value_type& value), filling appended elements concurrently
+	/// per execution policy.
+	template<typename ExecutionPolicy>
+	typename std::enable_if<execution::is_execution_policy<ExecutionPolicy>::value>::type
+	resize(const ExecutionPolicy& policy, size_type n, const value_type& value)
+	{
+		execution::resize(policy, delegate, n, value);
+	}
+
 	/// Forwarded to std::deque<T>::shrink_to_fit().
 	void shrink_to_fit()
 	{
@@ -344,18 +390,6 @@ public:
 		return delegate.back();
 	}
 
-	/// Forwarded to std::deque<T>::data().
-	value_type* data()
-	{
-		return delegate.data();
-	}
-
-	/// Forwarded to std::deque<T>::data(size_type n) const.
-	const value_type* data() const
-	{
-		return delegate.data();
-	}
-
 	/// Forwarded to std::deque<T>::assign(InputIterator first, InputIterator last).
 	template<typename InputIterator>
 	void assign(InputIterator first, InputIterator last)
@@ -375,6 +409,15 @@ public:
 		delegate.assign(initializerList);
 	}
 
+	/// Forwarded to std::deque<T>::assign(InputIterator first, InputIterator last), copying partitions of random access
+	/// ranges concurrently per execution policy.
+	template<typename ExecutionPolicy, typename InputIterator>
+	typename std::enable_if<execution::is_execution_policy<ExecutionPolicy>::value>::type
+	assign(const ExecutionPolicy& policy, InputIterator first, InputIterator last)
+	{
+		execution::assign(policy, delegate, first, last);
+	}
+
 	/// Forwarded to std::deque<T>::emplace_front(Args&&... args).
 	template<class... Args>
 	void emplace_front(Args&&... args)
@@ -463,6 +506,15 @@ public:
 		return delegate.insert(position, initializerList);
 	}
 
+	/// Forwarded to std::deque<T>::insert(const_iterator position, InputIterator first, InputIterator last), copying
+	/// partitions of random access ranges concurrently per execution policy.
+	template<typename ExecutionPolicy, typename InputIterator>
+	typename std::enable_if<execution::is_execution_policy<ExecutionPolicy>::value, iterator>::type
+	insert(const ExecutionPolicy& policy, const_iterator position, InputIterator first, InputIterator last)
+	{
+		return execution::insert(policy, delegate, position, first, last);
+	}
+
 	/// Forwarded to std::deque<T>::erase(const_iterator position).
 	iterator erase(const_iterator position)
 	{
@@ -475,6 +527,33 @@ public:
 		return delegate.erase(first, last);
 	}
 
+	/// Erase all elements satisfying predicate, keeping the order of the others. Partitions are filtered concurrently
+	/// per execution policy, so predicate must be safe to call concurrently. Returns number of erased elements.
+	template<typename ExecutionPolicy, typename Predicate>
+	typename std::enable_if<execution::is_execution_policy<ExecutionPolicy>::value, size_type>::type
+	erase_if(const ExecutionPolicy& policy, Predicate predicate)
+	{
+		return execution::erase_if(policy, delegate, predicate);
+	}
+
+	/// Write binary image of the elements to sink, as versioned header followed by the raw payload in chunked bulk writes.
+	/// Available for trivially copyable T. Throws serialization::Error if writing fails.
+	template<typename U = T>
+	typename std::enable_if<std::is_trivially_copyable<U>::value>::type serialize(std::ostream& sink) const
+	{
+		serialization::serialize<T>(sink, delegate.begin(), delegate.size());
+	}
+
+	/// Replace elements by those of the binary image read from source in bulk reads. Available for trivially copyable
+	/// T. Throws serialization::Error if the image is truncated or incompatible, leaving this deque unchanged.
+	template<typename U = T>
+	typename std::enable_if<std::is_trivially_copyable<U>::value>::type deserialize(std::istream& source)
+	{
+		DelegateType loaded(delegate.get_allocator());
+		serialization::deserialize(source, loaded);
+		delegate.swap(loaded);
+	}
+
 	/// Forwarded to std::deque<T>::swap(std::deque<bool>& other).
 	void swap(Deque& other)
 	{
@@ -556,6 +635,25 @@ void swap(const Deque<T, Allocator>& lhs, const Deque<T, Allocator>& rhs)
 	swap(lhs.delegate, rhs.delegate);
 }
 
+/// Deques are trivially relocatable if their allocator is, and std::deque is, see POLYMORPHIC_RELOCATABLE_DELEGATES.
+template<typename T, typename Allocator>
+struct is_trivially_relocatable<Deque<T, Allocator>>
+	: std::integral_constant<bool, POLYMORPHIC_RELOCATABLE_DELEGATES && is_trivially_relocatable<Allocator>::value>
+{
+};
+
+} // namespace Polymorphic
+
+#ifdef POLYMORPHIC_EXTERN_TEMPLATES
+#include <string>
+
+namespace Polymorphic {
+
+// Explicitly instantiated by the Polymorphic::Instantiations library.
+extern template class Deque<int>;
+extern template class Deque<std::string>;
+
 } // namespace Polymorphic
+#endif // POLYMORPHIC_EXTERN_TEMPLATES
 
 #endif // Polymorphic_Deque_INCLUDED
@@ -0,0 +1,396 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_Execution_INCLUDED
+#define Polymorphic_Execution_INCLUDED
+
+#include "Polymorphic/ExecutionFwd.h"
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Polymorphic {
+
+/// Execution policies for decorator bulk operations, modelled after C++17 std::execution, but available in C++11.
+///
+/// Parallel policies run work on plain std::threads by default. Pass a subclass of Executor to run it on a thread pool
+/// instead. Inputs smaller than the policy's threshold are processed sequentially.
+namespace execution {
+
+/// Interface for running work of parallel policies on a custom thread pool.
+class Executor
+{
+public:
+	/// Virtual destructor permitting derived classes to be deleted safely via an Executor pointer.
+	virtual ~Executor()
+	{
+	}
+
+	/// Run task(0) to task(n - 1), potentially concurrently, and return when all have finished. Must rethrow one of
+	/// the exceptions thrown by tasks, if any.
+	virtual void bulk(std::size_t n, const std::function<void(std::size_t)>& task) = 0;
+};
+
+/// Sequential execution.
+struct sequenced_policy
+{
+	/// Number of partitions to split an input of n elements into. Always 1.
+	std::size_t partitions(std::size_t) const
+	{
+		return 1;
+	}
+
+	/// Run task(0) to task(n - 1) sequentially.
+	void bulk(std::size_t n, const std::function<void(std::size_t)>& task) const
+	{
+		for (std::size_t i = 0; i < n; ++i) {
+			task(i);
+		}
+	}
+};
+
+/// Parallel execution on up to concurrency threads, for inputs of at least threshold elements.
+struct parallel_policy
+{
+	/// Default minimum input size for parallel execution.
+	static const std::size_t defaultThreshold = 1 << 14;
+
+	/// Use concurrency threads, or std::thread::hardware_concurrency() if 0. Use executor to run them, or std::thread
+	/// if null.
+	constexpr parallel_policy(unsigned concurrency = 0, std::size_t threshold = defaultThreshold, Executor* executor = nullptr) :
+		concurrency(concurrency), threshold(threshold), executor(executor)
+	{
+	}
+
+	/// Copy of this policy with a different number of threads.
+	constexpr parallel_policy with_concurrency(unsigned concurrency) const
+	{
+		return parallel_policy(concurrency, threshold, executor);
+	}
+
+	/// Copy of this policy with a different minimum input size for parallel execution.
+	constexpr parallel_policy with_threshold(std::size_t threshold) const
+	{
+		return parallel_policy(concurrency, threshold, executor);
+	}
+
+	/// Copy of this policy running work on executor.
+	constexpr parallel_policy on(Executor& executor) const
+	{
+		return parallel_policy(concurrency, threshold, &executor);
+	}
+
+	/// Number of partitions to split an input of n elements into. Returns 1 below threshold.
+	std::size_t partitions(std::size_t n) const
+	{
+		if (n < threshold || n < 2) {
+			return 1;
+		}
+		std::size_t result = concurrency != 0 ? concurrency : std::thread::hardware_concurrency();
+		return std::max<std::size_t>(1, std::min(result, n));
+	}
+
+	/// Run task(0) to task(n - 1) concurrently, and return when all have finished, rethrowing the first exception.
+	void bulk(std::size_t n, const std::function<void(std::size_t)>& task) const
+	{
+		if (executor != nullptr) {
+			executor->bulk(n, task);
+			return;
+		}
+		std::exception_ptr failure;
+		std::mutex failureMutex;
+		auto guarded = [&task, &failure, &failureMutex](std::size_t i) {
+			try {
+				task(i);
+			} catch (...) {
+				std::lock_guard<std::mutex> lock(failureMutex);
+				if (!failure) {
+					failure = std::current_exception();
+				}
+			}
+		};
+		std::vector<std::thread> threads;
+		try {
+			threads.reserve(n);
+			for (std::size_t i = 1; i < n; ++i) {
+				threads.emplace_back(guarded, i);
+			}
+		} catch (...) {
+			// Destroying joinable threads would terminate, so wait for those started before failing.
+			for (auto& thread : threads) {
+				thread.join();
+			}
+			throw;
+		}
+		if (n != 0) {
+			guarded(0);
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+		if (failure) {
+			std::rethrow_exception(failure);
+		}
+	}
+
+	unsigned concurrency;
+	std::size_t threshold;
+	Executor* executor;
+};
+
+/// Parallel execution. Vectorization is left to the compiler, so this is the same as parallel_policy.
+typedef parallel_policy parallel_unsequenced_policy;
+
+constexpr sequenced_policy seq{};
+constexpr parallel_policy par{};
+constexpr parallel_unsequenced_policy par_unseq{};
+
+namespace detail {
+
+/// Parallel algorithms on sequences require random access iterators, and default constructible elements to
+/// pre-size the target sequence before filling it concurrently.
+template<typename Iterator, typename T>
+struct is_parallelizable : std::integral_constant<
+							   bool,
+							   std::is_base_of<
+								   std::random_access_iterator_tag,
+								   typename std::iterator_traits<Iterator>::iterator_category>::value &&
+								   std::is_default_constructible<T>::value>
+{
+};
+
+/// Partition boundaries splitting n elements into parts of nearly equal size.
+inline std::vector<std::size_t> bounds(std::size_t n, std::size_t parts)
+{
+	std::vector<std::size_t> result(parts + 1);
+	for (std::size_t i = 0; i <= parts; ++i) {
+		result[i] = n * i / parts;
+	}
+	return result;
+}
+
+template<typename Policy, typename Sequence, typename Iterator>
+void assign(const Policy&, Sequence& sequence, Iterator first, Iterator last, std::false_type)
+{
+	sequence.assign(first, last);
+}
+
+template<typename Policy, typename Sequence, typename Iterator>
+void assign(const Policy& policy, Sequence& sequence, Iterator first, Iterator last, std::true_type)
+{
+	std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+	std::size_t parts = policy.partitions(n);
+	if (parts < 2) {
+		sequence.assign(first, last);
+		return;
+	}
+	sequence.clear();
+	sequence.resize(n);
+	auto target = sequence.begin();
+	auto boundaries = bounds(n, parts);
+	policy.bulk(parts, [&](std::size_t i) {
+		std::copy(first + boundaries[i], first + boundaries[i + 1], target + boundaries[i]);
+	});
+}
+
+template<typename Policy, typename Sequence, typename Iterator>
+typename Sequence::iterator insert(
+	const Policy&, Sequence& sequence, typename Sequence::const_iterator position, Iterator first, Iterator last, std::false_type)
+{
+	return sequence.insert(position, first, last);
+}
+
+template<typename Policy, typename Sequence, typename Iterator>
+typename Sequence::iterator insert(
+	const Policy& policy,
+	Sequence& sequence,
+	typename Sequence::const_iterator position,
+	Iterator first,
+	Iterator last,
+	std::true_type)
+{
+	std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+	std::size_t parts = policy.partitions(n);
+	if (parts < 2) {
+		return sequence.insert(position, first, last);
+	}
+	auto offset = position - sequence.cbegin();
+	sequence.insert(position, n, typename Sequence::value_type());
+	auto target = sequence.begin() + offset;
+	auto boundaries = bounds(n, parts);
+	policy.bulk(parts, [&](std::size_t i) {
+		std::copy(first + boundaries[i], first + boundaries[i + 1], target + boundaries[i]);
+	});
+	return target;
+}
+
+template<typename Policy, typename Sequence>
+void resize(const Policy&, Sequence& sequence, std::size_t n, const typename Sequence::value_type& value, std::false_type)
+{
+	sequence.resize(n, value);
+}
+
+template<typename Policy, typename Sequence>
+void resize(const Policy& policy, Sequence& sequence, std::size_t n, const typename Sequence::value_type& value, std::true_type)
+{
+	std::size_t oldSize = sequence.size();
+	std::size_t parts = n > oldSize ? policy.partitions(n - oldSize) : 1;
+	if (parts < 2) {
+		sequence.resize(n, value);
+		return;
+	}
+	typename Sequence::value_type copy(value);
+	sequence.resize(n);
+	auto target = sequence.begin() + oldSize;
+	auto boundaries = bounds(n - oldSize, parts);
+	policy.bulk(parts, [&](std::size_t i) { std::fill(target + boundaries[i], target + boundaries[i + 1], copy); });
+}
+
+} // namespace detail
+
+/// Replace contents of sequence by copies of [first, last), copying partitions concurrently per policy.
+template<typename Policy, typename Sequence, typename Iterator>
+void assign(const Policy& policy, Sequence& sequence, Iterator first, Iterator last)
+{
+	detail::assign(
+		policy, sequence, first, last, detail::is_parallelizable<Iterator, typename Sequence::value_type>());
+}
+
+/// Insert copies of [first, last) into sequence before position, copying partitions concurrently per policy.
+template<typename Policy, typename Sequence, typename Iterator>
+typename Sequence::iterator
+insert(const Policy& policy, Sequence& sequence, typename Sequence::const_iterator position, Iterator first, Iterator last)
+{
+	return detail::insert(
+		policy, sequence, position, first, last, detail::is_parallelizable<Iterator, typename Sequence::value_type>());
+}
+
+/// Resize sequence to n elements, filling appended elements with value concurrently per policy.
+template<typename Policy, typename Sequence>
+void resize(const Policy& policy, Sequence& sequence, std::size_t n, const typename Sequence::value_type& value)
+{
+	detail::resize(
+		policy,
+		sequence,
+		n,
+		value,
+		detail::is_parallelizable<typename Sequence::iterator, typename Sequence::value_type>());
+}
+
+/// Erase elements of sequence satisfying predicate, keeping the order of the others. Partitions are filtered
+/// concurrently per policy, so predicate must be safe to call concurrently. Returns number of erased elements.
+template<typename Policy, typename Sequence, typename Predicate>
+std::size_t erase_if(const Policy& policy, Sequence& sequence, Predicate predicate)
+{
+	std::size_t n = sequence.size();
+	std::size_t parts = policy.partitions(n);
+	auto first = sequence.begin();
+	std::size_t kept;
+	if (parts < 2) {
+		kept = static_cast<std::size_t>(std::remove_if(first, sequence.end(), predicate) - first);
+	} else {
+		auto boundaries = detail::bounds(n, parts);
+		std::vector<std::size_t> ends(parts);
+		policy.bulk(parts, [&](std::size_t i) {
+			ends[i] = static_cast<std::size_t>(std::remove_if(first + boundaries[i], first + boundaries[i + 1], predicate) - first);
+		});
+		kept = ends[0];
+		for (std::size_t i = 1; i < parts; ++i) {
+			kept = static_cast<std::size_t>(std::move(first + boundaries[i], first + ends[i], first + kept) - first);
+		}
+	}
+	sequence.erase(first + kept, sequence.end());
+	return n - kept;
+}
+
+/// Stable sort of [first, last) with respect to compare.
+template<typename RandomAccessIterator, typename Compare>
+void stable_sort(const sequenced_policy&, RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+	std::stable_sort(first, last, compare);
+}
+
+/// Stable sort of [first, last) with respect to compare, sorting partitions concurrently before merging them pairwise.
+/// Parallel policies call compare concurrently, so it must be safe to do so.
+template<typename RandomAccessIterator, typename Compare>
+void stable_sort(const parallel_policy& policy, RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+	std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+	std::size_t parts = policy.partitions(n);
+	if (parts < 2) {
+		std::stable_sort(first, last, compare);
+		return;
+	}
+	auto boundaries = detail::bounds(n, parts);
+	policy.bulk(parts, [&](std::size_t i) { std::stable_sort(first + boundaries[i], first + boundaries[i + 1], compare); });
+	for (std::size_t width = 1; width < parts; width *= 2) {
+		policy.bulk((parts + 2 * width - 1) / (2 * width), [&](std::size_t i) {
+			std::size_t low = 2 * width * i;
+			std::size_t middle = std::min(low + width, parts);
+			std::size_t high = std::min(low + 2 * width, parts);
+			if (middle < high) {
+				std::inplace_merge(first + boundaries[low], first + boundaries[middle], first + boundaries[high], compare);
+			}
+		});
+	}
+}
+
+namespace detail {
+
+/// Stable sort of singly linked list with respect to compare per policy, sorting a contiguous buffer of element
+/// positions and then relinking nodes by splice_after in sorted order. Elements are neither copied nor moved, and list
+/// is unchanged if compare throws. Sorted nodes are moved to the front one by one, leaving the others in their original
+/// order, so the predecessor of each node to move is tracked by a doubly linked list of the remaining positions.
+template<typename Policy, typename ForwardList, typename Compare>
+void stable_sort_list(const Policy& policy, ForwardList& list, Compare compare)
+{
+	typedef typename ForwardList::iterator Iterator;
+	std::vector<Iterator> elements;
+	for (auto element = list.begin(); element != list.end(); ++element) {
+		elements.push_back(element);
+	}
+	std::size_t n = elements.size();
+	std::vector<std::size_t> order(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		order[i] = i;
+	}
+	stable_sort(policy, order.begin(), order.end(), [&compare, &elements](std::size_t lhs, std::size_t rhs) {
+		return compare(*elements[lhs], *elements[rhs]);
+	});
+	// Remaining positions, n marking the end in either direction.
+	std::vector<std::size_t> previous(n);
+	std::vector<std::size_t> next(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		previous[i] = i == 0 ? n : i - 1;
+		next[i] = i + 1;
+	}
+	auto tail = list.before_begin();
+	for (std::size_t i : order) {
+		if (previous[i] != n) {
+			list.splice_after(tail, list, elements[previous[i]]);
+			next[previous[i]] = next[i];
+		}
+		if (next[i] != n) {
+			previous[next[i]] = previous[i];
+		}
+		tail = elements[i];
+	}
+}
+
+} // namespace detail
+
+} // namespace execution
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_Execution_INCLUDED
@@ -0,0 +1,69 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_ExecutionFwd_INCLUDED
+#define Polymorphic_ExecutionFwd_INCLUDED
+
+#include <cstddef>
+#include <type_traits>
+
+namespace Polymorphic {
+
+/// Declarations of the execution policies and algorithms used by the decorators' policy overloads, so that decorators
+/// do not pull in threads. Include Polymorphic/Execution.h to name a policy and call those overloads.
+namespace execution {
+
+struct sequenced_policy;
+struct parallel_policy;
+
+/// True for execution policy types.
+template<typename T>
+struct is_execution_policy : std::false_type
+{
+};
+
+template<>
+struct is_execution_policy<sequenced_policy> : std::true_type
+{
+};
+
+template<>
+struct is_execution_policy<parallel_policy> : std::true_type
+{
+};
+
+template<typename Policy, typename Sequence, typename Iterator>
+void assign(const Policy& policy, Sequence& sequence, Iterator first, Iterator last);
+
+template<typename Policy, typename Sequence, typename Iterator>
+typename Sequence::iterator
+insert(const Policy& policy, Sequence& sequence, typename Sequence::const_iterator position, Iterator first, Iterator last);
+
+template<typename Policy, typename Sequence>
+void resize(const Policy& policy, Sequence& sequence, std::size_t n, const typename Sequence::value_type& value);
+
+template<typename Policy, typename Sequence, typename Predicate>
+std::size_t erase_if(const Policy& policy, Sequence& sequence, Predicate predicate);
+
+template<typename RandomAccessIterator, typename Compare>
+void stable_sort(const sequenced_policy&, RandomAccessIterator first, RandomAccessIterator last, Compare compare);
+
+template<typename RandomAccessIterator, typename Compare>
+void stable_sort(const parallel_policy& policy, RandomAccessIterator first, RandomAccessIterator last, Compare compare);
+
+namespace detail {
+
+template<typename Policy, typename ForwardList, typename Compare>
+void stable_sort_list(const Policy& policy, ForwardList& list, Compare compare);
+
+} // namespace detail
+
+} // namespace execution
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_ExecutionFwd_INCLUDED
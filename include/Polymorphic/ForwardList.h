@@ -8,7 +8,12 @@
 #ifndef Polymorphic_ForwardList_INCLUDED
 #define Polymorphic_ForwardList_INCLUDED
 
+#include "Polymorphic/ExecutionFwd.h"
+#include "Polymorphic/SerializationFwd.h"
+#include <cstddef>
 #include <forward_list>
+#include <functional>
+#include <iterator>
 
 namespace Polymorphic {
 
@@ -359,6 +364,26 @@ public:
 		return delegate.erase_after(first, last);
 	}
 
+	/// Write elements to sink as chunked stream, encoding each by codec and writing chunks of at least chunkBytes.
+	/// Memory overhead is bounded by the chunk size. Throws serialization::Error if writing fails.
+	template<typename Codec = serialization::Codec<value_type>>
+	void serialize(
+		std::ostream& sink, const Codec& codec = Codec(), std::size_t chunkBytes = serialization::defaultChunkBytes) const
+	{
+		std::size_t count = static_cast<std::size_t>(std::distance(delegate.begin(), delegate.end()));
+		serialization::write_chunks(sink, delegate.begin(), delegate.end(), count, codec, chunkBytes);
+	}
+
+	/// Replace elements by those of the chunked stream read from source, decoding each by codec. Throws
+	/// serialization::Error if the stream is truncated, corrupt or incompatible, leaving this container unchanged.
+	template<typename Codec = serialization::Codec<value_type>>
+	void deserialize(std::istream& source, const Codec& codec = Codec())
+	{
+		DelegateType loaded(delegate.get_allocator());
+		serialization::read_chunks(source, codec, [](std::size_t) {}, serialization::AfterEmplacer<DelegateType>(loaded));
+		delegate.swap(loaded);
+	}
+
 	/// Forwarded to std::forward_list<T>::swap(std::forward_list<bool>& other).
 	void swap(ForwardList& other)
 	{
@@ -486,6 +511,27 @@ public:
 		delegate.sort(compare);
 	}
 
+	/// Stable sort in ascending order per execution policy, see sort(const ExecutionPolicy& policy, Compare compare).
+	void sort(const execution::sequenced_policy& policy)
+	{
+		sort(policy, std::less<value_type>());
+	}
+
+	/// Stable sort in ascending order per execution policy, see sort(const ExecutionPolicy& policy, Compare compare).
+	void sort(const execution::parallel_policy& policy)
+	{
+		sort(policy, std::less<value_type>());
+	}
+
+	/// Stable sort with respect to compare, sorting a contiguous buffer of element positions per execution policy and
+	/// relinking nodes in that order. Elements are neither copied nor moved. Parallel policies call compare
+	/// concurrently, so it must be safe to do so.
+	template<typename ExecutionPolicy, typename Compare>
+	void sort(const ExecutionPolicy& policy, Compare compare)
+	{
+		execution::detail::stable_sort_list(policy, delegate, compare);
+	}
+
 	/// Forwarded to std::forward_list<T>::reverse() noexcept.
 	void reverse() noexcept
 	{
@@ -563,4 +609,16 @@ void swap(const ForwardList<T, Allocator>& lhs, const ForwardList<T, Allocator>&
 
 } // namespace Polymorphic
 
+#ifdef POLYMORPHIC_EXTERN_TEMPLATES
+#include <string>
+
+namespace Polymorphic {
+
+// Explicitly instantiated by the Polymorphic::Instantiations library.
+extern template class ForwardList<int>;
+extern template class ForwardList<std::string>;
+
+} // namespace Polymorphic
+#endif // POLYMORPHIC_EXTERN_TEMPLATES
+
 #endif // Polymorphic_ForwardList_INCLUDED
@@ -0,0 +1,209 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_Hash_INCLUDED
+#define Polymorphic_Hash_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <type_traits>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+namespace Polymorphic {
+
+namespace detail {
+
+/// Constants of the wyhash family of hash functions, odd and with balanced bits.
+struct HashSecret
+{
+	static constexpr std::uint64_t first = 0xa0761d6478bd642fULL;
+	static constexpr std::uint64_t second = 0xe7037ed1a0b428dbULL;
+	static constexpr std::uint64_t third = 0x8ebc6af09c88c6e3ULL;
+	static constexpr std::uint64_t fourth = 0x589965cc75374cc3ULL;
+};
+
+/// Multiply lhs and rhs into a 128 bit product, returning its low half in lhs and its high half in rhs.
+inline void multiply(std::uint64_t& lhs, std::uint64_t& rhs) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+	// __extension__ keeps -Wpedantic quiet about the non standard type.
+	__extension__ typedef unsigned __int128 Product;
+	Product product = static_cast<Product>(lhs) * rhs;
+	lhs = static_cast<std::uint64_t>(product);
+	rhs = static_cast<std::uint64_t>(product >> 64);
+#else
+	std::uint64_t lhsHigh = lhs >> 32, lhsLow = static_cast<std::uint32_t>(lhs);
+	std::uint64_t rhsHigh = rhs >> 32, rhsLow = static_cast<std::uint32_t>(rhs);
+	std::uint64_t high = lhsHigh * rhsHigh, middle = lhsHigh * rhsLow, middleToo = lhsLow * rhsHigh, low = lhsLow * rhsLow;
+	std::uint64_t carry = (low >> 32) + static_cast<std::uint32_t>(middle) + static_cast<std::uint32_t>(middleToo);
+	lhs = (carry << 32) | static_cast<std::uint32_t>(low);
+	rhs = high + (middle >> 32) + (middleToo >> 32) + (carry >> 32);
+#endif
+}
+
+/// Multiply lhs and rhs into a 128 bit product, folding its halves by xor. Every bit of the result depends on every
+/// bit of both factors.
+inline std::uint64_t mix(std::uint64_t lhs, std::uint64_t rhs) noexcept
+{
+	multiply(lhs, rhs);
+	return lhs ^ rhs;
+}
+
+/// Read 8 bytes in native byte order.
+inline std::uint64_t read64(const unsigned char* bytes) noexcept
+{
+	std::uint64_t result;
+	std::memcpy(&result, bytes, sizeof(result));
+	return result;
+}
+
+/// Read 4 bytes in native byte order.
+inline std::uint64_t read32(const unsigned char* bytes) noexcept
+{
+	std::uint32_t result;
+	std::memcpy(&result, bytes, sizeof(result));
+	return result;
+}
+
+/// Hash of an integer by a single mixing multiplication, so that keys sharing their low bits still spread across
+/// power of two bucket counts.
+inline std::uint64_t hashInteger(std::uint64_t value) noexcept
+{
+	return mix(value ^ HashSecret::first, HashSecret::second);
+}
+
+/// Hash of size bytes at data, after wyhash. Reads 8 byte words, consuming inputs longer than 48 bytes by three
+/// independent multiplication chains per 48 byte block, which the processor overlaps.
+inline std::uint64_t hashBytes(const void* data, std::size_t size, std::uint64_t seed = 0) noexcept
+{
+	const unsigned char* bytes = static_cast<const unsigned char*>(data);
+	seed ^= mix(seed ^ HashSecret::first, HashSecret::second);
+	std::uint64_t a, b;
+	if (size <= 16) {
+		if (size >= 4) {
+			std::size_t offset = (size >> 3) << 2;
+			a = (read32(bytes) << 32) | read32(bytes + offset);
+			b = (read32(bytes + size - 4) << 32) | read32(bytes + size - 4 - offset);
+		} else if (size > 0) {
+			a = (static_cast<std::uint64_t>(bytes[0]) << 16) | (static_cast<std::uint64_t>(bytes[size >> 1]) << 8) |
+				bytes[size - 1];
+			b = 0;
+		} else {
+			a = b = 0;
+		}
+	} else {
+		std::size_t remaining = size;
+		if (remaining > 48) {
+			std::uint64_t second = seed, third = seed;
+			do {
+				seed = mix(read64(bytes) ^ HashSecret::second, read64(bytes + 8) ^ seed);
+				second = mix(read64(bytes + 16) ^ HashSecret::third, read64(bytes + 24) ^ second);
+				third = mix(read64(bytes + 32) ^ HashSecret::fourth, read64(bytes + 40) ^ third);
+				bytes += 48;
+				remaining -= 48;
+			} while (remaining > 48);
+			seed ^= second ^ third;
+		}
+		while (remaining > 16) {
+			seed = mix(read64(bytes) ^ HashSecret::second, read64(bytes + 8) ^ seed);
+			bytes += 16;
+			remaining -= 16;
+		}
+		a = read64(bytes + remaining - 16);
+		b = read64(bytes + remaining - 8);
+	}
+	a ^= HashSecret::second;
+	b ^= seed;
+	multiply(a, b);
+	return mix(a ^ HashSecret::first ^ size, b ^ HashSecret::second);
+}
+
+} // namespace detail
+
+/// Hash function object, selectable as Hash parameter of the unordered decorators, e.g. UnorderedMap<std::string, int,
+/// Polymorphic::Hash<std::string>>. Integers, enumerations, pointers and strings are hashed by the wyhash family of
+/// functions, all other keys by std::hash<Key>.
+///
+/// Unlike std::hash of libstdc++, which is the identity for integers, integer hashes are well mixed, so that keys
+/// sharing their low bits, like aligned addresses or multiples of a stride, do not cluster in power of two bucket
+/// arrays or shards. The prime bucket counts of libstdc++'s own unordered containers do not suffer from identity
+/// hashing, and even profit from it for dense integer keys, visiting buckets in key order. Strings are hashed 8 bytes
+/// at a time, several times faster than std::hash for strings beyond 64 bytes. Hashes are not stable across platforms
+/// or releases, and must not be persisted.
+template<typename Key, typename Enable = void>
+struct Hash : std::hash<Key>
+{
+};
+
+/// Hash of integers and enumerations.
+template<typename Key>
+struct Hash<Key, typename std::enable_if<std::is_integral<Key>::value || std::is_enum<Key>::value>::type>
+{
+	std::size_t operator()(Key key) const noexcept
+	{
+		return static_cast<std::size_t>(detail::hashInteger(static_cast<std::uint64_t>(key)));
+	}
+};
+
+/// Hash of pointers, by address.
+template<typename T>
+struct Hash<T*>
+{
+	std::size_t operator()(T* key) const noexcept
+	{
+		return static_cast<std::size_t>(detail::hashInteger(reinterpret_cast<std::uintptr_t>(key)));
+	}
+};
+
+/// Hash of strings by their characters. Transparent, hashing null terminated character arrays, and string views
+/// from C++17 on, equal to strings of the same characters. Not declared noexcept, so that libstdc++ keeps storing
+/// hash codes of strings in its nodes, as it does for std::hash<std::string>.
+template<typename Char, typename Traits, typename Allocator>
+struct Hash<std::basic_string<Char, Traits, Allocator>>
+{
+	typedef void is_transparent;
+
+	std::size_t operator()(const std::basic_string<Char, Traits, Allocator>& key) const
+	{
+		return static_cast<std::size_t>(detail::hashBytes(key.data(), key.size() * sizeof(Char)));
+	}
+
+	std::size_t operator()(const Char* key) const
+	{
+		return static_cast<std::size_t>(detail::hashBytes(key, Traits::length(key) * sizeof(Char)));
+	}
+
+#if defined(__cpp_lib_string_view)
+	std::size_t operator()(std::basic_string_view<Char, Traits> key) const
+	{
+		return static_cast<std::size_t>(detail::hashBytes(key.data(), key.size() * sizeof(Char)));
+	}
+#endif
+};
+
+#if defined(__cpp_lib_string_view)
+/// Hash of string views by their characters, equal to Hash of strings of the same characters.
+template<typename Char, typename Traits>
+struct Hash<std::basic_string_view<Char, Traits>>
+{
+	typedef void is_transparent;
+
+	std::size_t operator()(std::basic_string_view<Char, Traits> key) const
+	{
+		return static_cast<std::size_t>(detail::hashBytes(key.data(), key.size() * sizeof(Char)));
+	}
+};
+#endif
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_Hash_INCLUDED
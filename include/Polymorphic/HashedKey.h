@@ -0,0 +1,163 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_HashedKey_INCLUDED
+#define Polymorphic_HashedKey_INCLUDED
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace Polymorphic {
+
+/// Key bundled with its hash code, computed once by Hash on construction or supplied precomputed.
+///
+/// Used as key_type of the unordered decorators, together with CachedHash and CachedKeyEqual, the hash code is stored
+/// next to each element. Rehashing then never calls Hash again, and lookups compare hash codes before keys. The
+/// CachedHashUnorderedMap, CachedHashUnorderedSet, CachedHashUnorderedMultimap and CachedHashUnorderedMultiset aliases
+/// select this policy. Hash is default constructed, so it must not carry state.
+template<typename Key, typename Hash = std::hash<Key>>
+class HashedKey
+{
+public:
+	typedef Key key_type;
+	typedef Hash hasher;
+
+	/// Construct from key, computing its hash code.
+	HashedKey(const key_type& key) : value(key), code(hasher()(value))
+	{
+	}
+
+	/// Construct from key, computing its hash code.
+	HashedKey(key_type&& key) : value(std::move(key)), code(hasher()(value))
+	{
+	}
+
+	/// Construct from key and its hash code, which must equal Hash()(key).
+	HashedKey(const key_type& key, std::size_t code) : value(key), code(code)
+	{
+	}
+
+	/// Construct from key and its hash code, which must equal Hash()(key).
+	HashedKey(key_type&& key, std::size_t code) : value(std::move(key)), code(code)
+	{
+	}
+
+	/// The key.
+	const key_type& get() const noexcept
+	{
+		return value;
+	}
+
+	/// Implicit type conversion into const key reference.
+	operator const key_type&() const noexcept
+	{
+		return value;
+	}
+
+	/// The hash code of the key.
+	std::size_t hash_code() const noexcept
+	{
+		return code;
+	}
+
+private:
+	key_type value;
+	std::size_t code;
+};
+
+/// Compares hash codes first, then keys.
+template<typename Key, typename Hash>
+bool operator==(const HashedKey<Key, Hash>& lhs, const HashedKey<Key, Hash>& rhs)
+{
+	return lhs.hash_code() == rhs.hash_code() && lhs.get() == rhs.get();
+}
+
+/// Negation of operator==(const HashedKey<Key, Hash>& lhs, const HashedKey<Key, Hash>& rhs).
+template<typename Key, typename Hash>
+bool operator!=(const HashedKey<Key, Hash>& lhs, const HashedKey<Key, Hash>& rhs)
+{
+	return !(lhs == rhs);
+}
+
+/// Compares keys.
+template<typename Key, typename Hash>
+bool operator<(const HashedKey<Key, Hash>& lhs, const HashedKey<Key, Hash>& rhs)
+{
+	return lhs.get() < rhs.get();
+}
+
+/// Hash function of the cached hash policy, returning the hash code stored in HashedKey. Being noexcept and cheap, the
+/// standard library does not store it a second time.
+template<typename Key, typename Hash = std::hash<Key>>
+struct CachedHash
+{
+	std::size_t operator()(const HashedKey<Key, Hash>& key) const noexcept
+	{
+		return key.hash_code();
+	}
+};
+
+/// Key equality of the cached hash policy, rejecting keys by their hash codes before comparing them by Predicate.
+template<typename Key, typename Hash = std::hash<Key>, typename Predicate = std::equal_to<Key>>
+struct CachedKeyEqual
+{
+	bool operator()(const HashedKey<Key, Hash>& lhs, const HashedKey<Key, Hash>& rhs) const
+	{
+		return lhs.hash_code() == rhs.hash_code() && Predicate()(lhs.get(), rhs.get());
+	}
+};
+
+namespace detail {
+
+/// Keys passed to the precomputed hash overloads of the unordered decorators, as is unless key_type is a HashedKey.
+/// Plain keys are forwarded to the delegate, which hashes them again.
+template<typename K>
+struct Unhashed
+{
+	typedef K type;
+
+	/// Key to look up.
+	static const K& probe(const K& key, std::size_t) noexcept
+	{
+		return key;
+	}
+
+	/// Key to construct a key_type from.
+	template<typename Argument>
+	static Argument&& make(Argument&& key, std::size_t) noexcept
+	{
+		return std::forward<Argument>(key);
+	}
+};
+
+/// Keys passed to the precomputed hash overloads of the unordered decorators using the cached hash policy, bundled
+/// with the hash code passed along.
+template<typename Key, typename Hash>
+struct Unhashed<HashedKey<Key, Hash>>
+{
+	typedef Key type;
+
+	/// Key to look up.
+	static HashedKey<Key, Hash> probe(const Key& key, std::size_t code)
+	{
+		return HashedKey<Key, Hash>(key, code);
+	}
+
+	/// Key to construct a key_type from.
+	template<typename Argument>
+	static HashedKey<Key, Hash> make(Argument&& key, std::size_t code)
+	{
+		return HashedKey<Key, Hash>(Key(std::forward<Argument>(key)), code);
+	}
+};
+
+} // namespace detail
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_HashedKey_INCLUDED
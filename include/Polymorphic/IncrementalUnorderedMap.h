@@ -0,0 +1,823 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_IncrementalUnorderedMap_INCLUDED
+#define Polymorphic_IncrementalUnorderedMap_INCLUDED
+
+#include "Polymorphic/HashedKey.h"
+#include "Polymorphic/SerializationFwd.h"
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+
+namespace Polymorphic {
+
+template<typename Key, typename T, typename Hash, typename Predicate, typename Allocator>
+class IncrementalUnorderedMap;
+
+template<typename Key, typename T, typename Hash, typename Predicate, typename Allocator>
+bool operator==(
+	const IncrementalUnorderedMap<Key, T, Hash, Predicate, Allocator>& lhs,
+	const IncrementalUnorderedMap<Key, T, Hash, Predicate, Allocator>& rhs);
+
+template<typename Key, typename T, typename Hash, typename Predicate, typename Allocator>
+bool operator!=(
+	const IncrementalUnorderedMap<Key, T, Hash, Predicate, Allocator>& lhs,
+	const IncrementalUnorderedMap<Key, T, Hash, Predicate, Allocator>& rhs);
+
+template<typename Key, typename T, typename Hash, typename Predicate, typename Allocator>
+void swap(
+	IncrementalUnorderedMap<Key, T, Hash, Predicate, Allocator>& lhs,
+	IncrementalUnorderedMap<Key, T, Hash, Predicate, Allocator>& rhs);
+
+/// Hash map providing the UnorderedMap interface, rehashing incrementally instead of all at once.
+///
+/// When an insertion would exceed max_load_factor(), std::unordered_map relinks all elements into a new bucket array
+/// within that insertion. IncrementalUnorderedMap instead sets its std::unordered_map<Key, T> aside as draining table,
+/// and inserts into a new one with twice as many buckets. Every following insertion moves up to migrationStep elements
+/// from the draining table into the new one, which is large enough to receive them all before it has to grow itself.
+/// Worst case insertion latency then is the allocation of the new bucket array, rather than the rehash of every
+/// element. Lookups and erasures consult both tables while migration is in progress. From C++17 on elements are moved
+/// as nodes, keeping references to them valid, before that they are moved by copying the key and moving the mapped
+/// value, invalidating references.
+///
+/// Deviating from UnorderedMap, every insertion invalidates iterators, as if it rehashed, swap and move invalidate
+/// iterators, and there is neither a bucket interface nor a conversion into std::unordered_map<Key, T>. bucket_count(),
+/// load_factor() and max_load_factor() refer to the table receiving insertions. rehash(), reserve(), shrink_to_fit()
+/// and max_load_factor(float) complete migration before forwarding, taking linear time.
+template<
+	typename Key,
+	typename T,
+	typename Hash = std::hash<Key>,
+	typename Predicate = std::equal_to<Key>,
+	typename Allocator = std::allocator<std::pair<const Key, T>>>
+class IncrementalUnorderedMap
+{
+public:
+	typedef std::unordered_map<Key, T, Hash, Predicate, Allocator> DelegateType;
+
+private:
+	template<bool isConst>
+	class Iterator;
+
+public:
+	typedef Key key_type;
+	typedef T mapped_type;
+	typedef std::pair<const key_type, mapped_type> value_type;
+	typedef Hash hasher;
+	typedef Predicate key_equal;
+	typedef Allocator allocator_type;
+	typedef value_type& reference;
+	typedef const value_type& const_reference;
+	typedef typename DelegateType::pointer pointer;
+	typedef typename DelegateType::const_pointer const_pointer;
+	typedef Iterator<false> iterator;
+	typedef Iterator<true> const_iterator;
+	typedef typename DelegateType::difference_type difference_type;
+	typedef typename DelegateType::size_type size_type;
+
+	/// Number of elements migrated from the draining table by each insertion.
+	static constexpr size_type migrationStep = 8;
+
+	/// Construct empty map using default minInitialBuckets.
+	IncrementalUnorderedMap() : delegate(), draining()
+	{
+	}
+
+	/// Construct empty map with at least minInitialBuckets, hash, predicate and allocator.
+	explicit IncrementalUnorderedMap(
+		size_type minInitialBuckets,
+		const hasher& hash = hasher(),
+		const key_equal& predicate = key_equal(),
+		const allocator_type& allocator = allocator_type()) :
+		delegate(minInitialBuckets, hash, predicate, allocator),
+		draining(0, hash, predicate, allocator)
+	{
+	}
+
+	/// Construct empty map with allocator.
+	explicit IncrementalUnorderedMap(const allocator_type& allocator) : delegate(allocator), draining(allocator)
+	{
+	}
+
+	/// Construct from elements in [first, last) using default minInitialBuckets.
+	template<typename InputIterator>
+	IncrementalUnorderedMap(InputIterator first, InputIterator last) : delegate(), draining()
+	{
+		insert(first, last);
+	}
+
+	/// Construct from elements in [first, last) with at least minInitialBuckets, hash, predicate and allocator.
+	template<typename InputIterator>
+	IncrementalUnorderedMap(
+		InputIterator first,
+		InputIterator last,
+		size_type minInitialBuckets,
+		const hasher& hash = hasher(),
+		const key_equal& predicate = key_equal(),
+		const allocator_type& allocator = allocator_type()) :
+		delegate(minInitialBuckets, hash, predicate, allocator),
+		draining(0, hash, predicate, allocator)
+	{
+		insert(first, last);
+	}
+
+	/// Copy constructor.
+	IncrementalUnorderedMap(const IncrementalUnorderedMap& other) : delegate(other.delegate), draining(other.draining)
+	{
+	}
+
+	/// Copy constructor.
+	IncrementalUnorderedMap(const IncrementalUnorderedMap& other, const allocator_type& allocator) :
+		delegate(other.delegate, allocator),
+		draining(other.draining, allocator)
+	{
+	}
+
+	/// Move constructor.
+	IncrementalUnorderedMap(IncrementalUnorderedMap&& other) :
+		delegate(std::move(other.delegate)),
+		draining(std::move(other.draining))
+	{
+	}
+
+	/// Move constructor.
+	IncrementalUnorderedMap(IncrementalUnorderedMap&& other, const allocator_type& allocator) :
+		delegate(std::move(other.delegate), allocator),
+		draining(std::move(other.draining), allocator)
+	{
+	}
+
+	/// Construct from initializer list elements using default minInitialBuckets.
+	IncrementalUnorderedMap(std::initializer_list<value_type> initializerList) : delegate(), draining()
+	{
+		insert(initializerList);
+	}
+
+	/// Construct from initializer list elements with at least minInitialBuckets, hash, predicate and allocator.
+	IncrementalUnorderedMap(
+		std::initializer_list<value_type> initializerList,
+		size_type minInitialBuckets,
+		const hasher& hash = hasher(),
+		const key_equal& predicate = key_equal(),
+		const allocator_type& allocator = allocator_type()) :
+		delegate(minInitialBuckets, hash, predicate, allocator),
+		draining(0, hash, predicate, allocator)
+	{
+		insert(initializerList);
+	}
+
+	/// Copy construct from std::unordered_map<Key, T>.
+	IncrementalUnorderedMap(const DelegateType& other) :
+		delegate(other),
+		draining(0, other.hash_function(), other.key_eq(), other.get_allocator())
+	{
+	}
+
+	/// Move construct from std::unordered_map<Key, T>.
+	IncrementalUnorderedMap(DelegateType&& other) :
+		delegate(std::move(other)),
+		draining(0, delegate.hash_function(), delegate.key_eq(), delegate.get_allocator())
+	{
+	}
+
+	/// Virtual destructor permitting derived classes to be deleted safely via an IncrementalUnorderedMap pointer.
+	virtual ~IncrementalUnorderedMap()
+	{
+	}
+
+	/// Copy assignment operator
+	IncrementalUnorderedMap& operator=(const IncrementalUnorderedMap& other)
+	{
+		delegate = other.delegate;
+		draining = other.draining;
+		return *this;
+	}
+
+	/// Move assignment operator
+	IncrementalUnorderedMap& operator=(IncrementalUnorderedMap&& other)
+	{
+		delegate = std::move(other.delegate);
+		draining = std::move(other.draining);
+		return *this;
+	}
+
+	/// Initializer list assignment operator
+	IncrementalUnorderedMap& operator=(std::initializer_list<value_type> initializerList)
+	{
+		clear();
+		insert(initializerList);
+		return *this;
+	}
+
+	/// Copy assignment from std::unordered_map<Key, T>.
+	IncrementalUnorderedMap& operator=(const DelegateType& other)
+	{
+		delegate = other;
+		releaseDraining();
+		return *this;
+	}
+
+	/// Move assignment from std::unordered_map<Key, T>.
+	IncrementalUnorderedMap& operator=(DelegateType&& other)
+	{
+		delegate = std::move(other);
+		releaseDraining();
+		return *this;
+	}
+
+	/// Iterator to the first element, visiting the table receiving insertions before the draining table.
+	iterator begin() noexcept
+	{
+		return iterator(&delegate, delegate.begin(), &draining);
+	}
+
+	/// Iterator to the first element, visiting the table receiving insertions before the draining table.
+	const_iterator begin() const noexcept
+	{
+		return const_iterator(&delegate, delegate.begin(), &draining);
+	}
+
+	/// Iterator past the last element.
+	iterator end() noexcept
+	{
+		return iterator(&draining, draining.end(), nullptr);
+	}
+
+	/// Iterator past the last element.
+	const_iterator end() const noexcept
+	{
+		return const_iterator(&draining, draining.end(), nullptr);
+	}
+
+	/// Iterator to the first element, visiting the table receiving insertions before the draining table.
+	const_iterator cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	/// Iterator past the last element.
+	const_iterator cend() const noexcept
+	{
+		return end();
+	}
+
+	/// Whether both tables are empty.
+	bool empty() const noexcept
+	{
+		return delegate.empty() && draining.empty();
+	}
+
+	/// Number of elements in both tables.
+	size_type size() const noexcept
+	{
+		return delegate.size() + draining.size();
+	}
+
+	/// Forwarded to std::unordered_map<Key, T>::max_size() const noexcept.
+	size_type max_size() const noexcept
+	{
+		return delegate.max_size();
+	}
+
+	/// Reference to the value mapped to key, value initialized and inserted if key is missing.
+	mapped_type& operator[](const key_type& key)
+	{
+		prepareInsert();
+		if (!draining.empty()) {
+			auto position = draining.find(key);
+			if (position != draining.end()) {
+				return position->second;
+			}
+		}
+		return delegate[key];
+	}
+
+	/// Reference to the value mapped to key, value initialized and inserted if key is missing.
+	mapped_type& operator[](key_type&& key)
+	{
+		prepareInsert();
+		if (!draining.empty()) {
+			auto position = draining.find(key);
+			if (position != draining.end()) {
+				return position->second;
+			}
+		}
+		return delegate[std::move(key)];
+	}
+
+	/// Reference to the value mapped to key. Throws std::out_of_range if key is missing.
+	mapped_type& at(const key_type& key)
+	{
+		iterator position = find(key);
+		if (position == end()) {
+			throw std::out_of_range("IncrementalUnorderedMap::at");
+		}
+		return position->second;
+	}
+
+	/// Reference to the value mapped to key. Throws std::out_of_range if key is missing.
+	const mapped_type& at(const key_type& key) const
+	{
+		const_iterator position = find(key);
+		if (position == end()) {
+			throw std::out_of_range("IncrementalUnorderedMap::at");
+		}
+		return position->second;
+	}
+
+	/// Insert value unless its key is present.
+	std::pair<iterator, bool> insert(const value_type& value)
+	{
+		return emplace(value);
+	}
+
+	/// Insert value unless its key is present.
+	template<typename Pair, typename = typename std::enable_if<std::is_constructible<value_type, Pair&&>::value>::type>
+	std::pair<iterator, bool> insert(Pair&& value)
+	{
+		return emplace(std::forward<Pair>(value));
+	}
+
+	/// Insert value unless its key is present. The position hint is ignored.
+	iterator insert(const_iterator, const value_type& value)
+	{
+		return emplace(value).first;
+	}
+
+	/// Insert value unless its key is present. The position hint is ignored.
+	template<typename Pair, typename = typename std::enable_if<std::is_constructible<value_type, Pair&&>::value>::type>
+	iterator insert(const_iterator, Pair&& value)
+	{
+		return emplace(std::forward<Pair>(value)).first;
+	}
+
+	/// Insert elements in [first, last) whose keys are not present, one by one, so that migration proceeds as usual.
+	template<typename InputIterator>
+	void insert(InputIterator first, InputIterator last)
+	{
+		for (; first != last; ++first) {
+			emplace(*first);
+		}
+	}
+
+	/// Insert initializer list elements whose keys are not present.
+	void insert(std::initializer_list<value_type> initializerList)
+	{
+		insert(initializerList.begin(), initializerList.end());
+	}
+
+	/// Erase element at position, returning an iterator to the following one.
+	iterator erase(const_iterator position)
+	{
+		if (position.table == &delegate) {
+			return iterator(&delegate, delegate.erase(position.position), &draining);
+		}
+		return iterator(&draining, draining.erase(position.position), nullptr);
+	}
+
+	/// Erase element with key, returning the number of elements erased.
+	size_type erase(const key_type& key)
+	{
+		size_type erased = delegate.erase(key);
+		if (erased == 0 && !draining.empty()) {
+			erased = draining.erase(key);
+		}
+		return erased;
+	}
+
+	/// Erase elements in [first, last), returning an iterator to the element following them.
+	iterator erase(const_iterator first, const_iterator last)
+	{
+		while (first != last) {
+			first = erase(first);
+		}
+		if (last.table == &delegate) {
+			return iterator(&delegate, delegate.erase(last.position, last.position), &draining);
+		}
+		return iterator(&draining, draining.erase(last.position, last.position), nullptr);
+	}
+
+	/// Write elements to sink as chunked stream, encoding each by codec and writing chunks of at least chunkBytes.
+	/// Memory overhead is bounded by the chunk size. Throws serialization::Error if writing fails.
+	template<typename Codec = serialization::Codec<value_type>>
+	void serialize(
+		std::ostream& sink, const Codec& codec = Codec(), std::size_t chunkBytes = serialization::defaultChunkBytes) const
+	{
+		serialization::write_chunks(sink, begin(), end(), size(), codec, chunkBytes);
+	}
+
+	/// Replace elements by those of the chunked stream read from source, decoding each by codec while reserving
+	/// buckets up to the element count written by serialize(). Throws serialization::Error if the stream is
+	/// truncated, corrupt or incompatible, leaving this container unchanged.
+	template<typename Codec = serialization::Codec<value_type>>
+	void deserialize(std::istream& source, const Codec& codec = Codec())
+	{
+		DelegateType loaded(0, delegate.hash_function(), delegate.key_eq(), delegate.get_allocator());
+		loaded.max_load_factor(delegate.max_load_factor());
+		serialization::read_chunks(
+			source, codec, [&loaded](std::size_t count) { loaded.reserve(count); }, serialization::Emplacer<DelegateType>(loaded));
+		delegate.swap(loaded);
+		releaseDraining();
+	}
+
+	/// Swap elements and migration state with other.
+	void swap(IncrementalUnorderedMap& other)
+	{
+		delegate.swap(other.delegate);
+		draining.swap(other.draining);
+	}
+
+	/// Erase all elements of both tables, ending migration.
+	void clear() noexcept
+	{
+		delegate.clear();
+		draining.clear();
+	}
+
+	/// Insert an element constructed from args unless its key is present, migrating up to migrationStep elements
+	/// beforehand.
+	template<typename... Args>
+	std::pair<iterator, bool> emplace(Args&&... args)
+	{
+		prepareInsert();
+		auto inserted = delegate.emplace(std::forward<Args>(args)...);
+		if (inserted.second && !draining.empty()) {
+			auto position = draining.find(inserted.first->first);
+			if (position != draining.end()) {
+				delegate.erase(inserted.first);
+				return std::make_pair(iterator(&draining, position, nullptr), false);
+			}
+		}
+		return std::make_pair(iterator(&delegate, inserted.first, &draining), inserted.second);
+	}
+
+	/// Insert an element constructed from args unless its key is present. The position hint is ignored.
+	template<typename... Args>
+	iterator emplace_hint(const_iterator, Args&&... args)
+	{
+		return emplace(std::forward<Args>(args)...).first;
+	}
+
+	/// Emplace an element with key, whose hash code was precomputed as hash_function()(key), and mapped value constructed
+	/// from args. The code is used instead of hashing key again if key_type is a HashedKey.
+	template<typename K, typename... Args>
+	std::pair<iterator, bool> emplace_hashed(K&& key, std::size_t hash, Args&&... args)
+	{
+		return emplace(
+			std::piecewise_construct,
+			std::forward_as_tuple(detail::Unhashed<key_type>::make(std::forward<K>(key), hash)),
+			std::forward_as_tuple(std::forward<Args>(args)...));
+	}
+
+	/// Find element with key in either table.
+	iterator find(const key_type& key)
+	{
+		auto position = delegate.find(key);
+		if (position != delegate.end() || draining.empty()) {
+			return position != delegate.end() ? iterator(&delegate, position, &draining) : end();
+		}
+		return iterator(&draining, draining.find(key), nullptr);
+	}
+
+	/// Find element with key in either table.
+	const_iterator find(const key_type& key) const
+	{
+		auto position = delegate.find(key);
+		if (position != delegate.end() || draining.empty()) {
+			return position != delegate.end() ? const_iterator(&delegate, position, &draining) : end();
+		}
+		return const_iterator(&draining, draining.find(key), nullptr);
+	}
+
+	/// Number of elements with key, 0 or 1.
+	size_type count(const key_type& key) const
+	{
+		return delegate.count(key) + (draining.empty() ? 0 : draining.count(key));
+	}
+
+	/// Range of the elements with key, empty or holding one element.
+	std::pair<iterator, iterator> equal_range(const key_type& key)
+	{
+		iterator position = find(key);
+		return std::make_pair(position, position == end() ? position : std::next(position));
+	}
+
+	/// Range of the elements with key, empty or holding one element.
+	std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+	{
+		const_iterator position = find(key);
+		return std::make_pair(position, position == end() ? position : std::next(position));
+	}
+
+	/// Find key by its hash code precomputed as hash_function()(key). The code is used instead of hashing key again if
+	/// key_type is a HashedKey.
+	iterator find(const typename detail::Unhashed<key_type>::type& key, std::size_t hash)
+	{
+		return find(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
+	/// Find key by its hash code precomputed as hash_function()(key). The code is used instead of hashing key again if
+	/// key_type is a HashedKey.
+	const_iterator find(const typename detail::Unhashed<key_type>::type& key, std::size_t hash) const
+	{
+		return find(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
+	/// Count key by its hash code precomputed as hash_function()(key). The code is used instead of hashing key again if
+	/// key_type is a HashedKey.
+	size_type count(const typename detail::Unhashed<key_type>::type& key, std::size_t hash) const
+	{
+		return count(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
+	/// Bucket count of the table receiving insertions.
+	size_type bucket_count() const noexcept
+	{
+		return delegate.bucket_count();
+	}
+
+	/// Forwarded to std::unordered_map<Key, T>::max_bucket_count() const noexcept.
+	size_type max_bucket_count() const noexcept
+	{
+		return delegate.max_bucket_count();
+	}
+
+	/// Load factor of the table receiving insertions.
+	float load_factor() const noexcept
+	{
+		return delegate.load_factor();
+	}
+
+	/// Maximum load factor of the table receiving insertions, passed on when it is set aside.
+	float max_load_factor() const noexcept
+	{
+		return delegate.max_load_factor();
+	}
+
+	/// Complete migration, then set the maximum load factor.
+	void max_load_factor(float loadFactor)
+	{
+		completeMigration();
+		delegate.max_load_factor(loadFactor);
+	}
+
+	/// Complete migration, then forward to std::unordered_map<Key, T>::rehash(size_type n).
+	void rehash(size_type n)
+	{
+		completeMigration();
+		delegate.rehash(n);
+	}
+
+	/// Complete migration, then forward to std::unordered_map<Key, T>::reserve(size_type n).
+	void reserve(size_type n)
+	{
+		completeMigration();
+		delegate.reserve(n);
+	}
+
+	/// Complete migration, then rehash to the fewest buckets holding all elements within max_load_factor().
+	void shrink_to_fit()
+	{
+		completeMigration();
+		delegate.rehash(0);
+	}
+
+	/// Whether elements remain to be migrated from the draining table.
+	bool migrating() const noexcept
+	{
+		return !draining.empty();
+	}
+
+	/// Forwarded to std::unordered_map<Key, T>::hash_function() const.
+	hasher hash_function() const
+	{
+		return delegate.hash_function();
+	}
+
+	/// Forwarded to std::unordered_map<Key, T>::key_eq() const.
+	key_equal key_eq() const
+	{
+		return delegate.key_eq();
+	}
+
+	/// Forwarded to std::unordered_map<Key, T>::get_allocator() const noexcept.
+	allocator_type get_allocator() const noexcept
+	{
+		return delegate.get_allocator();
+	}
+
+private:
+	/// Forward iterator over the elements of table, continuing with those of following, unless null.
+	template<bool isConst>
+	class Iterator
+	{
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef typename IncrementalUnorderedMap::value_type value_type;
+		typedef typename IncrementalUnorderedMap::difference_type difference_type;
+		typedef typename std::conditional<isConst, const value_type*, value_type*>::type pointer;
+		typedef typename std::conditional<isConst, const value_type&, value_type&>::type reference;
+
+		Iterator() noexcept : table(nullptr), position(), following(nullptr)
+		{
+		}
+
+		/// Implicit conversion from iterator to const_iterator.
+		template<bool otherIsConst, typename = typename std::enable_if<isConst && !otherIsConst>::type>
+		Iterator(const Iterator<otherIsConst>& other) noexcept :
+			table(other.table),
+			position(other.position),
+			following(other.following)
+		{
+		}
+
+		reference operator*() const
+		{
+			return *position;
+		}
+
+		pointer operator->() const
+		{
+			return std::addressof(*position);
+		}
+
+		Iterator& operator++()
+		{
+			++position;
+			skipEnd();
+			return *this;
+		}
+
+		Iterator operator++(int)
+		{
+			Iterator result(*this);
+			++*this;
+			return result;
+		}
+
+		friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return lhs.table == rhs.table && lhs.position == rhs.position;
+		}
+
+		friend bool operator!=(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return !(lhs == rhs);
+		}
+
+	private:
+		typedef typename std::conditional<isConst, const DelegateType, DelegateType>::type Table;
+		typedef typename std::
+			conditional<isConst, typename DelegateType::const_iterator, typename DelegateType::iterator>::type Position;
+
+		Iterator(Table* table, Position position, Table* following) noexcept :
+			table(table),
+			position(position),
+			following(following)
+		{
+			skipEnd();
+		}
+
+		/// Continue with the following table at the end of this one.
+		void skipEnd() noexcept
+		{
+			if (following != nullptr && position == table->end()) {
+				table = following;
+				position = following->begin();
+				following = nullptr;
+			}
+		}
+
+		Table* table;
+		Position position;
+		Table* following;
+
+		friend class Iterator<!isConst>;
+		friend class IncrementalUnorderedMap;
+	};
+
+	/// Migrate, or set the table receiving insertions aside if one more element would exceed its maximum load factor.
+	void prepareInsert()
+	{
+		if (!draining.empty()) {
+			migrate(migrationStep);
+		} else if (static_cast<double>(delegate.size() + 1) > capacity()) {
+			DelegateType grown(0, delegate.hash_function(), delegate.key_eq(), delegate.get_allocator());
+			grown.max_load_factor(delegate.max_load_factor());
+			grown.reserve(2 * (delegate.size() + 1));
+			draining.swap(delegate);
+			delegate.swap(grown);
+		}
+	}
+
+	/// Move up to n elements from the draining table into the table receiving insertions, releasing the buckets of
+	/// the draining table once it is empty.
+	void migrate(size_type n)
+	{
+		for (; n > 0 && !draining.empty(); --n) {
+#if defined(__cpp_lib_node_extract)
+			auto node = draining.extract(draining.begin());
+			try {
+				delegate.insert(std::move(node));
+			} catch (...) {
+				if (!node.empty()) {
+					draining.insert(std::move(node));
+				}
+				throw;
+			}
+#else
+			auto position = draining.begin();
+			delegate.emplace(position->first, std::move(position->second));
+			draining.erase(position);
+#endif
+		}
+		if (draining.empty()) {
+			releaseDraining();
+		}
+	}
+
+	/// Move all remaining elements from the draining table.
+	void completeMigration()
+	{
+		if (!draining.empty()) {
+			if (static_cast<double>(size()) > capacity()) {
+				delegate.reserve(size());
+			}
+			migrate(draining.size());
+		}
+	}
+
+	/// Number of elements the table receiving insertions holds within its maximum load factor.
+	double capacity() const noexcept
+	{
+		return static_cast<double>(delegate.bucket_count()) * delegate.max_load_factor();
+	}
+
+	/// Replace the draining table by an empty one without buckets.
+	void releaseDraining()
+	{
+		DelegateType(0, delegate.hash_function(), delegate.key_eq(), delegate.get_allocator()).swap(draining);
+	}
+
+	DelegateType delegate;
+	DelegateType draining;
+
+	friend bool operator== <Key, T, Hash, Predicate, Allocator>(
+		const IncrementalUnorderedMap& lhs, const IncrementalUnorderedMap& rhs);
+	friend bool operator!= <Key, T, Hash, Predicate, Allocator>(
+		const IncrementalUnorderedMap& lhs, const IncrementalUnorderedMap& rhs);
+};
+
+template<typename Key, typename T, typename Hash, typename Predicate, typename Allocator>
+constexpr typename IncrementalUnorderedMap<Key, T, Hash, Predicate, Allocator>::size_type
+	IncrementalUnorderedMap<Key, T, Hash, Predicate, Allocator>::migrationStep;
+
+/// Equal if both hold the same number of elements, and each element of lhs has an equal counterpart in rhs,
+/// regardless of which table holds it.
+template<typename Key, typename T, typename Hash, typename Predicate, typename Allocator>
+bool operator==(
+	const IncrementalUnorderedMap<Key, T, Hash, Predicate, Allocator>& lhs,
+	const IncrementalUnorderedMap<Key, T, Hash, Predicate, Allocator>& rhs)
+{
+	if (lhs.size() != rhs.size()) {
+		return false;
+	}
+	for (const auto& element : lhs) {
+		auto position = rhs.find(element.first);
+		if (position == rhs.end() || !(position->second == element.second)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/// Negation of operator==(const IncrementalUnorderedMap<Key, T, Hash, Predicate, Allocator>& lhs, const
+/// IncrementalUnorderedMap<Key, T, Hash, Predicate, Allocator>& rhs).
+template<typename Key, typename T, typename Hash, typename Predicate, typename Allocator>
+bool operator!=(
+	const IncrementalUnorderedMap<Key, T, Hash, Predicate, Allocator>& lhs,
+	const IncrementalUnorderedMap<Key, T, Hash, Predicate, Allocator>& rhs)
+{
+	return !(lhs == rhs);
+}
+
+/// Swap elements and migration state of lhs and rhs.
+template<typename Key, typename T, typename Hash, typename Predicate, typename Allocator>
+void swap(
+	IncrementalUnorderedMap<Key, T, Hash, Predicate, Allocator>& lhs,
+	IncrementalUnorderedMap<Key, T, Hash, Predicate, Allocator>& rhs)
+{
+	lhs.swap(rhs);
+}
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_IncrementalUnorderedMap_INCLUDED
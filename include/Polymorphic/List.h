@@ -8,7 +8,11 @@
 #ifndef Polymorphic_List_INCLUDED
 #define Polymorphic_List_INCLUDED
 
+#include "Polymorphic/ExecutionFwd.h"
+#include "Polymorphic/SerializationFwd.h"
+#include <functional>
 #include <list>
+#include <vector>
 
 namespace Polymorphic {
 
@@ -420,6 +424,25 @@ public:
 		return delegate.erase(first, last);
 	}
 
+	/// Write elements to sink as chunked stream, encoding each by codec and writing chunks of at least chunkBytes.
+	/// Memory overhead is bounded by the chunk size. Throws serialization::Error if writing fails.
+	template<typename Codec = serialization::Codec<value_type>>
+	void serialize(
+		std::ostream& sink, const Codec& codec = Codec(), std::size_t chunkBytes = serialization::defaultChunkBytes) const
+	{
+		serialization::write_chunks(sink, delegate.begin(), delegate.end(), delegate.size(), codec, chunkBytes);
+	}
+
+	/// Replace elements by those of the chunked stream read from source, decoding each by codec. Throws
+	/// serialization::Error if the stream is truncated, corrupt or incompatible, leaving this container unchanged.
+	template<typename Codec = serialization::Codec<value_type>>
+	void deserialize(std::istream& source, const Codec& codec = Codec())
+	{
+		DelegateType loaded(delegate.get_allocator());
+		serialization::read_chunks(source, codec, [](std::size_t) {}, serialization::BackEmplacer<DelegateType>(loaded));
+		delegate.swap(loaded);
+	}
+
 	/// Forwarded to std::list<T>::swap(std::list<bool>& other).
 	void swap(List& other)
 	{
@@ -545,6 +568,37 @@ public:
 		delegate.sort(compare);
 	}
 
+	/// Stable sort in ascending order per execution policy, see sort(const ExecutionPolicy& policy, Compare compare).
+	void sort(const execution::sequenced_policy& policy)
+	{
+		sort(policy, std::less<value_type>());
+	}
+
+	/// Stable sort in ascending order per execution policy, see sort(const ExecutionPolicy& policy, Compare compare).
+	void sort(const execution::parallel_policy& policy)
+	{
+		sort(policy, std::less<value_type>());
+	}
+
+	/// Stable sort with respect to compare, gathering iterators into a contiguous buffer, sorting the buffer per
+	/// execution policy, and relinking nodes in buffer order. Elements are neither copied nor moved. Parallel policies
+	/// call compare concurrently, so it must be safe to do so.
+	template<typename ExecutionPolicy, typename Compare>
+	void sort(const ExecutionPolicy& policy, Compare compare)
+	{
+		std::vector<iterator> nodes;
+		nodes.reserve(delegate.size());
+		for (auto node = delegate.begin(); node != delegate.end(); ++node) {
+			nodes.push_back(node);
+		}
+		execution::stable_sort(policy, nodes.begin(), nodes.end(), [&compare](const iterator& lhs, const iterator& rhs) {
+			return compare(*lhs, *rhs);
+		});
+		for (auto& node : nodes) {
+			delegate.splice(delegate.end(), delegate, node);
+		}
+	}
+
 	/// Forwarded to std::list<T>::reverse() noexcept.
 	void reverse() noexcept
 	{
@@ -622,4 +676,16 @@ void swap(const List<T, Allocator>& lhs, const List<T, Allocator>& rhs)
 
 } // namespace Polymorphic
 
+#ifdef POLYMORPHIC_EXTERN_TEMPLATES
+#include <string>
+
+namespace Polymorphic {
+
+// Explicitly instantiated by the Polymorphic::Instantiations library.
+extern template class List<int>;
+extern template class List<std::string>;
+
+} // namespace Polymorphic
+#endif // POLYMORPHIC_EXTERN_TEMPLATES
+
 #endif // Polymorphic_List_INCLUDED
@@ -0,0 +1,479 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_LruCache_INCLUDED
+#define Polymorphic_LruCache_INCLUDED
+
+#include "Polymorphic/List.h"
+#include "Polymorphic/UnorderedMap.h"
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Polymorphic {
+
+/// Hit, miss and eviction counters of an LruCache.
+struct LruCacheStatistics
+{
+	LruCacheStatistics() : hits(0), misses(0), evictions(0)
+	{
+	}
+
+	LruCacheStatistics& operator+=(const LruCacheStatistics& other)
+	{
+		hits += other.hits;
+		misses += other.misses;
+		evictions += other.evictions;
+		return *this;
+	}
+
+	std::size_t hits;
+	std::size_t misses;
+	std::size_t evictions;
+};
+
+/// Least recently used cache composing a Polymorphic::List<std::pair<const Key, T>> in recency order with a
+/// Polymorphic::UnorderedMap<Key, List::iterator> index. Lookup, insertion, promotion and eviction are O(1).
+///
+/// Capacity is measured in weight units. Each entry weighs 1 by default, making capacity an entry count. Override
+/// weigh() for byte based eviction, and evicted() for being notified about entries about to be dropped.
+/// The most recently inserted entry is never evicted, even if its weight alone exceeds capacity.
+template<typename Key, typename T, typename Hash = std::hash<Key>, typename Predicate = std::equal_to<Key>>
+class LruCache
+{
+public:
+	typedef Key key_type;
+	typedef T mapped_type;
+	typedef std::pair<const key_type, mapped_type> value_type;
+	typedef List<value_type> ListType;
+	typedef UnorderedMap<key_type, typename ListType::iterator, Hash, Predicate> IndexType;
+	typedef typename ListType::iterator iterator;
+	typedef typename ListType::const_iterator const_iterator;
+	typedef typename ListType::size_type size_type;
+
+	/// Construct empty cache holding entries up to a total weight of capacity.
+	explicit LruCache(size_type capacity) : maxWeight(capacity), totalWeight(0)
+	{
+	}
+
+	/// Copy entries in recency order, with capacity and statistics. The index is rebuilt to refer to the copied entries.
+	LruCache(const LruCache& other) :
+		entries(other.entries),
+		index(),
+		maxWeight(other.maxWeight),
+		totalWeight(other.totalWeight),
+		counters(other.counters)
+	{
+		reindex();
+	}
+
+	/// Move entries, with capacity and statistics. Leaves other empty.
+	LruCache(LruCache&& other) :
+		entries(std::move(other.entries)),
+		index(std::move(other.index)),
+		maxWeight(other.maxWeight),
+		totalWeight(other.totalWeight),
+		counters(other.counters)
+	{
+		other.clear();
+	}
+
+	/// Virtual destructor permitting derived classes to be deleted safely via an LruCache pointer.
+	virtual ~LruCache()
+	{
+	}
+
+	/// Replace entries, capacity and statistics by copies of other's. The index is rebuilt to refer to the copied
+	/// entries.
+	LruCache& operator=(const LruCache& other)
+	{
+		if (this != &other) {
+			// Copy into a temporary, as element assignment is unavailable for const keys.
+			ListType copied(other.entries);
+			index.clear();
+			entries = std::move(copied);
+			maxWeight = other.maxWeight;
+			totalWeight = other.totalWeight;
+			counters = other.counters;
+			reindex();
+		}
+		return *this;
+	}
+
+	/// Replace entries, capacity and statistics by other's. Leaves other empty.
+	LruCache& operator=(LruCache&& other)
+	{
+		if (this != &other) {
+			entries = std::move(other.entries);
+			index = std::move(other.index);
+			maxWeight = other.maxWeight;
+			totalWeight = other.totalWeight;
+			counters = other.counters;
+			other.clear();
+		}
+		return *this;
+	}
+
+	/// Iterator to the most recently used entry. Iteration does not affect recency.
+	iterator begin() noexcept
+	{
+		return entries.begin();
+	}
+
+	/// Iterator to the most recently used entry. Iteration does not affect recency.
+	const_iterator begin() const noexcept
+	{
+		return entries.begin();
+	}
+
+	/// Iterator past the least recently used entry.
+	iterator end() noexcept
+	{
+		return entries.end();
+	}
+
+	/// Iterator past the least recently used entry.
+	const_iterator end() const noexcept
+	{
+		return entries.end();
+	}
+
+	/// True if there are no entries.
+	bool empty() const noexcept
+	{
+		return entries.empty();
+	}
+
+	/// Number of entries.
+	size_type size() const noexcept
+	{
+		return index.size();
+	}
+
+	/// Maximum total weight of entries.
+	size_type capacity() const noexcept
+	{
+		return maxWeight;
+	}
+
+	/// Change maximum total weight, evicting least recently used entries as required.
+	void set_capacity(size_type capacity)
+	{
+		maxWeight = capacity;
+		evict(0);
+	}
+
+	/// Total weight of entries.
+	size_type weight() const noexcept
+	{
+		return totalWeight;
+	}
+
+	/// Look up entry and mark it most recently used, counting a hit. Returns end() and counts a miss if not found.
+	iterator find(const key_type& key)
+	{
+		auto found = index.find(key);
+		if (found == index.end()) {
+			++counters.misses;
+			return entries.end();
+		}
+		++counters.hits;
+		entries.splice(entries.begin(), entries, found->second);
+		return found->second;
+	}
+
+	/// Look up entry without affecting recency or statistics. Returns end() if not found.
+	const_iterator peek(const key_type& key) const
+	{
+		auto found = index.find(key);
+		return found == index.end() ? entries.end() : const_iterator(found->second);
+	}
+
+	/// True if an entry with key exists. Does not affect recency or statistics.
+	bool contains(const key_type& key) const
+	{
+		return index.count(key) != 0;
+	}
+
+	/// Insert value as most recently used entry, unless its key exists already. In that case the existing entry
+	/// is marked most recently used and left unchanged.
+	std::pair<iterator, bool> insert(const value_type& value)
+	{
+		return emplace(value.first, value.second);
+	}
+
+	/// Construct value as most recently used entry from key and args, unless key exists already. In that case the
+	/// existing entry is marked most recently used and left unchanged.
+	template<typename... Args>
+	std::pair<iterator, bool> emplace(const key_type& key, Args&&... args)
+	{
+		auto found = index.find(key);
+		if (found != index.end()) {
+			entries.splice(entries.begin(), entries, found->second);
+			return std::make_pair(found->second, false);
+		}
+		entries.emplace_front(
+			std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+		try {
+			index.emplace(key, entries.begin());
+		} catch (...) {
+			entries.pop_front();
+			throw;
+		}
+		totalWeight += weigh(entries.front());
+		evict(1);
+		return std::make_pair(entries.begin(), true);
+	}
+
+	/// Insert value as most recently used entry, or assign it to the existing entry with key.
+	template<typename M>
+	std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& value)
+	{
+		auto found = index.find(key);
+		if (found == index.end()) {
+			return emplace(key, std::forward<M>(value));
+		}
+		entries.splice(entries.begin(), entries, found->second);
+		totalWeight -= weigh(entries.front());
+		entries.front().second = std::forward<M>(value);
+		totalWeight += weigh(entries.front());
+		evict(1);
+		return std::make_pair(entries.begin(), false);
+	}
+
+	/// Erase entry at position without calling evicted().
+	iterator erase(const_iterator position)
+	{
+		totalWeight -= weigh(*position);
+		index.erase(position->first);
+		return entries.erase(position);
+	}
+
+	/// Erase entry with key, if any, without calling evicted(). Returns number of erased entries.
+	size_type erase(const key_type& key)
+	{
+		auto found = index.find(key);
+		if (found == index.end()) {
+			return 0;
+		}
+		auto position = found->second;
+		totalWeight -= weigh(*position);
+		index.erase(found);
+		entries.erase(position);
+		return 1;
+	}
+
+	/// Erase all entries without calling evicted(). Statistics are kept.
+	void clear() noexcept
+	{
+		index.clear();
+		entries.clear();
+		totalWeight = 0;
+	}
+
+	/// Hit, miss and eviction counters accumulated since construction or the last reset_statistics().
+	const LruCacheStatistics& statistics() const noexcept
+	{
+		return counters;
+	}
+
+	/// Reset hit, miss and eviction counters.
+	void reset_statistics() noexcept
+	{
+		counters = LruCacheStatistics();
+	}
+
+protected:
+	/// Weight of an entry counted against capacity. Returns 1, override for byte based eviction.
+	/// Must return the same result for an entry as long as its mapped value is unchanged.
+	virtual size_type weigh(const value_type&) const
+	{
+		return 1;
+	}
+
+	/// Called for each entry immediately before it is evicted due to exceeding capacity. Does nothing,
+	/// override for write back or cleanup. Must not modify the cache.
+	virtual void evicted(value_type&)
+	{
+	}
+
+private:
+	ListType entries;
+	IndexType index;
+	size_type maxWeight;
+	size_type totalWeight;
+	LruCacheStatistics counters;
+
+	/// Rebuild index from entries, after these were copied.
+	void reindex()
+	{
+		try {
+			index.reserve(entries.size());
+			for (auto position = entries.begin(); position != entries.end(); ++position) {
+				index.emplace(position->first, position);
+			}
+		} catch (...) {
+			clear();
+			throw;
+		}
+	}
+
+	/// Evict least recently used entries while above capacity, keeping at least the given number of most recent ones.
+	void evict(size_type keep)
+	{
+		while (totalWeight > maxWeight && index.size() > keep) {
+			value_type& victim = entries.back();
+			totalWeight -= weigh(victim);
+			evicted(victim);
+			index.erase(victim.first);
+			entries.pop_back();
+			++counters.evictions;
+		}
+	}
+};
+
+/// Thread safe LRU cache distributing keys across independently locked LruCache shards.
+///
+/// Entries are returned by copy, as references into a shard would outlive its lock. Recency and capacity are
+/// maintained per shard, so eviction order is least recently used within a shard only. Customize eviction by
+/// passing a class derived from LruCache, constructible from a capacity, as CacheType.
+template<
+	typename Key,
+	typename T,
+	typename Hash = std::hash<Key>,
+	typename Predicate = std::equal_to<Key>,
+	typename CacheType = LruCache<Key, T, Hash, Predicate>>
+class ShardedLruCache
+{
+public:
+	typedef Key key_type;
+	typedef T mapped_type;
+	typedef typename CacheType::size_type size_type;
+
+	/// Construct cache of shardCount shards, each holding entries up to a total weight of capacity / shardCount.
+	ShardedLruCache(size_type capacity, size_type shardCount, const Hash& hash = Hash()) : shards(), hash(hash)
+	{
+		if (shardCount == 0) {
+			shardCount = 1;
+		}
+		shards.reserve(shardCount);
+		for (size_type i = 0; i < shardCount; ++i) {
+			shards.emplace_back(new Shard(capacity / shardCount));
+		}
+	}
+
+	/// Virtual destructor permitting derived classes to be deleted safely via a ShardedLruCache pointer.
+	virtual ~ShardedLruCache()
+	{
+	}
+
+	/// Copy mapped value of key into result and mark it most recently used. Returns false on a miss.
+	bool get(const key_type& key, mapped_type& result)
+	{
+		Shard& shard = shardOf(key);
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		auto found = shard.cache.find(key);
+		if (found == shard.cache.end()) {
+			return false;
+		}
+		result = found->second;
+		return true;
+	}
+
+	/// Insert or assign mapped value of key, marking it most recently used.
+	template<typename M>
+	void put(const key_type& key, M&& value)
+	{
+		Shard& shard = shardOf(key);
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		shard.cache.insert_or_assign(key, std::forward<M>(value));
+	}
+
+	/// Erase entry with key, if any. Returns number of erased entries.
+	size_type erase(const key_type& key)
+	{
+		Shard& shard = shardOf(key);
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		return shard.cache.erase(key);
+	}
+
+	/// Erase all entries.
+	void clear()
+	{
+		for (auto& shard : shards) {
+			std::lock_guard<std::mutex> lock(shard->mutex);
+			shard->cache.clear();
+		}
+	}
+
+	/// Number of entries, summed over shards locked one at a time.
+	size_type size() const
+	{
+		size_type result = 0;
+		for (auto& shard : shards) {
+			std::lock_guard<std::mutex> lock(shard->mutex);
+			result += shard->cache.size();
+		}
+		return result;
+	}
+
+	/// Number of shards.
+	size_type shard_count() const noexcept
+	{
+		return shards.size();
+	}
+
+	/// Counters summed over shards locked one at a time.
+	LruCacheStatistics statistics() const
+	{
+		LruCacheStatistics result;
+		for (auto& shard : shards) {
+			std::lock_guard<std::mutex> lock(shard->mutex);
+			result += shard->cache.statistics();
+		}
+		return result;
+	}
+
+	/// Reset counters of all shards.
+	void reset_statistics()
+	{
+		for (auto& shard : shards) {
+			std::lock_guard<std::mutex> lock(shard->mutex);
+			shard->cache.reset_statistics();
+		}
+	}
+
+private:
+	struct Shard
+	{
+		explicit Shard(size_type capacity) : cache(capacity)
+		{
+		}
+
+		CacheType cache;
+		mutable std::mutex mutex;
+	};
+
+	std::vector<std::unique_ptr<Shard>> shards;
+	Hash hash;
+
+	Shard& shardOf(const key_type& key)
+	{
+		std::size_t h = hash(key);
+		// Mix bits, so shard selection does not correlate with bucket selection inside the shard.
+		h ^= h >> 16;
+		h *= 0x45d9f3bU;
+		h ^= h >> 16;
+		return *shards[h % shards.size()];
+	}
+};
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_LruCache_INCLUDED
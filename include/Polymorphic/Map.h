@@ -8,6 +8,7 @@
 #ifndef Polymorphic_Map_INCLUDED
 #define Polymorphic_Map_INCLUDED
 
+#include "Polymorphic/SerializationFwd.h"
 #include <map>
 
 namespace Polymorphic {
@@ -364,6 +365,26 @@ public:
 		return delegate.erase(first, last);
 	}
 
+	/// Write elements to sink as chunked stream, encoding each by codec and writing chunks of at least chunkBytes.
+	/// Memory overhead is bounded by the chunk size. Throws serialization::Error if writing fails.
+	template<typename Codec = serialization::Codec<value_type>>
+	void serialize(
+		std::ostream& sink, const Codec& codec = Codec(), std::size_t chunkBytes = serialization::defaultChunkBytes) const
+	{
+		serialization::write_chunks(sink, delegate.begin(), delegate.end(), delegate.size(), codec, chunkBytes);
+	}
+
+	/// Replace elements by those of the chunked stream read from source, decoding each by codec and inserting it with
+	/// the end as hint, constant time for streams written by serialize(). Throws serialization::Error if the stream is
+	/// truncated, corrupt or incompatible, leaving this container unchanged.
+	template<typename Codec = serialization::Codec<value_type>>
+	void deserialize(std::istream& source, const Codec& codec = Codec())
+	{
+		DelegateType loaded(delegate.key_comp(), delegate.get_allocator());
+		serialization::read_chunks(source, codec, [](std::size_t) {}, serialization::HintEmplacer<DelegateType>(loaded));
+		delegate.swap(loaded);
+	}
+
 	/// Forwarded to std::map<Key, T>::swap(std::map<bool>& other).
 	void swap(Map& other)
 	{
@@ -529,4 +550,17 @@ void swap(const Map<Key, T, Compare, Allocator>& lhs, const Map<Key, T, Compare,
 
 } // namespace Polymorphic
 
+#ifdef POLYMORPHIC_EXTERN_TEMPLATES
+#include <string>
+
+namespace Polymorphic {
+
+// Explicitly instantiated by the Polymorphic::Instantiations library.
+extern template class Map<int, int>;
+extern template class Map<std::string, int>;
+extern template class Map<std::string, std::string>;
+
+} // namespace Polymorphic
+#endif // POLYMORPHIC_EXTERN_TEMPLATES
+
 #endif // Polymorphic_Map_INCLUDED
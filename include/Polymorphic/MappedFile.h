@@ -0,0 +1,214 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_MappedFile_INCLUDED
+#define Polymorphic_MappedFile_INCLUDED
+
+#include <cerrno>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Polymorphic {
+
+/// Memory mapping of an entire file, backing the mapped containers. POSIX only.
+class MappedFile
+{
+public:
+	/// Access to the mapping.
+	enum class Access
+	{
+		/// Map existing file read only, shared with other processes. Writing to the mapping faults.
+		read_only,
+		/// Map existing file privately. Writes are visible to this mapping only, copying the pages written to, and
+		/// never reach the file. Pages not written to are shared with other processes.
+		copy_on_write,
+		/// Map existing file, or create an empty one, for reading and writing, shared with other processes. Allows
+		/// resizing the file.
+		read_write
+	};
+
+	/// Map file at path read only. Throws std::system_error if it cannot be opened or mapped.
+	explicit MappedFile(const std::string& path) : MappedFile(path, Access::read_only)
+	{
+	}
+
+	/// Map file at path with access. Throws std::system_error if it cannot be opened or mapped.
+	MappedFile(const std::string& path, Access access) : access(access), descriptor(-1), base(nullptr), bytes(0)
+	{
+		descriptor = ::open(path.c_str(), access == Access::read_write ? O_RDWR | O_CREAT : O_RDONLY, 0666);
+		if (descriptor < 0) {
+			throw std::system_error(errno, std::generic_category(), "Polymorphic::MappedFile: open " + path);
+		}
+		try {
+			struct stat status;
+			if (::fstat(descriptor, &status) != 0) {
+				throw std::system_error(errno, std::generic_category(), "Polymorphic::MappedFile: fstat " + path);
+			}
+			map(static_cast<std::size_t>(status.st_size));
+		} catch (...) {
+			release();
+			throw;
+		}
+		if (access != Access::read_write) {
+			// The mapping keeps the file referenced.
+			::close(descriptor);
+			descriptor = -1;
+		}
+	}
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	/// Move constructor, taking over the mapping.
+	MappedFile(MappedFile&& other) noexcept :
+		access(other.access), descriptor(other.descriptor), base(other.base), bytes(other.bytes)
+	{
+		other.descriptor = -1;
+		other.base = nullptr;
+		other.bytes = 0;
+	}
+
+	/// Move assignment, releasing the current mapping and taking over the other's.
+	MappedFile& operator=(MappedFile&& other) noexcept
+	{
+		if (this != &other) {
+			release();
+			std::swap(access, other.access);
+			std::swap(descriptor, other.descriptor);
+			std::swap(base, other.base);
+			std::swap(bytes, other.bytes);
+		}
+		return *this;
+	}
+
+	/// Unmap file.
+	~MappedFile()
+	{
+		release();
+	}
+
+	/// Access to the mapping.
+	Access mode() const noexcept
+	{
+		return access;
+	}
+
+	/// Start of the mapping, or null if the file is empty. Must not be written to if mapped read only.
+	void* data() noexcept
+	{
+		return base;
+	}
+
+	/// Start of the mapping, or null if the file is empty.
+	const void* data() const noexcept
+	{
+		return base;
+	}
+
+	/// Size of the file in bytes.
+	std::size_t size() const noexcept
+	{
+		return bytes;
+	}
+
+	/// Change size of a file mapped for reading and writing to n bytes, and remap it, invalidating pointers into the
+	/// mapping. Throws std::system_error on failure, and std::logic_error if not mapped for reading and writing.
+	void resize(std::size_t n)
+	{
+		if (access != Access::read_write) {
+			throw std::logic_error("Polymorphic::MappedFile: not mapped for writing");
+		}
+		if (n == bytes) {
+			return;
+		}
+		void* old = base;
+		std::size_t oldBytes = bytes;
+		// Keep the mapping within the file, so that it never covers bytes past its end.
+		if (n > oldBytes) {
+			truncate(n);
+			map(n);
+			unmap(old, oldBytes);
+		} else {
+			map(n);
+			unmap(old, oldBytes);
+			truncate(n);
+		}
+	}
+
+	/// Hint expected access pattern to the kernel, e.g. POSIX_MADV_RANDOM for lookups. Returns false if rejected.
+	bool advise(int advice) const noexcept
+	{
+		return base == nullptr || ::posix_madvise(base, bytes, advice) == 0;
+	}
+
+	/// Flush a mapping for reading and writing to the file, blocking until written. Throws std::system_error on
+	/// failure.
+	void sync()
+	{
+		if (access == Access::read_write && base != nullptr && ::msync(base, bytes, MS_SYNC) != 0) {
+			throw std::system_error(errno, std::generic_category(), "Polymorphic::MappedFile: msync");
+		}
+	}
+
+private:
+	Access access;
+	int descriptor;
+	void* base;
+	std::size_t bytes;
+
+	/// Map the first n bytes of the file, leaving a previous mapping to the caller. Maps nothing if n is 0.
+	void map(std::size_t n)
+	{
+		void* result = nullptr;
+		if (n != 0) {
+			int protection = access == Access::read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+			int flags = access == Access::copy_on_write ? MAP_PRIVATE : MAP_SHARED;
+			result = ::mmap(nullptr, n, protection, flags, descriptor, 0);
+			if (result == MAP_FAILED) {
+				throw std::system_error(errno, std::generic_category(), "Polymorphic::MappedFile: mmap");
+			}
+		}
+		base = result;
+		bytes = n;
+	}
+
+	void truncate(std::size_t n)
+	{
+		if (::ftruncate(descriptor, static_cast<off_t>(n)) != 0) {
+			throw std::system_error(errno, std::generic_category(), "Polymorphic::MappedFile: ftruncate");
+		}
+	}
+
+	static void unmap(void* mapping, std::size_t n) noexcept
+	{
+		if (mapping != nullptr) {
+			::munmap(mapping, n);
+		}
+	}
+
+	void release() noexcept
+	{
+		unmap(base, bytes);
+		base = nullptr;
+		bytes = 0;
+		if (descriptor >= 0) {
+			::close(descriptor);
+			descriptor = -1;
+		}
+	}
+};
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_MappedFile_INCLUDED
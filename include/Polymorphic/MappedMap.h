@@ -0,0 +1,52 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_MappedMap_INCLUDED
+#define Polymorphic_MappedMap_INCLUDED
+
+#include "Polymorphic/MappedSortedRun.h"
+#include <stdexcept>
+
+namespace Polymorphic {
+
+/// Read only ordered map view over a sorted run image, with the lookup and iteration interface of Polymorphic::Map and
+/// Polymorphic::Multimap. Key and T must be trivially copyable.
+///
+/// Write images from the contents of a Map or Multimap using build(), and map them with the path constructor.
+template<typename Key, typename T, typename Compare = std::less<Key>>
+class MappedMap : public MappedSortedRun<Key, std::pair<const Key, T>, Compare>
+{
+public:
+	typedef MappedSortedRun<Key, std::pair<const Key, T>, Compare> BaseType;
+	typedef T mapped_type;
+	typedef typename BaseType::key_type key_type;
+
+	/// Map image file at path. Throws std::system_error if it cannot be mapped, and serialization::Error if it does not
+	/// hold a compatible image. POSIX only.
+	explicit MappedMap(const std::string& path, const Compare& compare = Compare()) : BaseType(path, compare)
+	{
+	}
+
+	/// View image in [buffer, buffer + size), see MappedSortedRun.
+	MappedMap(const void* buffer, std::size_t size, const Compare& compare = Compare()) : BaseType(buffer, size, compare)
+	{
+	}
+
+	/// Mapped value of the first entry with key. Throws std::out_of_range if not found.
+	const mapped_type& at(const key_type& key) const
+	{
+		auto found = this->find(key);
+		if (found == this->end()) {
+			throw std::out_of_range("Polymorphic::MappedMap::at");
+		}
+		return found->second;
+	}
+};
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_MappedMap_INCLUDED
@@ -0,0 +1,46 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_MappedSet_INCLUDED
+#define Polymorphic_MappedSet_INCLUDED
+
+#include "Polymorphic/MappedSortedRun.h"
+
+namespace Polymorphic {
+
+/// Read only ordered set view over a sorted run image, with the lookup and iteration interface of Polymorphic::Set and
+/// Polymorphic::Multiset. Key must be trivially copyable.
+///
+/// Write images from the contents of a Set or Multiset using build(), and map them with the path constructor.
+template<typename Key, typename Compare = std::less<Key>>
+class MappedSet : public MappedSortedRun<Key, Key, Compare>
+{
+public:
+	typedef MappedSortedRun<Key, Key, Compare> BaseType;
+	typedef Compare value_compare;
+
+	/// Map image file at path. Throws std::system_error if it cannot be mapped, and serialization::Error if it does not
+	/// hold a compatible image. POSIX only.
+	explicit MappedSet(const std::string& path, const Compare& compare = Compare()) : BaseType(path, compare)
+	{
+	}
+
+	/// View image in [buffer, buffer + size), see MappedSortedRun.
+	MappedSet(const void* buffer, std::size_t size, const Compare& compare = Compare()) : BaseType(buffer, size, compare)
+	{
+	}
+
+	/// Value comparison function object, same as key_comp().
+	value_compare value_comp() const
+	{
+		return this->key_comp();
+	}
+};
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_MappedSet_INCLUDED
@@ -0,0 +1,376 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_MappedSortedRun_INCLUDED
+#define Polymorphic_MappedSortedRun_INCLUDED
+
+#include "Polymorphic/MappedFile.h"
+#include "Polymorphic/Serialization.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Polymorphic {
+
+/// Read only ordered view over a relocatable sorted run image, common base of MappedMap and MappedSet.
+///
+/// The image holds the values in key order for iteration, followed by a copy of their keys in Eytzinger order, the
+/// breadth first layout of an implicit binary search tree, and the sorted position of each. Searches descend the
+/// tree without data dependent branches, touching consecutive cache lines near the root. Equal keys are permitted,
+/// keeping their order when building, so the same image format serves maps and multimaps.
+template<typename Key, typename Value, typename Compare>
+class MappedSortedRun
+{
+public:
+	static_assert(
+		std::is_trivially_copyable<Key>::value && std::is_trivially_copyable<Value>::value,
+		"MappedSortedRun requires trivially copyable keys and values");
+
+	typedef Key key_type;
+	typedef Value value_type;
+	typedef Compare key_compare;
+	typedef const value_type& reference;
+	typedef const value_type& const_reference;
+	typedef const value_type* pointer;
+	typedef const value_type* const_pointer;
+	typedef const value_type* iterator;
+	typedef const value_type* const_iterator;
+	typedef std::reverse_iterator<const_iterator> reverse_iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+	typedef std::ptrdiff_t difference_type;
+	typedef std::size_t size_type;
+
+	/// Write image of the values in [first, last) to sink, stably sorted by key. Throws serialization::Error if writing
+	/// fails.
+	template<typename InputIterator>
+	static void build(std::ostream& sink, InputIterator first, InputIterator last, const key_compare& compare = key_compare())
+	{
+		// Zero filled storage, so padding inside values is written deterministically.
+		std::vector<unsigned char> staging;
+		for (; first != last; ++first) {
+			staging.resize(staging.size() + sizeof(value_type), 0);
+			::new (staging.data() + staging.size() - sizeof(value_type)) value_type(*first);
+		}
+		std::size_t n = staging.size() / sizeof(value_type);
+		const value_type* unsorted = reinterpret_cast<const value_type*>(staging.data());
+		std::vector<std::size_t> order(n);
+		for (std::size_t i = 0; i < n; ++i) {
+			order[i] = i;
+		}
+		std::stable_sort(order.begin(), order.end(), [unsorted, &compare](std::size_t lhs, std::size_t rhs) {
+			return compare(keyOf(unsorted[lhs]), keyOf(unsorted[rhs]));
+		});
+
+		Header header;
+		std::memcpy(header.magic, "PLMS", sizeof(header.magic));
+		header.version = serialization::version;
+		header.keySize = sizeof(key_type);
+		header.valueSize = sizeof(value_type);
+		header.byteOrderMark = serialization::byteOrderMark;
+		header.reserved = 0;
+		header.count = n;
+		layout(header);
+		serialization::write(sink, &header, sizeof(header));
+
+		// Everything past the header, addressed by image offset minus header size.
+		std::vector<unsigned char> image(header.ranksOffset + (n + 1) * sizeof(std::uint64_t) - sizeof(header), 0);
+		unsigned char* values = image.data() + header.valuesOffset - sizeof(header);
+		unsigned char* keys = image.data() + header.keysOffset - sizeof(header);
+		std::uint64_t* ranks = reinterpret_cast<std::uint64_t*>(image.data() + header.ranksOffset - sizeof(header));
+		for (std::size_t i = 0; i < n; ++i) {
+			std::memcpy(values + i * sizeof(value_type), unsorted + order[i], sizeof(value_type));
+		}
+		std::size_t rank = 0;
+		eytzinger(1, n, rank, [&](std::size_t k, std::size_t i) {
+			::new (keys + k * sizeof(key_type)) key_type(keyOf(unsorted[order[i]]));
+			ranks[k] = i;
+		});
+		serialization::write(sink, image.data(), image.size());
+	}
+
+	/// Write image of the values in [first, last) to a file at path, see build(std::ostream&, ...).
+	template<typename InputIterator>
+	static void build(const std::string& path, InputIterator first, InputIterator last, const key_compare& compare = key_compare())
+	{
+		std::ofstream sink(path, std::ios::binary | std::ios::trunc);
+		if (!sink) {
+			throw serialization::Error("Polymorphic::MappedSortedRun: cannot create " + path);
+		}
+		build(sink, first, last, compare);
+		if (!sink.flush()) {
+			throw serialization::Error("Polymorphic::MappedSortedRun: write failed");
+		}
+	}
+
+	/// Map image file at path. Throws std::system_error if it cannot be mapped, and serialization::Error if it does not
+	/// hold a compatible image. POSIX only.
+	explicit MappedSortedRun(const std::string& path, const key_compare& compare = key_compare()) :
+		file(new MappedFile(path)), compare(compare)
+	{
+		attach(file->data(), file->size());
+	}
+
+	/// View image in [buffer, buffer + size), which must outlive the view and be aligned like the mapped file, to
+	/// alignof(std::max_align_t). Throws serialization::Error if it does not hold a compatible image.
+	MappedSortedRun(const void* buffer, std::size_t size, const key_compare& compare = key_compare()) : compare(compare)
+	{
+		attach(buffer, size);
+	}
+
+	MappedSortedRun(const MappedSortedRun&) = delete;
+	MappedSortedRun& operator=(const MappedSortedRun&) = delete;
+
+	/// Move constructor, taking over the mapping.
+	MappedSortedRun(MappedSortedRun&& other) = default;
+
+	/// Move assignment, releasing the current mapping and taking over the other's.
+	MappedSortedRun& operator=(MappedSortedRun&& other) = default;
+
+	/// Virtual destructor permitting derived classes to be deleted safely via a MappedSortedRun pointer.
+	virtual ~MappedSortedRun()
+	{
+	}
+
+	/// Iterator to the value with the least key.
+	const_iterator begin() const noexcept
+	{
+		return values;
+	}
+
+	/// Iterator past the value with the greatest key.
+	const_iterator end() const noexcept
+	{
+		return values + valueCount;
+	}
+
+	/// Iterator to the value with the least key.
+	const_iterator cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	/// Iterator past the value with the greatest key.
+	const_iterator cend() const noexcept
+	{
+		return end();
+	}
+
+	/// Reverse iterator to the value with the greatest key.
+	const_reverse_iterator rbegin() const noexcept
+	{
+		return const_reverse_iterator(end());
+	}
+
+	/// Reverse iterator past the value with the least key.
+	const_reverse_iterator rend() const noexcept
+	{
+		return const_reverse_iterator(begin());
+	}
+
+	/// Reverse iterator to the value with the greatest key.
+	const_reverse_iterator crbegin() const noexcept
+	{
+		return rbegin();
+	}
+
+	/// Reverse iterator past the value with the least key.
+	const_reverse_iterator crend() const noexcept
+	{
+		return rend();
+	}
+
+	/// True if there are no values.
+	bool empty() const noexcept
+	{
+		return valueCount == 0;
+	}
+
+	/// Number of values.
+	size_type size() const noexcept
+	{
+		return valueCount;
+	}
+
+	/// First value with key, or end() if not found.
+	const_iterator find(const key_type& key) const
+	{
+		const_iterator result = lower_bound(key);
+		return result != end() && !compare(key, keyOf(*result)) ? result : end();
+	}
+
+	/// Number of values with key.
+	size_type count(const key_type& key) const
+	{
+		std::pair<const_iterator, const_iterator> range = equal_range(key);
+		return static_cast<size_type>(range.second - range.first);
+	}
+
+	/// First value with key not less than key.
+	const_iterator lower_bound(const key_type& key) const
+	{
+		std::size_t k = 1;
+		while (k <= valueCount) {
+			k = 2 * k + (compare(keyAt(k), key) ? 1 : 0);
+		}
+		return position(k);
+	}
+
+	/// First value with key greater than key.
+	const_iterator upper_bound(const key_type& key) const
+	{
+		std::size_t k = 1;
+		while (k <= valueCount) {
+			k = 2 * k + (compare(key, keyAt(k)) ? 0 : 1);
+		}
+		return position(k);
+	}
+
+	/// Range of values with key.
+	std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+	{
+		return std::make_pair(lower_bound(key), upper_bound(key));
+	}
+
+	/// Key comparison function object.
+	key_compare key_comp() const
+	{
+		return compare;
+	}
+
+protected:
+	static const key_type& keyOf(const key_type& key)
+	{
+		return key;
+	}
+
+	template<typename T>
+	static const key_type& keyOf(const std::pair<const key_type, T>& value)
+	{
+		return value.first;
+	}
+
+private:
+	/// Leading bytes of an image, followed by count values, count + 1 keys and count + 1 ranks at the given offsets.
+	struct Header
+	{
+		char magic[4];
+		std::uint32_t version;
+		std::uint32_t keySize;
+		std::uint32_t valueSize;
+		std::uint32_t byteOrderMark;
+		std::uint32_t reserved;
+		std::uint64_t count;
+		std::uint64_t valuesOffset;
+		std::uint64_t keysOffset;
+		std::uint64_t ranksOffset;
+		std::uint64_t padding;
+	};
+
+	static_assert(sizeof(Header) == 64, "Header must not be padded");
+	static_assert(
+		alignof(key_type) <= alignof(std::max_align_t) && alignof(value_type) <= alignof(std::max_align_t),
+		"MappedSortedRun requires fundamental alignment");
+
+	std::unique_ptr<MappedFile> file;
+	key_compare compare;
+	const value_type* values;
+	const unsigned char* keys;
+	const std::uint64_t* ranks;
+	size_type valueCount;
+
+	static std::uint64_t align(std::uint64_t offset)
+	{
+		const std::uint64_t alignment = std::max<std::uint64_t>(
+			alignof(std::uint64_t), std::max<std::uint64_t>(alignof(key_type), alignof(value_type)));
+		return (offset + alignment - 1) / alignment * alignment;
+	}
+
+	/// Compute offsets of header.count values, keys and ranks.
+	static void layout(Header& header)
+	{
+		header.valuesOffset = align(sizeof(Header));
+		header.keysOffset = align(header.valuesOffset + header.count * sizeof(value_type));
+		header.ranksOffset = align(header.keysOffset + (header.count + 1) * sizeof(key_type));
+		header.padding = 0;
+	}
+
+	/// Visit nodes of the implicit tree of n nodes rooted at k in order, passing each node's index and rank.
+	template<typename Visitor>
+	static void eytzinger(std::size_t k, std::size_t n, std::size_t& rank, Visitor visit)
+	{
+		if (k <= n) {
+			eytzinger(2 * k, n, rank, visit);
+			visit(k, rank++);
+			eytzinger(2 * k + 1, n, rank, visit);
+		}
+	}
+
+	const key_type& keyAt(std::size_t k) const
+	{
+		return *reinterpret_cast<const key_type*>(keys + k * sizeof(key_type));
+	}
+
+	/// Value at the node where a descent ending at k last turned left, or end() if it never did.
+	const_iterator position(std::size_t k) const
+	{
+		while (k & 1) {
+			k >>= 1;
+		}
+		k >>= 1;
+		return k == 0 ? end() : values + std::min<std::uint64_t>(ranks[k], valueCount);
+	}
+
+	void attach(const void* buffer, std::size_t size)
+	{
+		Header header;
+		if (size < sizeof(header)) {
+			throw serialization::Error("Polymorphic::MappedSortedRun: truncated image");
+		}
+		std::memcpy(&header, buffer, sizeof(header));
+		if (std::memcmp(header.magic, "PLMS", sizeof(header.magic)) != 0) {
+			throw serialization::Error("Polymorphic::MappedSortedRun: bad magic");
+		}
+		if (header.byteOrderMark != serialization::byteOrderMark) {
+			throw serialization::Error("Polymorphic::MappedSortedRun: foreign byte order");
+		}
+		if (header.version != serialization::version) {
+			throw serialization::Error("Polymorphic::MappedSortedRun: unsupported version");
+		}
+		if (header.keySize != sizeof(key_type) || header.valueSize != sizeof(value_type)) {
+			throw serialization::Error("Polymorphic::MappedSortedRun: entry size mismatch");
+		}
+		std::uint64_t count = header.count;
+		if (count > size / std::min(sizeof(key_type), sizeof(value_type))) {
+			throw serialization::Error("Polymorphic::MappedSortedRun: truncated image");
+		}
+		Header expected = header;
+		layout(expected);
+		if (expected.valuesOffset != header.valuesOffset || expected.keysOffset != header.keysOffset ||
+			expected.ranksOffset != header.ranksOffset || header.ranksOffset + (count + 1) * sizeof(std::uint64_t) > size) {
+			throw serialization::Error("Polymorphic::MappedSortedRun: truncated image");
+		}
+		if (reinterpret_cast<std::uintptr_t>(buffer) % alignof(std::max_align_t) != 0) {
+			throw serialization::Error("Polymorphic::MappedSortedRun: misaligned image");
+		}
+		const unsigned char* bytes = static_cast<const unsigned char*>(buffer);
+		values = reinterpret_cast<const value_type*>(bytes + header.valuesOffset);
+		keys = bytes + header.keysOffset;
+		ranks = reinterpret_cast<const std::uint64_t*>(bytes + header.ranksOffset);
+		valueCount = static_cast<size_type>(count);
+	}
+};
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_MappedSortedRun_INCLUDED
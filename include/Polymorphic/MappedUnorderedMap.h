@@ -0,0 +1,412 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_MappedUnorderedMap_INCLUDED
+#define Polymorphic_MappedUnorderedMap_INCLUDED
+
+#include "Polymorphic/MappedFile.h"
+#include "Polymorphic/Serialization.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Polymorphic {
+
+/// Read only hash map view over a relocatable image, with the lookup and bucket interface of
+/// Polymorphic::UnorderedMap. Key and T must be trivially copyable.
+///
+/// The image holds no pointers: a header, the offsets of each bucket's first entry, and the entries grouped by bucket.
+/// An offline step writes it using build(), and any number of processes map the file and look up keys without
+/// parsing or copying it, sharing its pages in the page cache. Hash must yield the same values in the building and
+/// the reading processes. This is true for std::hash of integral types, but not guaranteed in general.
+template<typename Key, typename T, typename Hash = std::hash<Key>, typename Predicate = std::equal_to<Key>>
+class MappedUnorderedMap
+{
+public:
+	static_assert(
+		std::is_trivially_copyable<Key>::value && std::is_trivially_copyable<T>::value,
+		"MappedUnorderedMap requires trivially copyable Key and T");
+
+	typedef Key key_type;
+	typedef T mapped_type;
+	typedef std::pair<const key_type, mapped_type> value_type;
+	typedef Hash hasher;
+	typedef Predicate key_equal;
+	typedef const value_type& reference;
+	typedef const value_type& const_reference;
+	typedef const value_type* pointer;
+	typedef const value_type* const_pointer;
+	typedef const value_type* iterator;
+	typedef const value_type* const_iterator;
+	typedef const value_type* local_iterator;
+	typedef const value_type* const_local_iterator;
+	typedef std::ptrdiff_t difference_type;
+	typedef std::size_t size_type;
+
+	/// Write image of the entries in [first, last) to sink, grouped into size / maxLoadFactor buckets. Entries with
+	/// keys equal to a preceding entry's are skipped, like UnorderedMap::insert() does. Throws std::invalid_argument if
+	/// maxLoadFactor is not positive, std::length_error if the bucket count is not representable, and
+	/// serialization::Error if writing fails.
+	template<typename InputIterator>
+	static void build(
+		std::ostream& sink,
+		InputIterator first,
+		InputIterator last,
+		float maxLoadFactor = 1.0f,
+		const hasher& hash = hasher(),
+		const key_equal& equal = key_equal())
+	{
+		checkLoadFactor(maxLoadFactor);
+		std::vector<std::pair<key_type, mapped_type>> entries(first, last);
+		double exactCount = std::ceil(static_cast<double>(entries.size()) / maxLoadFactor);
+		if (!(exactCount < static_cast<double>(std::vector<std::uint64_t>().max_size()))) {
+			throw std::length_error("Polymorphic::MappedUnorderedMap::build: too many buckets");
+		}
+		std::uint64_t bucketCount = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(exactCount));
+
+		// Counting sort of entry indices by bucket, keeping input order within buckets.
+		std::vector<std::uint64_t> buckets(entries.size());
+		std::vector<std::uint64_t> offsets(bucketCount + 1, 0);
+		for (std::size_t i = 0; i < entries.size(); ++i) {
+			buckets[i] = hash(entries[i].first) % bucketCount;
+			++offsets[buckets[i] + 1];
+		}
+		for (std::uint64_t b = 0; b < bucketCount; ++b) {
+			offsets[b + 1] += offsets[b];
+		}
+		std::vector<std::size_t> order(entries.size());
+		std::vector<std::uint64_t> next(offsets.begin(), offsets.end() - 1);
+		for (std::size_t i = 0; i < entries.size(); ++i) {
+			order[next[buckets[i]]++] = i;
+		}
+
+		// Drop duplicates within buckets, compacting entries and offsets.
+		std::size_t kept = 0;
+		for (std::uint64_t b = 0; b < bucketCount; ++b) {
+			std::size_t bucketBegin = kept;
+			for (std::uint64_t i = offsets[b]; i < offsets[b + 1]; ++i) {
+				const key_type& key = entries[order[i]].first;
+				bool duplicate = false;
+				for (std::size_t j = bucketBegin; j < kept && !duplicate; ++j) {
+					duplicate = equal(entries[order[j]].first, key);
+				}
+				if (!duplicate) {
+					order[kept++] = order[i];
+				}
+			}
+			offsets[b] = bucketBegin;
+		}
+		offsets[bucketCount] = kept;
+
+		Header header;
+		std::memcpy(header.magic, "PLMU", sizeof(header.magic));
+		header.version = serialization::version;
+		header.keySize = sizeof(key_type);
+		header.mappedSize = sizeof(mapped_type);
+		header.valueSize = sizeof(value_type);
+		header.byteOrderMark = serialization::byteOrderMark;
+		header.bucketCount = bucketCount;
+		header.count = kept;
+		header.valuesOffset = valuesOffset(bucketCount);
+		header.reserved[0] = 0;
+		header.reserved[1] = 0;
+		serialization::write(sink, &header, sizeof(header));
+		serialization::write(sink, offsets.data(), offsets.size() * sizeof(std::uint64_t));
+		std::vector<unsigned char> padding(header.valuesOffset - sizeof(header) - offsets.size() * sizeof(std::uint64_t), 0);
+		serialization::write(sink, padding.data(), padding.size());
+
+		// Zero filled storage, so padding inside value_type is written deterministically.
+		std::vector<unsigned char> values(kept * sizeof(value_type), 0);
+		for (std::size_t i = 0; i < kept; ++i) {
+			const std::pair<key_type, mapped_type>& entry = entries[order[i]];
+			::new (values.data() + i * sizeof(value_type)) value_type(entry.first, entry.second);
+		}
+		serialization::write(sink, values.data(), values.size());
+	}
+
+	/// Write image of the entries in [first, last) to a file at path, see build(std::ostream&, ...).
+	template<typename InputIterator>
+	static void build(
+		const std::string& path,
+		InputIterator first,
+		InputIterator last,
+		float maxLoadFactor = 1.0f,
+		const hasher& hash = hasher(),
+		const key_equal& equal = key_equal())
+	{
+		// Reject before truncating an existing file.
+		checkLoadFactor(maxLoadFactor);
+		std::ofstream sink(path, std::ios::binary | std::ios::trunc);
+		if (!sink) {
+			throw serialization::Error("Polymorphic::MappedUnorderedMap: cannot create " + path);
+		}
+		build(sink, first, last, maxLoadFactor, hash, equal);
+		if (!sink.flush()) {
+			throw serialization::Error("Polymorphic::MappedUnorderedMap: write failed");
+		}
+	}
+
+	/// Map image file at path. Throws std::system_error if it cannot be mapped, and serialization::Error if it does not
+	/// hold a compatible image. POSIX only.
+	explicit MappedUnorderedMap(const std::string& path, const hasher& hash = hasher(), const key_equal& equal = key_equal()) :
+		file(new MappedFile(path)), hash(hash), equal(equal)
+	{
+		file->advise(POSIX_MADV_RANDOM);
+		attach(file->data(), file->size());
+	}
+
+	/// View image in [buffer, buffer + size), which must outlive the view and be aligned like the mapped file, to
+	/// alignof(std::max_align_t). Throws serialization::Error if it does not hold a compatible image.
+	MappedUnorderedMap(const void* buffer, std::size_t size, const hasher& hash = hasher(), const key_equal& equal = key_equal()) :
+		hash(hash), equal(equal)
+	{
+		attach(buffer, size);
+	}
+
+	MappedUnorderedMap(const MappedUnorderedMap&) = delete;
+	MappedUnorderedMap& operator=(const MappedUnorderedMap&) = delete;
+
+	/// Move constructor, taking over the mapping.
+	MappedUnorderedMap(MappedUnorderedMap&& other) = default;
+
+	/// Move assignment, releasing the current mapping and taking over the other's.
+	MappedUnorderedMap& operator=(MappedUnorderedMap&& other) = default;
+
+	/// Virtual destructor permitting derived classes to be deleted safely via a MappedUnorderedMap pointer.
+	virtual ~MappedUnorderedMap()
+	{
+	}
+
+	/// Iterator to the first entry, in bucket order.
+	const_iterator begin() const noexcept
+	{
+		return values;
+	}
+
+	/// Iterator past the last entry.
+	const_iterator end() const noexcept
+	{
+		return values + entryCount;
+	}
+
+	/// Iterator to the first entry, in bucket order.
+	const_iterator cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	/// Iterator past the last entry.
+	const_iterator cend() const noexcept
+	{
+		return end();
+	}
+
+	/// True if there are no entries.
+	bool empty() const noexcept
+	{
+		return entryCount == 0;
+	}
+
+	/// Number of entries.
+	size_type size() const noexcept
+	{
+		return entryCount;
+	}
+
+	/// Mapped value of key. Throws std::out_of_range if not found.
+	const mapped_type& at(const key_type& key) const
+	{
+		const_iterator found = find(key);
+		if (found == end()) {
+			throw std::out_of_range("Polymorphic::MappedUnorderedMap::at");
+		}
+		return found->second;
+	}
+
+	/// Entry with key, or end() if not found.
+	const_iterator find(const key_type& key) const
+	{
+		size_type n = bucket(key);
+		for (const_iterator i = begin(n), last = end(n); i != last; ++i) {
+			if (equal(i->first, key)) {
+				return i;
+			}
+		}
+		return end();
+	}
+
+	/// Number of entries with key, 0 or 1.
+	size_type count(const key_type& key) const
+	{
+		return find(key) != end() ? 1 : 0;
+	}
+
+	/// Range of entries with key, empty if not found.
+	std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+	{
+		const_iterator found = find(key);
+		return std::make_pair(found, found != end() ? found + 1 : found);
+	}
+
+	/// Number of buckets.
+	size_type bucket_count() const noexcept
+	{
+		return bucketCount;
+	}
+
+	/// Number of buckets, fixed when building the image.
+	size_type max_bucket_count() const noexcept
+	{
+		return bucketCount;
+	}
+
+	/// Number of entries in bucket n.
+	size_type bucket_size(size_type n) const
+	{
+		return static_cast<size_type>(end(n) - begin(n));
+	}
+
+	/// Bucket holding key, if present.
+	size_type bucket(const key_type& key) const
+	{
+		return static_cast<size_type>(hash(key) % bucketCount);
+	}
+
+	/// Iterator to the first entry of bucket n.
+	const_local_iterator begin(size_type n) const
+	{
+		return values + clamp(offsets[n]);
+	}
+
+	/// Iterator past the last entry of bucket n.
+	const_local_iterator end(size_type n) const
+	{
+		return values + std::max(clamp(offsets[n]), clamp(offsets[n + 1]));
+	}
+
+	/// Iterator to the first entry of bucket n.
+	const_local_iterator cbegin(size_type n) const
+	{
+		return begin(n);
+	}
+
+	/// Iterator past the last entry of bucket n.
+	const_local_iterator cend(size_type n) const
+	{
+		return end(n);
+	}
+
+	/// Average number of entries per bucket.
+	float load_factor() const noexcept
+	{
+		return static_cast<float>(entryCount) / static_cast<float>(bucketCount);
+	}
+
+	/// Hash function object.
+	hasher hash_function() const
+	{
+		return hash;
+	}
+
+	/// Key equality function object.
+	key_equal key_eq() const
+	{
+		return equal;
+	}
+
+private:
+	/// Leading bytes of an image, followed by bucketCount + 1 offsets and, at valuesOffset, count entries.
+	struct Header
+	{
+		char magic[4];
+		std::uint32_t version;
+		std::uint32_t keySize;
+		std::uint32_t mappedSize;
+		std::uint32_t valueSize;
+		std::uint32_t byteOrderMark;
+		std::uint64_t bucketCount;
+		std::uint64_t count;
+		std::uint64_t valuesOffset;
+		std::uint64_t reserved[2];
+	};
+
+	static_assert(sizeof(Header) == 64, "Header must not be padded");
+	static_assert(alignof(value_type) <= alignof(std::max_align_t), "MappedUnorderedMap requires fundamental alignment");
+
+	std::unique_ptr<MappedFile> file;
+	hasher hash;
+	key_equal equal;
+	const std::uint64_t* offsets;
+	const value_type* values;
+	size_type bucketCount;
+	size_type entryCount;
+
+	/// Offset limited to the entries present, so corrupt images cannot cause out of bounds reads.
+	std::uint64_t clamp(std::uint64_t offset) const noexcept
+	{
+		return std::min<std::uint64_t>(offset, entryCount);
+	}
+
+	static void checkLoadFactor(float maxLoadFactor)
+	{
+		if (!(maxLoadFactor > 0.0f)) {
+			throw std::invalid_argument("Polymorphic::MappedUnorderedMap::build: max load factor not positive");
+		}
+	}
+
+	static std::uint64_t valuesOffset(std::uint64_t bucketCount)
+	{
+		std::uint64_t alignment = std::max<std::uint64_t>(alignof(std::uint64_t), alignof(value_type));
+		std::uint64_t unaligned = sizeof(Header) + (bucketCount + 1) * sizeof(std::uint64_t);
+		return (unaligned + alignment - 1) / alignment * alignment;
+	}
+
+	void attach(const void* buffer, std::size_t size)
+	{
+		Header header;
+		if (size < sizeof(header)) {
+			throw serialization::Error("Polymorphic::MappedUnorderedMap: truncated image");
+		}
+		std::memcpy(&header, buffer, sizeof(header));
+		if (std::memcmp(header.magic, "PLMU", sizeof(header.magic)) != 0) {
+			throw serialization::Error("Polymorphic::MappedUnorderedMap: bad magic");
+		}
+		if (header.byteOrderMark != serialization::byteOrderMark) {
+			throw serialization::Error("Polymorphic::MappedUnorderedMap: foreign byte order");
+		}
+		if (header.version != serialization::version) {
+			throw serialization::Error("Polymorphic::MappedUnorderedMap: unsupported version");
+		}
+		if (header.keySize != sizeof(key_type) || header.mappedSize != sizeof(mapped_type) ||
+			header.valueSize != sizeof(value_type)) {
+			throw serialization::Error("Polymorphic::MappedUnorderedMap: entry size mismatch");
+		}
+		if (header.bucketCount == 0 || header.bucketCount > size / sizeof(std::uint64_t) ||
+			header.valuesOffset != valuesOffset(header.bucketCount) || header.valuesOffset > size ||
+			header.count > (size - header.valuesOffset) / sizeof(value_type)) {
+			throw serialization::Error("Polymorphic::MappedUnorderedMap: truncated image");
+		}
+		if (reinterpret_cast<std::uintptr_t>(buffer) % alignof(std::max_align_t) != 0) {
+			throw serialization::Error("Polymorphic::MappedUnorderedMap: misaligned image");
+		}
+		const unsigned char* bytes = static_cast<const unsigned char*>(buffer);
+		offsets = reinterpret_cast<const std::uint64_t*>(bytes + sizeof(header));
+		values = reinterpret_cast<const value_type*>(bytes + header.valuesOffset);
+		bucketCount = static_cast<size_type>(header.bucketCount);
+		entryCount = static_cast<size_type>(header.count);
+	}
+};
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_MappedUnorderedMap_INCLUDED
@@ -0,0 +1,413 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_MappedVector_INCLUDED
+#define Polymorphic_MappedVector_INCLUDED
+
+#include "Polymorphic/MappedFile.h"
+#include "Polymorphic/Serialization.h"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace Polymorphic {
+
+/// Sequence of trivially copyable elements stored in a memory mapped file, with the read interface of
+/// Polymorphic::Vector and push_back, resize and reserve growing the file. POSIX only.
+///
+/// The file holds a serialization image, as written by Vector::serialize(), optionally followed by reserved space.
+/// Opening maps the file without reading it, so startup does not depend on its size, and concurrent readers of the same
+/// file share its pages in the page cache. Growth extends the file and remaps it, invalidating iterators, pointers and
+/// references like std::vector reallocation does. The element count in the header is kept current, call sync() to
+/// make it and the elements durable.
+template<typename T>
+class MappedVector
+{
+public:
+	static_assert(std::is_trivially_copyable<T>::value, "MappedVector requires trivially copyable T");
+	static_assert(alignof(T) <= sizeof(serialization::Header), "MappedVector requires alignment of at most 32 bytes");
+
+	typedef T value_type;
+	typedef std::size_t size_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef T& reference;
+	typedef const T& const_reference;
+	typedef T* pointer;
+	typedef const T* const_pointer;
+	typedef T* iterator;
+	typedef const T* const_iterator;
+	typedef std::reverse_iterator<iterator> reverse_iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+	/// Access mode of the mapping.
+	enum class Mode
+	{
+		/// Map existing file privately. Elements may be modified, but modifications stay private to the mapping and never
+		/// reach the file. Growing throws std::logic_error.
+		read_only,
+		/// Map existing file, or create an empty one, for reading and writing.
+		read_write
+	};
+
+	/// Expected access pattern, passed to posix_madvise().
+	enum class Advice
+	{
+		normal,
+		sequential,
+		random,
+		willneed,
+		dontneed
+	};
+
+	/// Map file at path. Throws std::system_error if it cannot be opened or mapped, and serialization::Error if it does
+	/// not hold a compatible image.
+	explicit MappedVector(const std::string& path, Mode mode = Mode::read_only) :
+		file(path, mode == Mode::read_write ? MappedFile::Access::read_write : MappedFile::Access::copy_on_write),
+		writable(mode == Mode::read_write)
+	{
+		if (file.size() == 0 && writable) {
+			file.resize(sizeof(serialization::Header));
+			*header() = serialization::header(sizeof(T), 0);
+			return;
+		}
+		if (file.size() < sizeof(serialization::Header)) {
+			throw serialization::Error("Polymorphic::serialization: truncated image");
+		}
+		std::size_t n = serialization::validate(*header(), sizeof(T));
+		if (n > capacity()) {
+			throw serialization::Error("Polymorphic::serialization: truncated image");
+		}
+	}
+
+	MappedVector(const MappedVector&) = delete;
+	MappedVector& operator=(const MappedVector&) = delete;
+
+	/// Move constructor, taking over the mapping.
+	MappedVector(MappedVector&& other) noexcept : file(std::move(other.file)), writable(other.writable)
+	{
+	}
+
+	/// Move assignment, releasing the current mapping and taking over the other's.
+	MappedVector& operator=(MappedVector&& other) noexcept
+	{
+		if (this != &other) {
+			trim();
+			file = std::move(other.file);
+			writable = other.writable;
+		}
+		return *this;
+	}
+
+	/// Virtual destructor permitting derived classes to be deleted safely via a MappedVector pointer. Truncates
+	/// reserved space of writable files, leaving a plain image, and unmaps the file without syncing.
+	virtual ~MappedVector()
+	{
+		trim();
+	}
+
+	/// True if mapped for reading and writing.
+	bool writes() const noexcept
+	{
+		return writable;
+	}
+
+	/// Iterator to the first element.
+	iterator begin() noexcept
+	{
+		return elements();
+	}
+
+	/// Iterator to the first element.
+	const_iterator begin() const noexcept
+	{
+		return elements();
+	}
+
+	/// Iterator past the last element.
+	iterator end() noexcept
+	{
+		return elements() + size();
+	}
+
+	/// Iterator past the last element.
+	const_iterator end() const noexcept
+	{
+		return elements() + size();
+	}
+
+	/// Reverse iterator to the last element.
+	reverse_iterator rbegin() noexcept
+	{
+		return reverse_iterator(end());
+	}
+
+	/// Reverse iterator to the last element.
+	const_reverse_iterator rbegin() const noexcept
+	{
+		return const_reverse_iterator(end());
+	}
+
+	/// Reverse iterator before the first element.
+	reverse_iterator rend() noexcept
+	{
+		return reverse_iterator(begin());
+	}
+
+	/// Reverse iterator before the first element.
+	const_reverse_iterator rend() const noexcept
+	{
+		return const_reverse_iterator(begin());
+	}
+
+	/// Iterator to the first element.
+	const_iterator cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	/// Iterator past the last element.
+	const_iterator cend() const noexcept
+	{
+		return end();
+	}
+
+	/// Reverse iterator to the last element.
+	const_reverse_iterator crbegin() const noexcept
+	{
+		return rbegin();
+	}
+
+	/// Reverse iterator before the first element.
+	const_reverse_iterator crend() const noexcept
+	{
+		return rend();
+	}
+
+	/// Number of elements.
+	size_type size() const noexcept
+	{
+		return file.data() != nullptr ? static_cast<size_type>(header()->count) : 0;
+	}
+
+	/// True if there are no elements.
+	bool empty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	/// Number of elements fitting into the file without growing it.
+	size_type capacity() const noexcept
+	{
+		return file.data() != nullptr ? (file.size() - sizeof(serialization::Header)) / sizeof(T) : 0;
+	}
+
+	/// Element at position n, unchecked.
+	reference operator[](size_type n)
+	{
+		return elements()[n];
+	}
+
+	/// Element at position n, unchecked.
+	const_reference operator[](size_type n) const
+	{
+		return elements()[n];
+	}
+
+	/// Element at position n. Throws std::out_of_range if n >= size().
+	reference at(size_type n)
+	{
+		check(n);
+		return elements()[n];
+	}
+
+	/// Element at position n. Throws std::out_of_range if n >= size().
+	const_reference at(size_type n) const
+	{
+		check(n);
+		return elements()[n];
+	}
+
+	/// First element.
+	reference front()
+	{
+		return elements()[0];
+	}
+
+	/// First element.
+	const_reference front() const
+	{
+		return elements()[0];
+	}
+
+	/// Last element.
+	reference back()
+	{
+		return elements()[size() - 1];
+	}
+
+	/// Last element.
+	const_reference back() const
+	{
+		return elements()[size() - 1];
+	}
+
+	/// Pointer to the first element inside the mapping.
+	pointer data() noexcept
+	{
+		return elements();
+	}
+
+	/// Pointer to the first element inside the mapping.
+	const_pointer data() const noexcept
+	{
+		return elements();
+	}
+
+	/// Extend file to hold at least n elements, remapping it if required.
+	void reserve(size_type n)
+	{
+		requireWritable();
+		if (n > capacity()) {
+			if (n > (SIZE_MAX - sizeof(serialization::Header)) / sizeof(T)) {
+				throw std::length_error("Polymorphic::MappedVector::reserve");
+			}
+			file.resize(sizeof(serialization::Header) + n * sizeof(T));
+		}
+	}
+
+	/// Truncate file to the elements held, remapping it.
+	void shrink_to_fit()
+	{
+		requireWritable();
+		file.resize(sizeof(serialization::Header) + size() * sizeof(T));
+	}
+
+	/// Append copy of value, doubling capacity if required.
+	void push_back(const value_type& value)
+	{
+		value_type copy(value);
+		grow(size() + 1);
+		elements()[size()] = copy;
+		++header()->count;
+	}
+
+	/// Remove last element.
+	void pop_back()
+	{
+		requireWritable();
+		--header()->count;
+	}
+
+	/// Resize to n elements, appending value initialized ones if required.
+	void resize(size_type n)
+	{
+		resize(n, value_type());
+	}
+
+	/// Resize to n elements, appending copies of value if required.
+	void resize(size_type n, const value_type& value)
+	{
+		value_type copy(value);
+		grow(n);
+		if (n > size()) {
+			std::fill(elements() + size(), elements() + n, copy);
+		}
+		header()->count = n;
+	}
+
+	/// Remove all elements, keeping capacity.
+	void clear()
+	{
+		requireWritable();
+		header()->count = 0;
+	}
+
+	/// Hint expected access pattern to the kernel, such as sequential for scans or random for lookups. Throws
+	/// std::system_error if the hint is rejected.
+	void advise(Advice advice) const
+	{
+		static const int advices[] = {
+			POSIX_MADV_NORMAL, POSIX_MADV_SEQUENTIAL, POSIX_MADV_RANDOM, POSIX_MADV_WILLNEED, POSIX_MADV_DONTNEED};
+		void* base = const_cast<void*>(file.data());
+		int result = base != nullptr ? ::posix_madvise(base, file.size(), advices[static_cast<int>(advice)]) : 0;
+		if (result != 0) {
+			throw std::system_error(result, std::generic_category(), "Polymorphic::MappedVector: posix_madvise");
+		}
+	}
+
+	/// Flush elements and header to the file, blocking until written. Throws std::system_error on failure.
+	void sync()
+	{
+		file.sync();
+	}
+
+private:
+	MappedFile file;
+	bool writable;
+
+	serialization::Header* header() noexcept
+	{
+		return static_cast<serialization::Header*>(file.data());
+	}
+
+	const serialization::Header* header() const noexcept
+	{
+		return static_cast<const serialization::Header*>(file.data());
+	}
+
+	T* elements() noexcept
+	{
+		return const_cast<T*>(static_cast<const MappedVector*>(this)->elements());
+	}
+
+	const T* elements() const noexcept
+	{
+		const unsigned char* base = static_cast<const unsigned char*>(file.data());
+		return base != nullptr ? reinterpret_cast<const T*>(base + sizeof(serialization::Header)) : nullptr;
+	}
+
+	void check(size_type n) const
+	{
+		if (n >= size()) {
+			throw std::out_of_range("Polymorphic::MappedVector::at");
+		}
+	}
+
+	void requireWritable() const
+	{
+		if (!writable) {
+			throw std::logic_error("Polymorphic::MappedVector: mapped read only");
+		}
+	}
+
+	/// Reserve at least n elements, doubling capacity for amortized constant time appends.
+	void grow(size_type n)
+	{
+		requireWritable();
+		if (n > capacity()) {
+			reserve(std::max(n, 2 * capacity()));
+		}
+	}
+
+	/// Truncate reserved space of a writable file, leaving a plain image. Failure leaves the reserved space in place,
+	/// which readers ignore.
+	void trim() noexcept
+	{
+		if (writable && file.data() != nullptr) {
+			try {
+				file.resize(sizeof(serialization::Header) + size() * sizeof(T));
+			} catch (...) {
+			}
+		}
+	}
+};
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_MappedVector_INCLUDED
@@ -0,0 +1,541 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_PriorityQueue_INCLUDED
+#define Polymorphic_PriorityQueue_INCLUDED
+
+#include "Polymorphic/Vector.h"
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Polymorphic {
+
+namespace heap {
+
+/// Move value up from hole towards the root of the Arity-ary heap at first, until its parent does not compare less.
+template<std::size_t Arity, typename RandomAccessIterator, typename Compare>
+void sift_up(
+	RandomAccessIterator first,
+	std::size_t hole,
+	typename std::iterator_traits<RandomAccessIterator>::value_type value,
+	Compare& compare)
+{
+	while (hole != 0) {
+		std::size_t parent = (hole - 1) / Arity;
+		if (!compare(first[parent], value)) {
+			break;
+		}
+		first[hole] = std::move(first[parent]);
+		hole = parent;
+	}
+	first[hole] = std::move(value);
+}
+
+/// Move value down from hole towards the leaves of the Arity-ary heap of size elements at first, until no child compares
+/// greater.
+template<std::size_t Arity, typename RandomAccessIterator, typename Compare>
+void sift_down(
+	RandomAccessIterator first,
+	std::size_t size,
+	std::size_t hole,
+	typename std::iterator_traits<RandomAccessIterator>::value_type value,
+	Compare& compare)
+{
+	for (;;) {
+		std::size_t child = hole * Arity + 1;
+		if (child >= size) {
+			break;
+		}
+		std::size_t last = size - child > Arity ? child + Arity : size;
+		std::size_t greatest = child;
+		for (++child; child < last; ++child) {
+			if (compare(first[greatest], first[child])) {
+				greatest = child;
+			}
+		}
+		if (!compare(value, first[greatest])) {
+			break;
+		}
+		first[hole] = std::move(first[greatest]);
+		hole = greatest;
+	}
+	first[hole] = std::move(value);
+}
+
+/// Replace the root of the Arity-ary heap of size elements at first by value. The hole descends along greatest children
+/// down to a leaf first, then value moves up from there. This saves the comparisons against value on the way down, as
+/// the former last element typically belongs near the leaves again.
+template<std::size_t Arity, typename RandomAccessIterator, typename Compare>
+void replace_top(
+	RandomAccessIterator first,
+	std::size_t size,
+	typename std::iterator_traits<RandomAccessIterator>::value_type value,
+	Compare& compare)
+{
+	std::size_t hole = 0;
+	for (;;) {
+		std::size_t child = hole * Arity + 1;
+		if (child >= size) {
+			break;
+		}
+		std::size_t last = size - child > Arity ? child + Arity : size;
+		std::size_t greatest = child;
+		for (++child; child < last; ++child) {
+			if (compare(first[greatest], first[child])) {
+				greatest = child;
+			}
+		}
+		first[hole] = std::move(first[greatest]);
+		hole = greatest;
+	}
+	sift_up<Arity>(first, hole, std::move(value), compare);
+}
+
+/// Arrange [first, last) into an Arity-ary heap, the greatest element per compare going first.
+template<std::size_t Arity, typename RandomAccessIterator, typename Compare>
+void make_heap(RandomAccessIterator first, RandomAccessIterator last, Compare& compare)
+{
+	std::size_t size = static_cast<std::size_t>(last - first);
+	for (std::size_t parent = size > 1 ? (size - 2) / Arity + 1 : 0; parent-- != 0;) {
+		sift_down<Arity>(first, size, parent, std::move(first[parent]), compare);
+	}
+}
+
+/// Check whether [first, last) is an Arity-ary heap per compare.
+template<std::size_t Arity, typename RandomAccessIterator, typename Compare>
+bool is_heap(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+	std::size_t size = static_cast<std::size_t>(last - first);
+	for (std::size_t child = 1; child < size; ++child) {
+		if (compare(first[(child - 1) / Arity], first[child])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+} // namespace heap
+
+/// Priority queue providing the std::priority_queue<T, Container, Compare> interface over an Arity-ary heap.
+///
+/// With Arity 2 the heap layout is the one of std::make_heap. Higher arities make the heap flatter, so pop() touches
+/// fewer cache lines on the way down at the cost of comparing more siblings per level, and push() climbs fewer levels.
+/// The underlying container, a Polymorphic::Vector by default, can be reserved up front.
+///
+/// Like the decorators, PriorityQueue has a virtual destructor. Add new behavior in subclasses using new virtual members,
+/// which, like those of std::priority_queue, have access to the protected container c and comparator comp.
+template<
+	typename T,
+	typename Container = Vector<T>,
+	typename Compare = std::less<typename Container::value_type>,
+	std::size_t Arity = 2>
+class PriorityQueue
+{
+	static_assert(Arity >= 2, "Polymorphic::PriorityQueue arity must be at least 2");
+
+public:
+	typedef Container container_type;
+	typedef Compare value_compare;
+	typedef typename Container::value_type value_type;
+	typedef typename Container::size_type size_type;
+	typedef typename Container::reference reference;
+	typedef typename Container::const_reference const_reference;
+
+	/// Number of children per heap node.
+	static const std::size_t arity = Arity;
+
+	/// Construct queue from compare and a copy of container, making a heap of its elements.
+	PriorityQueue(const Compare& compare, const Container& container) : c(container), comp(compare)
+	{
+		heap::make_heap<Arity>(c.begin(), c.end(), comp);
+	}
+
+	/// Construct queue from compare and container, making a heap of its elements.
+	explicit PriorityQueue(const Compare& compare = Compare(), Container&& container = Container()) :
+		c(std::move(container)), comp(compare)
+	{
+		heap::make_heap<Arity>(c.begin(), c.end(), comp);
+	}
+
+	/// Construct queue from compare, a copy of container, and the elements of [first, last).
+	template<typename InputIterator>
+	PriorityQueue(InputIterator first, InputIterator last, const Compare& compare, const Container& container) :
+		c(container), comp(compare)
+	{
+		c.insert(c.end(), first, last);
+		heap::make_heap<Arity>(c.begin(), c.end(), comp);
+	}
+
+	/// Construct queue from compare, container, and the elements of [first, last).
+	template<typename InputIterator>
+	PriorityQueue(
+		InputIterator first, InputIterator last, const Compare& compare = Compare(), Container&& container = Container()) :
+		c(std::move(container)), comp(compare)
+	{
+		c.insert(c.end(), first, last);
+		heap::make_heap<Arity>(c.begin(), c.end(), comp);
+	}
+
+	/// Virtual destructor permitting derived classes to be deleted safely via a PriorityQueue pointer.
+	virtual ~PriorityQueue()
+	{
+	}
+
+	/// Check whether queue is empty.
+	bool empty() const
+	{
+		return c.empty();
+	}
+
+	/// Number of elements.
+	size_type size() const
+	{
+		return c.size();
+	}
+
+	/// Greatest element per compare.
+	const_reference top() const
+	{
+		return c.front();
+	}
+
+	/// Insert copy of value.
+	void push(const value_type& value)
+	{
+		c.push_back(value);
+		heap::sift_up<Arity>(c.begin(), c.size() - 1, std::move(c.back()), comp);
+	}
+
+	/// Insert value.
+	void push(value_type&& value)
+	{
+		c.push_back(std::move(value));
+		heap::sift_up<Arity>(c.begin(), c.size() - 1, std::move(c.back()), comp);
+	}
+
+	/// Insert element constructed in place from args.
+	template<typename... Args>
+	void emplace(Args&&... args)
+	{
+		c.emplace_back(std::forward<Args>(args)...);
+		heap::sift_up<Arity>(c.begin(), c.size() - 1, std::move(c.back()), comp);
+	}
+
+	/// Remove greatest element per compare.
+	void pop()
+	{
+		value_type value(std::move(c.back()));
+		c.pop_back();
+		if (!c.empty()) {
+			heap::replace_top<Arity>(c.begin(), c.size(), std::move(value), comp);
+		}
+	}
+
+	/// Swap elements and comparators with other.
+	void swap(PriorityQueue& other)
+	{
+		using std::swap;
+		c.swap(other.c);
+		swap(comp, other.comp);
+	}
+
+	/// Reserve container capacity for n elements. Available if the container has reserve().
+	template<typename C = Container>
+	auto reserve(size_type n) -> decltype(std::declval<C&>().reserve(n))
+	{
+		return c.reserve(n);
+	}
+
+	/// Container capacity. Available if the container has capacity().
+	template<typename C = Container>
+	auto capacity() const -> decltype(std::declval<const C&>().capacity())
+	{
+		return c.capacity();
+	}
+
+protected:
+	Container c;
+	Compare comp;
+};
+
+template<typename T, typename Container, typename Compare, std::size_t Arity>
+const std::size_t PriorityQueue<T, Container, Compare, Arity>::arity;
+
+/// Swap elements and comparators of lhs and rhs.
+template<typename T, typename Container, typename Compare, std::size_t Arity>
+void swap(PriorityQueue<T, Container, Compare, Arity>& lhs, PriorityQueue<T, Container, Compare, Arity>& rhs)
+{
+	lhs.swap(rhs);
+}
+
+/// Priority queue over an Arity-ary heap, whose elements are addressed by handles for update() and erase().
+///
+/// push() returns a handle identifying the element until it is popped or erased. Afterwards the handle may be reused
+/// for a later push(). The heap holds handles only, so restoring the heap moves indices, not elements. Popping or
+/// erasing an element assigns a value initialized T to its slot, releasing whatever resources the element held.
+///
+/// Like the decorators, IndexedPriorityQueue has a virtual destructor. Add new behavior in subclasses using new virtual
+/// members.
+template<typename T, typename Compare = std::less<T>, std::size_t Arity = 2>
+class IndexedPriorityQueue
+{
+	static_assert(Arity >= 2, "Polymorphic::IndexedPriorityQueue arity must be at least 2");
+
+public:
+	typedef T value_type;
+	typedef Compare value_compare;
+	typedef std::size_t size_type;
+	typedef const value_type& const_reference;
+	typedef std::size_t handle_type;
+
+	/// Number of children per heap node.
+	static const std::size_t arity = Arity;
+
+	/// Handle value never returned by push().
+	static const handle_type npos = static_cast<handle_type>(-1);
+
+	/// Construct empty queue.
+	explicit IndexedPriorityQueue(const Compare& compare = Compare()) : comp(compare)
+	{
+	}
+
+	/// Virtual destructor permitting derived classes to be deleted safely via an IndexedPriorityQueue pointer.
+	virtual ~IndexedPriorityQueue()
+	{
+	}
+
+	/// Check whether queue is empty.
+	bool empty() const noexcept
+	{
+		return heap.empty();
+	}
+
+	/// Number of elements.
+	size_type size() const noexcept
+	{
+		return heap.size();
+	}
+
+	/// Greatest element per compare.
+	const_reference top() const
+	{
+		return values[heap.front()];
+	}
+
+	/// Handle of the greatest element per compare.
+	handle_type top_handle() const
+	{
+		return heap.front();
+	}
+
+	/// Check whether handle identifies an element in the queue.
+	bool contains(handle_type handle) const noexcept
+	{
+		return handle < positions.size() && positions[handle] != npos;
+	}
+
+	/// Element identified by handle. Throws std::out_of_range if handle identifies none.
+	const_reference value(handle_type handle) const
+	{
+		check(handle);
+		return values[handle];
+	}
+
+	/// Insert copy of value, returning its handle.
+	handle_type push(const value_type& value)
+	{
+		return emplace(value);
+	}
+
+	/// Insert value, returning its handle.
+	handle_type push(value_type&& value)
+	{
+		return emplace(std::move(value));
+	}
+
+	/// Insert element constructed in place from args, returning its handle.
+	template<typename... Args>
+	handle_type emplace(Args&&... args)
+	{
+		handle_type handle;
+		if (freeHandles.empty()) {
+			handle = values.size();
+			values.emplace_back(std::forward<Args>(args)...);
+			positions.push_back(npos);
+		} else {
+			handle = freeHandles.back();
+			values[handle] = value_type(std::forward<Args>(args)...);
+			freeHandles.pop_back();
+		}
+		heap.push_back(handle);
+		siftUp(heap.size() - 1, handle);
+		return handle;
+	}
+
+	/// Remove greatest element per compare, releasing its handle.
+	void pop()
+	{
+		remove(0);
+	}
+
+	/// Replace element identified by handle by a copy of value, restoring the heap. Throws std::out_of_range if handle
+	/// identifies none.
+	void update(handle_type handle, const value_type& value)
+	{
+		check(handle);
+		values[handle] = value;
+		restore(positions[handle], handle);
+	}
+
+	/// Replace element identified by handle by value, restoring the heap. Throws std::out_of_range if handle identifies
+	/// none.
+	void update(handle_type handle, value_type&& value)
+	{
+		check(handle);
+		values[handle] = std::move(value);
+		restore(positions[handle], handle);
+	}
+
+	/// Remove element identified by handle, releasing the handle. Throws std::out_of_range if handle identifies none.
+	void erase(handle_type handle)
+	{
+		check(handle);
+		remove(positions[handle]);
+	}
+
+	/// Reserve capacity for n elements.
+	void reserve(size_type n)
+	{
+		values.reserve(n);
+		positions.reserve(n);
+		heap.reserve(n);
+	}
+
+	/// Remove all elements, releasing all handles.
+	void clear() noexcept
+	{
+		values.clear();
+		positions.clear();
+		heap.clear();
+		freeHandles.clear();
+	}
+
+	/// Swap elements, handles and comparators with other.
+	void swap(IndexedPriorityQueue& other)
+	{
+		using std::swap;
+		values.swap(other.values);
+		positions.swap(other.positions);
+		heap.swap(other.heap);
+		freeHandles.swap(other.freeHandles);
+		swap(comp, other.comp);
+	}
+
+protected:
+	Compare comp;
+
+private:
+	void check(handle_type handle) const
+	{
+		if (!contains(handle)) {
+			throw std::out_of_range("Polymorphic::IndexedPriorityQueue: invalid handle");
+		}
+	}
+
+	void place(size_type position, handle_type handle)
+	{
+		heap[position] = handle;
+		positions[handle] = position;
+	}
+
+	void siftUp(size_type hole, handle_type handle)
+	{
+		while (hole != 0) {
+			size_type parent = (hole - 1) / Arity;
+			if (!comp(values[heap[parent]], values[handle])) {
+				break;
+			}
+			place(hole, heap[parent]);
+			hole = parent;
+		}
+		place(hole, handle);
+	}
+
+	void siftDown(size_type hole, handle_type handle)
+	{
+		size_type size = heap.size();
+		for (;;) {
+			size_type child = hole * Arity + 1;
+			if (child >= size) {
+				break;
+			}
+			size_type last = size - child > Arity ? child + Arity : size;
+			size_type greatest = child;
+			for (++child; child < last; ++child) {
+				if (comp(values[heap[greatest]], values[heap[child]])) {
+					greatest = child;
+				}
+			}
+			if (!comp(values[handle], values[heap[greatest]])) {
+				break;
+			}
+			place(hole, heap[greatest]);
+			hole = greatest;
+		}
+		place(hole, handle);
+	}
+
+	void restore(size_type position, handle_type handle)
+	{
+		if (position != 0 && comp(values[heap[(position - 1) / Arity]], values[handle])) {
+			siftUp(position, handle);
+		} else {
+			siftDown(position, handle);
+		}
+	}
+
+	void remove(size_type position)
+	{
+		handle_type removed = heap[position];
+		// Release resources held by the element now, rather than when its slot is reused.
+		values[removed] = value_type();
+		handle_type last = heap.back();
+		heap.pop_back();
+		positions[removed] = npos;
+		freeHandles.push_back(removed);
+		if (position != heap.size()) {
+			restore(position, last);
+		}
+	}
+
+	std::vector<value_type> values;
+	std::vector<size_type> positions;
+	std::vector<handle_type> heap;
+	std::vector<handle_type> freeHandles;
+};
+
+template<typename T, typename Compare, std::size_t Arity>
+const std::size_t IndexedPriorityQueue<T, Compare, Arity>::arity;
+
+template<typename T, typename Compare, std::size_t Arity>
+const typename IndexedPriorityQueue<T, Compare, Arity>::handle_type IndexedPriorityQueue<T, Compare, Arity>::npos;
+
+/// Swap elements, handles and comparators of lhs and rhs.
+template<typename T, typename Compare, std::size_t Arity>
+void swap(IndexedPriorityQueue<T, Compare, Arity>& lhs, IndexedPriorityQueue<T, Compare, Arity>& rhs)
+{
+	lhs.swap(rhs);
+}
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_PriorityQueue_INCLUDED
@@ -0,0 +1,228 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_Queue_INCLUDED
+#define Polymorphic_Queue_INCLUDED
+
+#include "Polymorphic/Deque.h"
+#include <utility>
+
+namespace Polymorphic {
+
+template<typename T, typename Container>
+class Queue;
+
+template<typename T, typename Container>
+bool operator==(const Queue<T, Container>& lhs, const Queue<T, Container>& rhs);
+
+template<typename T, typename Container>
+bool operator!=(const Queue<T, Container>& lhs, const Queue<T, Container>& rhs);
+
+template<typename T, typename Container>
+bool operator<(const Queue<T, Container>& lhs, const Queue<T, Container>& rhs);
+
+template<typename T, typename Container>
+bool operator<=(const Queue<T, Container>& lhs, const Queue<T, Container>& rhs);
+
+template<typename T, typename Container>
+bool operator>(const Queue<T, Container>& lhs, const Queue<T, Container>& rhs);
+
+template<typename T, typename Container>
+bool operator>=(const Queue<T, Container>& lhs, const Queue<T, Container>& rhs);
+
+/// FIFO adaptor providing the std::queue<T, Container> interface, with a virtual destructor.
+///
+/// Container defaults to Polymorphic::Deque<T>, but any sequence with front(), back(), push_back() and pop_front() will
+/// do, e.g. Polymorphic::List<T> or Polymorphic::RingBuffer<T>, which reserve() can size up front. Like those of
+/// std::queue, derived classes have access to the protected container c.
+template<typename T, typename Container = Deque<T>>
+class Queue
+{
+public:
+	typedef Container container_type;
+	typedef typename Container::value_type value_type;
+	typedef typename Container::size_type size_type;
+	typedef typename Container::reference reference;
+	typedef typename Container::const_reference const_reference;
+
+	/// Construct queue from a copy of container.
+	explicit Queue(const Container& container) : c(container)
+	{
+	}
+
+	/// Construct queue from container.
+	explicit Queue(Container&& container = Container()) : c(std::move(container))
+	{
+	}
+
+	/// Virtual destructor permitting derived classes to be deleted safely via a Queue pointer.
+	virtual ~Queue()
+	{
+	}
+
+	/// Forwarded to Container::empty().
+	bool empty() const
+	{
+		return c.empty();
+	}
+
+	/// Forwarded to Container::size().
+	size_type size() const
+	{
+		return c.size();
+	}
+
+	/// Forwarded to Container::front().
+	reference front()
+	{
+		return c.front();
+	}
+
+	/// Forwarded to Container::front() const.
+	const_reference front() const
+	{
+		return c.front();
+	}
+
+	/// Forwarded to Container::back().
+	reference back()
+	{
+		return c.back();
+	}
+
+	/// Forwarded to Container::back() const.
+	const_reference back() const
+	{
+		return c.back();
+	}
+
+	/// Forwarded to Container::push_back(const value_type& value).
+	void push(const value_type& value)
+	{
+		c.push_back(value);
+	}
+
+	/// Forwarded to Container::push_back(value_type&& value).
+	void push(value_type&& value)
+	{
+		c.push_back(std::move(value));
+	}
+
+	/// Forwarded to Container::emplace_back(Args&&... args).
+	template<typename... Args>
+	void emplace(Args&&... args)
+	{
+		c.emplace_back(std::forward<Args>(args)...);
+	}
+
+	/// Forwarded to Container::pop_front().
+	void pop()
+	{
+		c.pop_front();
+	}
+
+	/// Push elements of [first, last) in order, the last one ending up at the back. Forwarded to Container::insert(end(),
+	/// first, last), inserting in bulk.
+	template<typename InputIterator>
+	void push_range(InputIterator first, InputIterator last)
+	{
+		c.insert(c.end(), first, last);
+	}
+
+	/// Pop n elements from the front, n not exceeding size().
+	void pop_n(size_type n)
+	{
+		for (; n != 0; --n) {
+			c.pop_front();
+		}
+	}
+
+	/// Swap elements with other.
+	void swap(Queue& other)
+	{
+		c.swap(other.c);
+	}
+
+	/// Forwarded to Container::reserve(size_type n). Available if the container has reserve().
+	template<typename C = Container>
+	auto reserve(size_type n) -> decltype(std::declval<C&>().reserve(n))
+	{
+		return c.reserve(n);
+	}
+
+	/// Forwarded to Container::capacity(). Available if the container has capacity().
+	template<typename C = Container>
+	auto capacity() const -> decltype(std::declval<const C&>().capacity())
+	{
+		return c.capacity();
+	}
+
+protected:
+	Container c;
+
+	// clang-format off
+	friend bool operator== <T, Container>(const Queue& lhs, const Queue& rhs);
+	friend bool operator!= <T, Container>(const Queue& lhs, const Queue& rhs);
+	friend bool operator< <T, Container>(const Queue& lhs, const Queue& rhs);
+	friend bool operator<= <T, Container>(const Queue& lhs, const Queue& rhs);
+	friend bool operator> <T, Container>(const Queue& lhs, const Queue& rhs);
+	friend bool operator>= <T, Container>(const Queue& lhs, const Queue& rhs);
+	// clang-format on
+};
+
+/// Forwarded to operator==(const Container& lhs, const Container& rhs).
+template<typename T, typename Container>
+bool operator==(const Queue<T, Container>& lhs, const Queue<T, Container>& rhs)
+{
+	return lhs.c == rhs.c;
+}
+
+/// Forwarded to operator!=(const Container& lhs, const Container& rhs).
+template<typename T, typename Container>
+bool operator!=(const Queue<T, Container>& lhs, const Queue<T, Container>& rhs)
+{
+	return lhs.c != rhs.c;
+}
+
+/// Forwarded to operator<(const Container& lhs, const Container& rhs).
+template<typename T, typename Container>
+bool operator<(const Queue<T, Container>& lhs, const Queue<T, Container>& rhs)
+{
+	return lhs.c < rhs.c;
+}
+
+/// Forwarded to operator<=(const Container& lhs, const Container& rhs).
+template<typename T, typename Container>
+bool operator<=(const Queue<T, Container>& lhs, const Queue<T, Container>& rhs)
+{
+	return lhs.c <= rhs.c;
+}
+
+/// Forwarded to operator>(const Container& lhs, const Container& rhs).
+template<typename T, typename Container>
+bool operator>(const Queue<T, Container>& lhs, const Queue<T, Container>& rhs)
+{
+	return lhs.c > rhs.c;
+}
+
+/// Forwarded to operator>=(const Container& lhs, const Container& rhs).
+template<typename T, typename Container>
+bool operator>=(const Queue<T, Container>& lhs, const Queue<T, Container>& rhs)
+{
+	return lhs.c >= rhs.c;
+}
+
+/// Swap elements of lhs and rhs.
+template<typename T, typename Container>
+void swap(Queue<T, Container>& lhs, Queue<T, Container>& rhs)
+{
+	lhs.swap(rhs);
+}
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_Queue_INCLUDED
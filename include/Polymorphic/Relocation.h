@@ -0,0 +1,144 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_Relocation_INCLUDED
+#define Polymorphic_Relocation_INCLUDED
+
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// Non-zero if the standard library's std::vector and std::deque own no pointers into themselves, so decorators
+/// delegating to them may be declared trivially relocatable. Known to hold for libstdc++, except in debug mode
+/// tracking iterators, and for libc++. Define it 0 to opt out, or 1 to opt in for another standard library.
+#ifndef POLYMORPHIC_RELOCATABLE_DELEGATES
+#if (defined(__GLIBCXX__) && !defined(_GLIBCXX_DEBUG)) || defined(_LIBCPP_VERSION)
+#define POLYMORPHIC_RELOCATABLE_DELEGATES 1
+#else
+#define POLYMORPHIC_RELOCATABLE_DELEGATES 0
+#endif
+#endif
+
+namespace Polymorphic {
+
+/// True for types whose objects may be relocated, i.e. move constructed into new storage and destroyed at their old
+/// address, by copying their bytes instead. Defaults to trivially copyable types. Specialize it for types holding no
+/// pointers into their own objects, and not registering their addresses elsewhere.
+template<typename T>
+struct is_trivially_relocatable : std::integral_constant<bool, std::is_trivially_copyable<T>::value>
+{
+};
+
+/// The standard allocator is stateless.
+template<typename T>
+struct is_trivially_relocatable<std::allocator<T>> : std::true_type
+{
+};
+
+namespace detail {
+
+/// Vector relocates elements on insert and erase if they are trivially relocatable but not trivially copyable, as
+/// std::vector copies bytes of the latter anyway. Storage left behind is refilled with default constructed elements
+/// before the delegate destroys it, which is why these must be constructible and destructible nothrow.
+template<typename T>
+struct is_relocating : std::integral_constant<
+						   bool,
+						   is_trivially_relocatable<T>::value && !std::is_trivially_copyable<T>::value &&
+							   std::is_nothrow_default_constructible<T>::value && std::is_nothrow_destructible<T>::value>
+{
+};
+
+/// Copy bytes of n objects from source to target, which may overlap.
+template<typename T>
+void relocate(T* target, T* source, std::size_t n) noexcept
+{
+	std::memmove(static_cast<void*>(target), static_cast<const void*>(source), n * sizeof(T));
+}
+
+/// Forwarded to sequence.erase(first, last), for elements not relocated.
+template<typename Sequence>
+typename Sequence::iterator erase(
+	std::false_type, Sequence& sequence, typename Sequence::const_iterator first, typename Sequence::const_iterator last)
+{
+	return sequence.erase(first, last);
+}
+
+/// Forwarded to sequence.emplace(position, args...), for elements not relocated.
+template<typename Sequence, typename... Args>
+typename Sequence::iterator emplace(std::false_type, Sequence& sequence, typename Sequence::const_iterator position, Args&&... args)
+{
+	return sequence.emplace(position, std::forward<Args>(args)...);
+}
+
+/// Erase [first, last) from sequence, relocating the elements behind them to the front by a single memmove.
+template<typename T, typename Allocator>
+typename std::vector<T, Allocator>::iterator erase(
+	std::true_type,
+	std::vector<T, Allocator>& sequence,
+	typename std::vector<T, Allocator>::const_iterator first,
+	typename std::vector<T, Allocator>::const_iterator last)
+{
+	typedef std::allocator_traits<Allocator> AllocatorTraits;
+	std::size_t offset = static_cast<std::size_t>(first - sequence.cbegin());
+	std::size_t n = static_cast<std::size_t>(last - first);
+	if (n == 0) {
+		return sequence.begin() + offset;
+	}
+	Allocator allocator(sequence.get_allocator());
+	T* target = sequence.data() + offset;
+	T* end = sequence.data() + sequence.size();
+	for (T* pointer = target; pointer != target + n; ++pointer) {
+		AllocatorTraits::destroy(allocator, pointer);
+	}
+	relocate(target, target + n, static_cast<std::size_t>(end - target) - n);
+	for (T* pointer = end - n; pointer != end; ++pointer) {
+		AllocatorTraits::construct(allocator, pointer);
+	}
+	sequence.erase(sequence.end() - n, sequence.end());
+	return sequence.begin() + offset;
+}
+
+/// Insert an element constructed from args at position, relocating the elements behind it by a single memmove. The
+/// element is constructed before the sequence is touched, so args may refer to elements of the sequence.
+template<typename T, typename Allocator, typename... Args>
+typename std::vector<T, Allocator>::iterator emplace(
+	std::true_type,
+	std::vector<T, Allocator>& sequence,
+	typename std::vector<T, Allocator>::const_iterator position,
+	Args&&... args)
+{
+	typedef std::allocator_traits<Allocator> AllocatorTraits;
+	std::size_t offset = static_cast<std::size_t>(position - sequence.cbegin());
+	if (offset == sequence.size()) {
+		sequence.emplace_back(std::forward<Args>(args)...);
+		return sequence.end() - 1;
+	}
+	Allocator allocator(sequence.get_allocator());
+	typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+	T* value = reinterpret_cast<T*>(&storage);
+	AllocatorTraits::construct(allocator, value, std::forward<Args>(args)...);
+	try {
+		sequence.emplace_back();
+	} catch (...) {
+		AllocatorTraits::destroy(allocator, value);
+		throw;
+	}
+	T* target = sequence.data() + offset;
+	T* back = sequence.data() + sequence.size() - 1;
+	AllocatorTraits::destroy(allocator, back);
+	relocate(target + 1, target, static_cast<std::size_t>(back - target));
+	relocate(target, value, 1);
+	return sequence.begin() + offset;
+}
+
+} // namespace detail
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_Relocation_INCLUDED
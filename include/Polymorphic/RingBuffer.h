@@ -0,0 +1,946 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_RingBuffer_INCLUDED
+#define Polymorphic_RingBuffer_INCLUDED
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace Polymorphic {
+
+template<typename T, typename Allocator>
+class RingBuffer;
+
+template<typename T, typename Allocator>
+bool operator==(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+bool operator!=(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+bool operator<(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+bool operator<=(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+bool operator>(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+bool operator>=(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+void swap(RingBuffer<T, Allocator>& lhs, RingBuffer<T, Allocator>& rhs);
+
+/// Contiguous circular buffer providing the std::deque<T> interface.
+///
+/// Elements live in a single allocation of capacity() slots, capacity() always being a power of two. Pushing and
+/// popping at either end does not allocate as long as size() stays within capacity(), so a bounded sliding window
+/// runs allocation free at steady state once reserve() has been called.
+///
+/// When full, push and emplace at either end grow the buffer to the next power of two. With overwrite mode enabled
+/// they discard the element at the opposite end instead, keeping capacity() constant. Insertions in the middle always
+/// grow the buffer as required.
+///
+/// Like the decorators, RingBuffer has a virtual destructor. Add new behavior in subclasses using new virtual members.
+template<typename T, typename Allocator = std::allocator<T>>
+class RingBuffer
+{
+	typedef std::allocator_traits<Allocator> AllocatorTraits;
+
+	template<bool isConst>
+	class Iterator;
+
+public:
+	typedef T value_type;
+	typedef Allocator allocator_type;
+	typedef value_type& reference;
+	typedef const value_type& const_reference;
+	typedef typename AllocatorTraits::pointer pointer;
+	typedef typename AllocatorTraits::const_pointer const_pointer;
+	typedef Iterator<false> iterator;
+	typedef Iterator<true> const_iterator;
+	typedef std::reverse_iterator<iterator> reverse_iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+	typedef typename AllocatorTraits::difference_type difference_type;
+	typedef typename AllocatorTraits::size_type size_type;
+
+	/// Construct empty buffer without allocating.
+	explicit RingBuffer(const allocator_type& allocator = allocator_type()) :
+		allocator(allocator), buffer(), bufferCapacity(0), head(0), count(0), overwriteEnabled(false)
+	{
+	}
+
+	/// Construct buffer holding n value initialized elements.
+	explicit RingBuffer(size_type n) : RingBuffer()
+	{
+		resize(n);
+	}
+
+	/// Construct buffer holding n copies of value.
+	RingBuffer(size_type n, const value_type& value, const allocator_type& allocator = allocator_type()) : RingBuffer(allocator)
+	{
+		assign(n, value);
+	}
+
+	/// Construct buffer holding copies of elements in range [first, last).
+	template<typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+	RingBuffer(InputIterator first, InputIterator last, const allocator_type& allocator = allocator_type()) : RingBuffer(allocator)
+	{
+		assign(first, last);
+	}
+
+	/// Copy constructor.
+	RingBuffer(const RingBuffer& other) :
+		RingBuffer(other, AllocatorTraits::select_on_container_copy_construction(other.allocator))
+	{
+	}
+
+	/// Copy constructor, taking over capacity and overwrite mode, as these define the window of an overwriting buffer.
+	RingBuffer(const RingBuffer& other, const allocator_type& allocator) : RingBuffer(allocator)
+	{
+		overwriteEnabled = other.overwriteEnabled;
+		reserve(other.bufferCapacity);
+		assign(other.begin(), other.end());
+	}
+
+	/// Move constructor.
+	RingBuffer(RingBuffer&& other) : RingBuffer(std::move(other.allocator))
+	{
+		steal(other);
+	}
+
+	/// Move constructor.
+	RingBuffer(RingBuffer&& other, const allocator_type& allocator) : RingBuffer(allocator)
+	{
+		if (this->allocator == other.allocator) {
+			steal(other);
+		} else {
+			overwriteEnabled = other.overwriteEnabled;
+			reserve(other.bufferCapacity);
+			assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+			other.clear();
+		}
+	}
+
+	/// Construct buffer holding copies of initializer list elements.
+	RingBuffer(std::initializer_list<value_type> initializerList, const allocator_type& allocator = allocator_type()) :
+		RingBuffer(allocator)
+	{
+		assign(initializerList);
+	}
+
+	/// Virtual destructor permitting derived classes to be deleted safely via a RingBuffer pointer.
+	virtual ~RingBuffer()
+	{
+		release();
+	}
+
+	/// Copy assignment operator, taking over capacity and overwrite mode.
+	RingBuffer& operator=(const RingBuffer& other)
+	{
+		if (this != &other) {
+			bool propagate = AllocatorTraits::propagate_on_container_copy_assignment::value && allocator != other.allocator;
+			if (propagate || bufferCapacity != other.bufferCapacity) {
+				release();
+			}
+			if (propagate) {
+				allocator = other.allocator;
+			}
+			overwriteEnabled = other.overwriteEnabled;
+			reserve(other.bufferCapacity);
+			assign(other.begin(), other.end());
+		}
+		return *this;
+	}
+
+	/// Move assignment operator
+	RingBuffer& operator=(RingBuffer&& other)
+	{
+		if (this != &other) {
+			if (AllocatorTraits::propagate_on_container_move_assignment::value || allocator == other.allocator) {
+				release();
+				if (AllocatorTraits::propagate_on_container_move_assignment::value) {
+					allocator = std::move(other.allocator);
+				}
+				steal(other);
+			} else {
+				if (bufferCapacity != other.bufferCapacity) {
+					release();
+				}
+				overwriteEnabled = other.overwriteEnabled;
+				reserve(other.bufferCapacity);
+				assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+				other.clear();
+			}
+		}
+		return *this;
+	}
+
+	/// Initializer list assignment operator
+	RingBuffer& operator=(std::initializer_list<value_type> initializerList)
+	{
+		assign(initializerList);
+		return *this;
+	}
+
+	/// Iterator to the first (oldest when pushing back) element.
+	iterator begin() noexcept
+	{
+		return iterator(this, 0);
+	}
+
+	/// Iterator to the first (oldest when pushing back) element.
+	const_iterator begin() const noexcept
+	{
+		return const_iterator(this, 0);
+	}
+
+	/// Iterator past the last element.
+	iterator end() noexcept
+	{
+		return iterator(this, count);
+	}
+
+	/// Iterator past the last element.
+	const_iterator end() const noexcept
+	{
+		return const_iterator(this, count);
+	}
+
+	/// Reverse iterator to the last element.
+	reverse_iterator rbegin() noexcept
+	{
+		return reverse_iterator(end());
+	}
+
+	/// Reverse iterator to the last element.
+	const_reverse_iterator rbegin() const noexcept
+	{
+		return const_reverse_iterator(end());
+	}
+
+	/// Reverse iterator before the first element.
+	reverse_iterator rend() noexcept
+	{
+		return reverse_iterator(begin());
+	}
+
+	/// Reverse iterator before the first element.
+	const_reverse_iterator rend() const noexcept
+	{
+		return const_reverse_iterator(begin());
+	}
+
+	/// Const iterator to the first element.
+	const_iterator cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	/// Const iterator past the last element.
+	const_iterator cend() const noexcept
+	{
+		return end();
+	}
+
+	/// Const reverse iterator to the last element.
+	const_reverse_iterator crbegin() const noexcept
+	{
+		return rbegin();
+	}
+
+	/// Const reverse iterator before the first element.
+	const_reverse_iterator crend() const noexcept
+	{
+		return rend();
+	}
+
+	/// True if there are no elements.
+	bool empty() const noexcept
+	{
+		return count == 0;
+	}
+
+	/// True if the next push at either end would either grow the buffer or, in overwrite mode, discard an element.
+	bool full() const noexcept
+	{
+		return count == bufferCapacity;
+	}
+
+	/// Number of elements.
+	size_type size() const noexcept
+	{
+		return count;
+	}
+
+	/// Largest power of two the allocator can provide.
+	size_type max_size() const noexcept
+	{
+		size_type limit = AllocatorTraits::max_size(allocator);
+		size_type result = 1;
+		while (result <= limit / 2) {
+			result <<= 1;
+		}
+		return result;
+	}
+
+	/// Number of elements the buffer can hold without allocating. Always zero or a power of two.
+	size_type capacity() const noexcept
+	{
+		return bufferCapacity;
+	}
+
+	/// Grow capacity to the smallest power of two not less than n, if it is less than that.
+	void reserve(size_type n)
+	{
+		if (n > bufferCapacity) {
+			if (n > max_size()) {
+				throw std::length_error("Polymorphic::RingBuffer::reserve");
+			}
+			reallocate(roundUp(n));
+		}
+	}
+
+	/// Shrink capacity to the smallest power of two not less than size(), releasing all memory if empty.
+	void shrink_to_fit()
+	{
+		if (count == 0) {
+			release();
+		} else if (roundUp(count) < bufferCapacity) {
+			reallocate(roundUp(count));
+		}
+	}
+
+	/// Enable or disable overwrite mode. When enabled, pushing into a full buffer discards the element at the opposite end.
+	void set_overwrite(bool enabled) noexcept
+	{
+		overwriteEnabled = enabled;
+	}
+
+	/// True if overwrite mode is enabled.
+	bool overwrites() const noexcept
+	{
+		return overwriteEnabled;
+	}
+
+	/// Resize to n elements, appending value initialized elements or erasing from the back as required.
+	void resize(size_type n)
+	{
+		if (n < count) {
+			truncate(n);
+		} else {
+			reserve(n);
+			while (count < n) {
+				appendBack();
+			}
+		}
+	}
+
+	/// Resize to n elements, appending copies of value or erasing from the back as required.
+	void resize(size_type n, const value_type& value)
+	{
+		if (n < count) {
+			truncate(n);
+		} else {
+			value_type copy(value);
+			reserve(n);
+			while (count < n) {
+				appendBack(copy);
+			}
+		}
+	}
+
+	/// Unchecked access to n-th element.
+	reference operator[](size_type n)
+	{
+		return buffer[slot(n)];
+	}
+
+	/// Unchecked access to n-th element.
+	const_reference operator[](size_type n) const
+	{
+		return buffer[slot(n)];
+	}
+
+	/// Checked access to n-th element, throwing std::out_of_range if n >= size().
+	reference at(size_type n)
+	{
+		checkRange(n);
+		return buffer[slot(n)];
+	}
+
+	/// Checked access to n-th element, throwing std::out_of_range if n >= size().
+	const_reference at(size_type n) const
+	{
+		checkRange(n);
+		return buffer[slot(n)];
+	}
+
+	/// First element.
+	reference front()
+	{
+		return buffer[head];
+	}
+
+	/// First element.
+	const_reference front() const
+	{
+		return buffer[head];
+	}
+
+	/// Last element.
+	reference back()
+	{
+		return buffer[slot(count - 1)];
+	}
+
+	/// Last element.
+	const_reference back() const
+	{
+		return buffer[slot(count - 1)];
+	}
+
+	/// Replace contents by copies of elements in range [first, last).
+	template<typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+	void assign(InputIterator first, InputIterator last)
+	{
+		clear();
+		appendRange(first, last, typename std::iterator_traits<InputIterator>::iterator_category());
+	}
+
+	/// Replace contents by n copies of value.
+	void assign(size_type n, const value_type& value)
+	{
+		value_type copy(value);
+		clear();
+		reserve(n);
+		while (count < n) {
+			appendBack(copy);
+		}
+	}
+
+	/// Replace contents by copies of initializer list elements.
+	void assign(std::initializer_list<value_type> initializerList)
+	{
+		assign(initializerList.begin(), initializerList.end());
+	}
+
+	/// Construct element in front of the first one, growing the buffer or discarding the last element if full.
+	template<class... Args>
+	void emplace_front(Args&&... args)
+	{
+		if (mustOverwrite()) {
+			value_type value(std::forward<Args>(args)...);
+			pop_back();
+			appendFront(std::move(value));
+		} else {
+			appendFront(std::forward<Args>(args)...);
+		}
+	}
+
+	/// Copy element in front of the first one, growing the buffer or discarding the last element if full.
+	void push_front(const value_type& value)
+	{
+		emplace_front(value);
+	}
+
+	/// Move element in front of the first one, growing the buffer or discarding the last element if full.
+	void push_front(value_type&& value)
+	{
+		emplace_front(std::move(value));
+	}
+
+	/// Erase the first element.
+	void pop_front()
+	{
+		AllocatorTraits::destroy(allocator, std::addressof(buffer[head]));
+		head = (head + 1) & (bufferCapacity - 1);
+		--count;
+	}
+
+	/// Construct element behind the last one, growing the buffer or discarding the first element if full.
+	template<class... Args>
+	void emplace_back(Args&&... args)
+	{
+		if (mustOverwrite()) {
+			value_type value(std::forward<Args>(args)...);
+			pop_front();
+			appendBack(std::move(value));
+		} else {
+			appendBack(std::forward<Args>(args)...);
+		}
+	}
+
+	/// Copy element behind the last one, growing the buffer or discarding the first element if full.
+	void push_back(const value_type& value)
+	{
+		emplace_back(value);
+	}
+
+	/// Move element behind the last one, growing the buffer or discarding the first element if full.
+	void push_back(value_type&& value)
+	{
+		emplace_back(std::move(value));
+	}
+
+	/// Erase the last element.
+	void pop_back()
+	{
+		AllocatorTraits::destroy(allocator, std::addressof(buffer[slot(count - 1)]));
+		--count;
+	}
+
+	/// Construct element before position, shifting elements towards the nearer end.
+	template<typename... Args>
+	iterator emplace(const_iterator position, Args&&... args)
+	{
+		size_type offset = position.index;
+		value_type value(std::forward<Args>(args)...);
+		if (offset < count / 2) {
+			appendFront(std::move(value));
+			std::rotate(begin(), begin() + 1, begin() + (offset + 1));
+		} else {
+			appendBack(std::move(value));
+			std::rotate(begin() + offset, end() - 1, end());
+		}
+		return begin() + offset;
+	}
+
+	/// Copy element before position.
+	iterator insert(const_iterator position, const value_type& value)
+	{
+		return emplace(position, value);
+	}
+
+	/// Insert n copies of value before position.
+	iterator insert(const_iterator position, size_type n, const value_type& value)
+	{
+		size_type offset = position.index;
+		size_type oldCount = count;
+		value_type copy(value);
+		reserve(count + n);
+		for (size_type i = 0; i < n; ++i) {
+			appendBack(copy);
+		}
+		std::rotate(begin() + offset, begin() + oldCount, end());
+		return begin() + offset;
+	}
+
+	/// Insert copies of elements in range [first, last) before position.
+	template<typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+	iterator insert(const_iterator position, InputIterator first, InputIterator last)
+	{
+		size_type offset = position.index;
+		size_type oldCount = count;
+		appendRange(first, last, typename std::iterator_traits<InputIterator>::iterator_category());
+		std::rotate(begin() + offset, begin() + oldCount, end());
+		return begin() + offset;
+	}
+
+	/// Move element before position.
+	iterator insert(const_iterator position, value_type&& value)
+	{
+		return emplace(position, std::move(value));
+	}
+
+	/// Insert copies of initializer list elements before position.
+	iterator insert(const_iterator position, std::initializer_list<value_type> initializerList)
+	{
+		return insert(position, initializerList.begin(), initializerList.end());
+	}
+
+	/// Erase element at position, shifting elements from the nearer end.
+	iterator erase(const_iterator position)
+	{
+		return erase(position, position + 1);
+	}
+
+	/// Erase elements in range [first, last), shifting elements from the nearer end.
+	iterator erase(const_iterator first, const_iterator last)
+	{
+		size_type offset = first.index;
+		size_type n = last.index - first.index;
+		if (n == 0) {
+			// Shifting would move elements onto themselves, and self move assignment may empty them.
+			return begin() + offset;
+		}
+		if (offset < count - offset - n) {
+			std::move_backward(begin(), begin() + offset, begin() + (offset + n));
+			for (size_type i = 0; i < n; ++i) {
+				pop_front();
+			}
+		} else {
+			std::move(begin() + (offset + n), end(), begin() + offset);
+			truncate(count - n);
+		}
+		return begin() + offset;
+	}
+
+	/// Exchange contents, capacity, overwrite mode and allocator with other.
+	void swap(RingBuffer& other)
+	{
+		using std::swap;
+		swap(allocator, other.allocator);
+		swap(buffer, other.buffer);
+		swap(bufferCapacity, other.bufferCapacity);
+		swap(head, other.head);
+		swap(count, other.count);
+		swap(overwriteEnabled, other.overwriteEnabled);
+	}
+
+	/// Erase all elements, keeping capacity.
+	void clear() noexcept
+	{
+		truncate(0);
+		head = 0;
+	}
+
+	/// Copy of the allocator.
+	allocator_type get_allocator() const noexcept
+	{
+		return allocator;
+	}
+
+private:
+	template<bool isConst>
+	class Iterator
+	{
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef T value_type;
+		typedef typename RingBuffer::difference_type difference_type;
+		typedef typename std::conditional<isConst, const T*, T*>::type pointer;
+		typedef typename std::conditional<isConst, const T&, T&>::type reference;
+		typedef typename std::conditional<isConst, const RingBuffer*, RingBuffer*>::type ContainerPointer;
+
+		Iterator() noexcept : container(nullptr), index(0)
+		{
+		}
+
+		Iterator(ContainerPointer container, size_type index) noexcept : container(container), index(index)
+		{
+		}
+
+		/// Implicit conversion from iterator to const_iterator.
+		template<bool otherIsConst, typename = typename std::enable_if<isConst && !otherIsConst>::type>
+		Iterator(const Iterator<otherIsConst>& other) noexcept : container(other.container), index(other.index)
+		{
+		}
+
+		reference operator*() const
+		{
+			return (*container)[index];
+		}
+
+		pointer operator->() const
+		{
+			return std::addressof((*container)[index]);
+		}
+
+		reference operator[](difference_type n) const
+		{
+			return (*container)[index + n];
+		}
+
+		Iterator& operator++() noexcept
+		{
+			++index;
+			return *this;
+		}
+
+		Iterator operator++(int) noexcept
+		{
+			Iterator result(*this);
+			++index;
+			return result;
+		}
+
+		Iterator& operator--() noexcept
+		{
+			--index;
+			return *this;
+		}
+
+		Iterator operator--(int) noexcept
+		{
+			Iterator result(*this);
+			--index;
+			return result;
+		}
+
+		Iterator& operator+=(difference_type n) noexcept
+		{
+			index += n;
+			return *this;
+		}
+
+		Iterator& operator-=(difference_type n) noexcept
+		{
+			index -= n;
+			return *this;
+		}
+
+		friend Iterator operator+(Iterator it, difference_type n) noexcept
+		{
+			return it += n;
+		}
+
+		friend Iterator operator+(difference_type n, Iterator it) noexcept
+		{
+			return it += n;
+		}
+
+		friend Iterator operator-(Iterator it, difference_type n) noexcept
+		{
+			return it -= n;
+		}
+
+		friend difference_type operator-(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return static_cast<difference_type>(lhs.index) - static_cast<difference_type>(rhs.index);
+		}
+
+		friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return lhs.index == rhs.index;
+		}
+
+		friend bool operator!=(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return lhs.index != rhs.index;
+		}
+
+		friend bool operator<(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return lhs.index < rhs.index;
+		}
+
+		friend bool operator<=(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return lhs.index <= rhs.index;
+		}
+
+		friend bool operator>(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return lhs.index > rhs.index;
+		}
+
+		friend bool operator>=(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return lhs.index >= rhs.index;
+		}
+
+	private:
+		ContainerPointer container;
+		size_type index;
+
+		friend class Iterator<!isConst>;
+		friend class RingBuffer;
+	};
+
+	allocator_type allocator;
+	pointer buffer;
+	size_type bufferCapacity;
+	size_type head;
+	size_type count;
+	bool overwriteEnabled;
+
+	static size_type roundUp(size_type n) noexcept
+	{
+		size_type result = 1;
+		while (result < n) {
+			result <<= 1;
+		}
+		return result;
+	}
+
+	size_type slot(size_type n) const noexcept
+	{
+		return (head + n) & (bufferCapacity - 1);
+	}
+
+	void checkRange(size_type n) const
+	{
+		if (n >= count) {
+			throw std::out_of_range("Polymorphic::RingBuffer::at");
+		}
+	}
+
+	bool mustOverwrite() const noexcept
+	{
+		return overwriteEnabled && bufferCapacity != 0 && count == bufferCapacity;
+	}
+
+	/// Move elements into a new allocation of newCapacity slots, restarting at slot 0.
+	void reallocate(size_type newCapacity)
+	{
+		pointer newBuffer = AllocatorTraits::allocate(allocator, newCapacity);
+		size_type moved = 0;
+		try {
+			for (; moved < count; ++moved) {
+				AllocatorTraits::construct(
+					allocator, std::addressof(newBuffer[moved]), std::move_if_noexcept(buffer[slot(moved)]));
+			}
+		} catch (...) {
+			while (moved > 0) {
+				AllocatorTraits::destroy(allocator, std::addressof(newBuffer[--moved]));
+			}
+			AllocatorTraits::deallocate(allocator, newBuffer, newCapacity);
+			throw;
+		}
+		size_type oldCount = count;
+		truncate(0);
+		if (bufferCapacity != 0) {
+			AllocatorTraits::deallocate(allocator, buffer, bufferCapacity);
+		}
+		buffer = newBuffer;
+		bufferCapacity = newCapacity;
+		head = 0;
+		count = oldCount;
+	}
+
+	/// Construct element behind the last one, growing the buffer if full.
+	template<typename... Args>
+	void appendBack(Args&&... args)
+	{
+		if (count == bufferCapacity) {
+			value_type value(std::forward<Args>(args)...);
+			reallocate(bufferCapacity == 0 ? 1 : bufferCapacity * 2);
+			AllocatorTraits::construct(allocator, std::addressof(buffer[slot(count)]), std::move(value));
+		} else {
+			AllocatorTraits::construct(allocator, std::addressof(buffer[slot(count)]), std::forward<Args>(args)...);
+		}
+		++count;
+	}
+
+	/// Construct element in front of the first one, growing the buffer if full.
+	template<typename... Args>
+	void appendFront(Args&&... args)
+	{
+		if (count == bufferCapacity) {
+			value_type value(std::forward<Args>(args)...);
+			reallocate(bufferCapacity == 0 ? 1 : bufferCapacity * 2);
+			size_type newHead = (head - 1) & (bufferCapacity - 1);
+			AllocatorTraits::construct(allocator, std::addressof(buffer[newHead]), std::move(value));
+			head = newHead;
+		} else {
+			size_type newHead = (head - 1) & (bufferCapacity - 1);
+			AllocatorTraits::construct(allocator, std::addressof(buffer[newHead]), std::forward<Args>(args)...);
+			head = newHead;
+		}
+		++count;
+	}
+
+	template<typename InputIterator>
+	void appendRange(InputIterator first, InputIterator last, std::input_iterator_tag)
+	{
+		for (; first != last; ++first) {
+			appendBack(*first);
+		}
+	}
+
+	template<typename ForwardIterator>
+	void appendRange(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+	{
+		reserve(count + static_cast<size_type>(std::distance(first, last)));
+		for (; first != last; ++first) {
+			appendBack(*first);
+		}
+	}
+
+	/// Destroy elements from the back until n remain.
+	void truncate(size_type n) noexcept
+	{
+		while (count > n) {
+			pop_back();
+		}
+	}
+
+	/// Destroy all elements and free the allocation.
+	void release() noexcept
+	{
+		clear();
+		if (bufferCapacity != 0) {
+			AllocatorTraits::deallocate(allocator, buffer, bufferCapacity);
+		}
+		buffer = pointer();
+		bufferCapacity = 0;
+	}
+
+	/// Take over allocation and elements of other, leaving other empty without allocation.
+	void steal(RingBuffer& other) noexcept
+	{
+		buffer = other.buffer;
+		bufferCapacity = other.bufferCapacity;
+		head = other.head;
+		count = other.count;
+		overwriteEnabled = other.overwriteEnabled;
+		other.buffer = pointer();
+		other.bufferCapacity = 0;
+		other.head = 0;
+		other.count = 0;
+	}
+};
+
+/// Element-wise comparison.
+template<typename T, typename Allocator>
+bool operator==(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs)
+{
+	return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+/// Element-wise comparison.
+template<typename T, typename Allocator>
+bool operator!=(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs)
+{
+	return !(lhs == rhs);
+}
+
+/// Lexicographical comparison.
+template<typename T, typename Allocator>
+bool operator<(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs)
+{
+	return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+/// Lexicographical comparison.
+template<typename T, typename Allocator>
+bool operator<=(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs)
+{
+	return !(rhs < lhs);
+}
+
+/// Lexicographical comparison.
+template<typename T, typename Allocator>
+bool operator>(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs)
+{
+	return rhs < lhs;
+}
+
+/// Lexicographical comparison.
+template<typename T, typename Allocator>
+bool operator>=(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs)
+{
+	return !(lhs < rhs);
+}
+
+/// Forwarded to RingBuffer<T, Allocator>::swap(RingBuffer& other).
+template<typename T, typename Allocator>
+void swap(RingBuffer<T, Allocator>& lhs, RingBuffer<T, Allocator>& rhs)
+{
+	lhs.swap(rhs);
+}
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_RingBuffer_INCLUDED
@@ -0,0 +1,558 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_Serialization_INCLUDED
+#define Polymorphic_Serialization_INCLUDED
+
+#include "Polymorphic/SerializationFwd.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Polymorphic {
+
+/// Binary image of sequences of trivially copyable elements: a 32 byte header followed by the raw element payload.
+/// Node based containers use chunked streams instead: the header followed by chunks of elements encoded by a codec.
+///
+/// Images are written in native byte order and element layout, so they are meant for checkpoints read back on the same
+/// platform. The header records element size and byte order, and reading an image from a different platform fails.
+namespace serialization {
+
+/// Image format version.
+constexpr std::uint32_t version = 1;
+
+/// Written in native byte order, reading back anything else indicates a foreign platform.
+constexpr std::uint32_t byteOrderMark = 0x01020304;
+
+/// Leading bytes of an image.
+struct Header
+{
+	char magic[4];
+	std::uint32_t version;
+	std::uint32_t elementSize;
+	std::uint32_t byteOrderMark;
+	std::uint64_t count;
+	std::uint64_t reserved;
+};
+
+static_assert(sizeof(Header) == 32, "Header must not be padded");
+
+/// Thrown when an image cannot be written, or is truncated, corrupt or incompatible when read.
+class Error : public std::runtime_error
+{
+public:
+	explicit Error(const std::string& what) : std::runtime_error(what)
+	{
+	}
+};
+
+/// Magic of images of contiguous sequences.
+constexpr const char* contiguousMagic = "PLMV";
+
+/// Magic of chunked streams of node based containers.
+constexpr const char* chunkedMagic = "PLMC";
+
+/// Header of an image of count elements of elementSize bytes.
+inline Header header(std::size_t elementSize, std::size_t count, const char* magic = contiguousMagic)
+{
+	Header result;
+	std::memcpy(result.magic, magic, sizeof(result.magic));
+	result.version = version;
+	result.elementSize = static_cast<std::uint32_t>(elementSize);
+	result.byteOrderMark = byteOrderMark;
+	result.count = count;
+	result.reserved = 0;
+	return result;
+}
+
+/// Validate header against elementSize, 0 for variable size elements. Returns element count.
+inline std::size_t validate(const Header& header, std::size_t elementSize, const char* magic = contiguousMagic)
+{
+	if (std::memcmp(header.magic, magic, sizeof(header.magic)) != 0) {
+		throw Error("Polymorphic::serialization: bad magic");
+	}
+	if (header.byteOrderMark != byteOrderMark) {
+		throw Error("Polymorphic::serialization: foreign byte order");
+	}
+	if (header.version != version) {
+		throw Error("Polymorphic::serialization: unsupported version");
+	}
+	if (header.elementSize != elementSize) {
+		throw Error("Polymorphic::serialization: element size mismatch");
+	}
+	if (elementSize != 0 && header.count > SIZE_MAX / elementSize) {
+		throw Error("Polymorphic::serialization: bad element count");
+	}
+	return static_cast<std::size_t>(header.count);
+}
+
+/// Write size bytes to sink in a single call.
+inline void write(std::ostream& sink, const void* data, std::size_t size)
+{
+	if (size != 0 && !sink.write(static_cast<const char*>(data), static_cast<std::streamsize>(size))) {
+		throw Error("Polymorphic::serialization: write failed");
+	}
+}
+
+/// Read size bytes from source in a single call.
+inline void read(std::istream& source, void* data, std::size_t size)
+{
+	if (size != 0 && !source.read(static_cast<char*>(data), static_cast<std::streamsize>(size))) {
+		throw Error("Polymorphic::serialization: truncated image");
+	}
+}
+
+/// Elements per bulk read or write when staging elements of non contiguous sequences, or growing sequences while
+/// reading. Bounds the memory committed ahead of reading a possibly corrupt header's count.
+template<typename T>
+constexpr std::size_t chunkElements()
+{
+	return sizeof(T) < (1 << 20) ? (1 << 20) / sizeof(T) : 1;
+}
+
+/// Write image of contiguous sequence [data, data + n) to sink.
+template<typename T>
+void serialize(std::ostream& sink, const T* data, std::size_t n)
+{
+	static_assert(std::is_trivially_copyable<T>::value, "Polymorphic::serialization requires trivially copyable T");
+	Header prefix = header(sizeof(T), n);
+	write(sink, &prefix, sizeof(prefix));
+	write(sink, data, n * sizeof(T));
+}
+
+/// Write image of random access sequence [first, first + n) to sink, staging elements in chunks.
+template<typename T, typename RandomAccessIterator>
+void serialize(std::ostream& sink, RandomAccessIterator first, std::size_t n)
+{
+	static_assert(std::is_trivially_copyable<T>::value, "Polymorphic::serialization requires trivially copyable T");
+	Header prefix = header(sizeof(T), n);
+	write(sink, &prefix, sizeof(prefix));
+	std::vector<T> chunk(std::min(n, chunkElements<T>()));
+	for (std::size_t done = 0; done < n; done += chunk.size()) {
+		std::size_t count = std::min(n - done, chunk.size());
+		std::copy(first + done, first + done + count, chunk.begin());
+		write(sink, chunk.data(), count * sizeof(T));
+	}
+}
+
+/// Read image from source, appending its elements to sequence in chunks. Leaves sequence unchanged on failure.
+template<typename Sequence>
+void deserialize(std::istream& source, Sequence& sequence)
+{
+	typedef typename Sequence::value_type T;
+	static_assert(std::is_trivially_copyable<T>::value, "Polymorphic::serialization requires trivially copyable T");
+	Header prefix;
+	read(source, &prefix, sizeof(prefix));
+	std::size_t n = validate(prefix, sizeof(T));
+	std::size_t oldSize = sequence.size();
+	try {
+		std::vector<T> chunk(std::min(n, chunkElements<T>()));
+		for (std::size_t done = 0; done < n; done += chunk.size()) {
+			std::size_t count = std::min(n - done, chunk.size());
+			read(source, chunk.data(), count * sizeof(T));
+			sequence.insert(sequence.end(), chunk.begin(), chunk.begin() + count);
+		}
+	} catch (...) {
+		sequence.erase(sequence.begin() + oldSize, sequence.end());
+		throw;
+	}
+}
+
+/// Read image from source, appending its elements to vector by reading chunks directly into its storage. Leaves vector
+/// unchanged on failure.
+template<typename T, typename Allocator>
+void deserialize(std::istream& source, std::vector<T, Allocator>& vector)
+{
+	static_assert(std::is_trivially_copyable<T>::value, "Polymorphic::serialization requires trivially copyable T");
+	Header prefix;
+	read(source, &prefix, sizeof(prefix));
+	std::size_t n = validate(prefix, sizeof(T));
+	std::size_t oldSize = vector.size();
+	try {
+		for (std::size_t done = 0; done < n;) {
+			std::size_t count = std::min(n - done, chunkElements<T>());
+			vector.resize(oldSize + done + count);
+			read(source, vector.data() + oldSize + done, count * sizeof(T));
+			done += count;
+		}
+	} catch (...) {
+		vector.resize(oldSize);
+		throw;
+	}
+}
+
+/// Element codec of chunked streams, encoding trivially copyable T as its raw bytes. Specialize it, or pass a class
+/// with the same members to the node based containers' serialize() and deserialize(), for other element types.
+template<typename T>
+struct Codec
+{
+	static_assert(std::is_trivially_copyable<T>::value, "Polymorphic::serialization::Codec requires trivially copyable T");
+
+	/// Append encoding of value to buffer.
+	void encode(const T& value, std::vector<char>& buffer) const
+	{
+		const char* bytes = reinterpret_cast<const char*>(&value);
+		buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+	}
+
+	/// Decode value from [next, end), advancing next past its encoding. Throws Error if truncated.
+	T decode(const char*& next, const char* end) const
+	{
+		if (static_cast<std::size_t>(end - next) < sizeof(T)) {
+			throw Error("Polymorphic::serialization: truncated chunk");
+		}
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+		std::memcpy(&storage, next, sizeof(T));
+		next += sizeof(T);
+		return *reinterpret_cast<T*>(&storage);
+	}
+};
+
+/// Codec encoding strings as 64 bit length followed by their characters.
+template<typename Char, typename Traits, typename Allocator>
+struct Codec<std::basic_string<Char, Traits, Allocator>>
+{
+	typedef std::basic_string<Char, Traits, Allocator> StringType;
+
+	void encode(const StringType& value, std::vector<char>& buffer) const
+	{
+		Codec<std::uint64_t>().encode(value.size(), buffer);
+		const char* bytes = reinterpret_cast<const char*>(value.data());
+		buffer.insert(buffer.end(), bytes, bytes + value.size() * sizeof(Char));
+	}
+
+	StringType decode(const char*& next, const char* end) const
+	{
+		std::uint64_t size = Codec<std::uint64_t>().decode(next, end);
+		if (size > static_cast<std::uint64_t>(end - next) / sizeof(Char)) {
+			throw Error("Polymorphic::serialization: truncated chunk");
+		}
+		StringType result(static_cast<std::size_t>(size), Char());
+		std::memcpy(&result[0], next, static_cast<std::size_t>(size) * sizeof(Char));
+		next += size * sizeof(Char);
+		return result;
+	}
+};
+
+/// Codec encoding pairs, such as map entries, as their members' encodings. Decodes keys as non const, so they can be
+/// moved into containers.
+template<typename First, typename Second>
+struct Codec<std::pair<First, Second>>
+{
+	typedef typename std::remove_const<First>::type FirstType;
+	typedef typename std::remove_const<Second>::type SecondType;
+
+	void encode(const std::pair<First, Second>& value, std::vector<char>& buffer) const
+	{
+		Codec<FirstType>().encode(value.first, buffer);
+		Codec<SecondType>().encode(value.second, buffer);
+	}
+
+	std::pair<FirstType, SecondType> decode(const char*& next, const char* end) const
+	{
+		FirstType first = Codec<FirstType>().decode(next, end);
+		SecondType second = Codec<SecondType>().decode(next, end);
+		return std::pair<FirstType, SecondType>(std::move(first), std::move(second));
+	}
+};
+
+/// Leading bytes of a chunk, followed by byteCount bytes encoding elementCount elements.
+struct ChunkHeader
+{
+	std::uint64_t elementCount;
+	std::uint64_t byteCount;
+};
+
+/// Write the count elements in [first, last) to sink as a chunked stream: a header, followed by chunks of encoded
+/// elements, each written by one bulk write once reaching chunkBytes, and an empty chunk. Memory overhead is bounded by
+/// chunkBytes plus the encoding of one element. chunkBytes defaults to defaultChunkBytes, see the declaration in
+/// Polymorphic/SerializationFwd.h. Throws Error if writing fails.
+template<typename InputIterator, typename ElementCodec>
+void write_chunks(
+	std::ostream& sink,
+	InputIterator first,
+	InputIterator last,
+	std::size_t count,
+	const ElementCodec& codec,
+	std::size_t chunkBytes)
+{
+	Header prefix = header(0, count, chunkedMagic);
+	write(sink, &prefix, sizeof(prefix));
+	std::vector<char> buffer(sizeof(ChunkHeader));
+	buffer.reserve(sizeof(ChunkHeader) + chunkBytes);
+	ChunkHeader chunk = {0, 0};
+	auto flush = [&sink, &buffer, &chunk]() {
+		chunk.byteCount = buffer.size() - sizeof(ChunkHeader);
+		std::memcpy(buffer.data(), &chunk, sizeof(chunk));
+		write(sink, buffer.data(), buffer.size());
+		buffer.resize(sizeof(ChunkHeader));
+		chunk.elementCount = 0;
+	};
+	for (; first != last; ++first) {
+		codec.encode(*first, buffer);
+		++chunk.elementCount;
+		if (buffer.size() - sizeof(ChunkHeader) >= chunkBytes) {
+			flush();
+		}
+	}
+	if (chunk.elementCount != 0) {
+		flush();
+	}
+	flush();
+}
+
+/// Read chunked stream from source, one chunk at a time. Calls reserve(n) before decoding elements beyond those reserved
+/// so far, with n growing geometrically up to the element count from its header, then insert(element) for each decoded
+/// element in order. Throws Error if the stream is truncated, corrupt or incompatible, or if it holds a different
+/// number of elements than its header states.
+template<typename ElementCodec, typename Reserve, typename Insert>
+void read_chunks(std::istream& source, const ElementCodec& codec, Reserve reserve, Insert insert)
+{
+	Header prefix;
+	read(source, &prefix, sizeof(prefix));
+	std::uint64_t count = validate(prefix, 0, chunkedMagic);
+	// Reserve up front no more than a default chunk could hold, so a corrupt count cannot commit memory the stream lacks.
+	std::uint64_t reserved = std::min<std::uint64_t>(count, defaultChunkBytes);
+	reserve(static_cast<std::size_t>(reserved));
+	std::uint64_t decoded = 0;
+	std::vector<char> buffer;
+	for (;;) {
+		ChunkHeader chunk;
+		read(source, &chunk, sizeof(chunk));
+		if (chunk.elementCount == 0) {
+			if (chunk.byteCount != 0) {
+				throw Error("Polymorphic::serialization: corrupt chunk");
+			}
+			if (decoded != count) {
+				throw Error("Polymorphic::serialization: bad element count");
+			}
+			return;
+		}
+		if (chunk.elementCount > count - decoded) {
+			throw Error("Polymorphic::serialization: bad element count");
+		}
+		// Grow buffer while reading, so a corrupt byte count cannot commit more memory than the stream holds.
+		buffer.clear();
+		while (buffer.size() < chunk.byteCount) {
+			std::size_t size = buffer.size();
+			buffer.resize(size + static_cast<std::size_t>(std::min<std::uint64_t>(chunk.byteCount - size, 1 << 20)));
+			read(source, buffer.data() + size, buffer.size() - size);
+		}
+		if (decoded + chunk.elementCount > reserved) {
+			reserved = std::min(count, std::max(2 * reserved, decoded + chunk.elementCount));
+			reserve(static_cast<std::size_t>(reserved));
+		}
+		const char* next = buffer.data();
+		const char* end = buffer.data() + buffer.size();
+		for (std::uint64_t i = 0; i < chunk.elementCount; ++i) {
+			insert(codec.decode(next, end));
+		}
+		if (next != end) {
+			throw Error("Polymorphic::serialization: corrupt chunk");
+		}
+		decoded += chunk.elementCount;
+	}
+}
+
+/// Inserter for read_chunks(), emplacing elements into a container.
+template<typename Container>
+class Emplacer
+{
+public:
+	explicit Emplacer(Container& container) : container(container)
+	{
+	}
+
+	template<typename Value>
+	void operator()(Value&& value)
+	{
+		container.emplace(std::forward<Value>(value));
+	}
+
+private:
+	Container& container;
+};
+
+/// Inserter for read_chunks(), emplacing elements into an ordered container with its end as hint. Amortized constant
+/// time per element for ordered input.
+template<typename Container>
+class HintEmplacer
+{
+public:
+	explicit HintEmplacer(Container& container) : container(container)
+	{
+	}
+
+	template<typename Value>
+	void operator()(Value&& value)
+	{
+		container.emplace_hint(container.end(), std::forward<Value>(value));
+	}
+
+private:
+	Container& container;
+};
+
+/// Inserter for read_chunks(), appending elements to a sequence container.
+template<typename Container>
+class BackEmplacer
+{
+public:
+	explicit BackEmplacer(Container& container) : container(container)
+	{
+	}
+
+	template<typename Value>
+	void operator()(Value&& value)
+	{
+		container.emplace_back(std::forward<Value>(value));
+	}
+
+private:
+	Container& container;
+};
+
+/// Inserter for read_chunks(), appending elements to a singly linked list, initially empty.
+template<typename Container>
+class AfterEmplacer
+{
+public:
+	explicit AfterEmplacer(Container& container) : container(container), position(container.before_begin())
+	{
+	}
+
+	template<typename Value>
+	void operator()(Value&& value)
+	{
+		position = container.emplace_after(position, std::forward<Value>(value));
+	}
+
+private:
+	Container& container;
+	typename Container::iterator position;
+};
+
+} // namespace serialization
+
+/// Read only, zero copy view of the elements of a serialized image held in memory, such as a buffer read in one go or
+/// a mapped file. The buffer must outlive the view, and its payload, 32 bytes past its start, must be suitably aligned
+/// for T.
+template<typename T>
+class SerializedView
+{
+public:
+	static_assert(std::is_trivially_copyable<T>::value, "SerializedView requires trivially copyable T");
+
+	typedef T value_type;
+	typedef std::size_t size_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef const T& reference;
+	typedef const T& const_reference;
+	typedef const T* pointer;
+	typedef const T* const_pointer;
+	typedef const T* iterator;
+	typedef const T* const_iterator;
+
+	/// Empty view.
+	SerializedView() noexcept : elements(nullptr), count(0)
+	{
+	}
+
+	/// View of the image in [buffer, buffer + size). Throws serialization::Error if the image is truncated,
+	/// incompatible or misaligned.
+	SerializedView(const void* buffer, std::size_t size) : elements(nullptr), count(0)
+	{
+		serialization::Header prefix;
+		if (size < sizeof(prefix)) {
+			throw serialization::Error("Polymorphic::serialization: truncated image");
+		}
+		std::memcpy(&prefix, buffer, sizeof(prefix));
+		std::size_t n = serialization::validate(prefix, sizeof(T));
+		if (n > (size - sizeof(prefix)) / sizeof(T)) {
+			throw serialization::Error("Polymorphic::serialization: truncated image");
+		}
+		const unsigned char* payload = static_cast<const unsigned char*>(buffer) + sizeof(prefix);
+		if (reinterpret_cast<std::uintptr_t>(payload) % alignof(T) != 0) {
+			throw serialization::Error("Polymorphic::serialization: misaligned image");
+		}
+		elements = reinterpret_cast<const T*>(payload);
+		count = n;
+	}
+
+	/// Iterator to the first element.
+	const_iterator begin() const noexcept
+	{
+		return elements;
+	}
+
+	/// Iterator past the last element.
+	const_iterator end() const noexcept
+	{
+		return elements + count;
+	}
+
+	/// True if there are no elements.
+	bool empty() const noexcept
+	{
+		return count == 0;
+	}
+
+	/// Number of elements.
+	size_type size() const noexcept
+	{
+		return count;
+	}
+
+	/// Element at position n, unchecked.
+	const_reference operator[](size_type n) const
+	{
+		return elements[n];
+	}
+
+	/// Element at position n. Throws std::out_of_range if n >= size().
+	const_reference at(size_type n) const
+	{
+		if (n >= count) {
+			throw std::out_of_range("Polymorphic::SerializedView::at");
+		}
+		return elements[n];
+	}
+
+	/// First element.
+	const_reference front() const
+	{
+		return elements[0];
+	}
+
+	/// Last element.
+	const_reference back() const
+	{
+		return elements[count - 1];
+	}
+
+	/// Pointer to the first element inside the viewed buffer.
+	const_pointer data() const noexcept
+	{
+		return elements;
+	}
+
+private:
+	const T* elements;
+	size_type count;
+};
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_Serialization_INCLUDED
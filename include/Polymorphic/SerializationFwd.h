@@ -0,0 +1,69 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_SerializationFwd_INCLUDED
+#define Polymorphic_SerializationFwd_INCLUDED
+
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+namespace Polymorphic {
+
+/// Declarations of the serialization functions called by the decorators' serialize() and deserialize(), so that
+/// decorators do not pull in the stream headers. Include Polymorphic/Serialization.h to call those members.
+namespace serialization {
+
+class Error;
+
+template<typename T>
+void serialize(std::ostream& sink, const T* data, std::size_t n);
+
+template<typename T, typename RandomAccessIterator>
+void serialize(std::ostream& sink, RandomAccessIterator first, std::size_t n);
+
+template<typename Sequence>
+void deserialize(std::istream& source, Sequence& sequence);
+
+template<typename T, typename Allocator>
+void deserialize(std::istream& source, std::vector<T, Allocator>& vector);
+
+template<typename T>
+struct Codec;
+
+/// Default minimum size of chunks of encoded elements.
+constexpr std::size_t defaultChunkBytes = 1 << 16;
+
+template<typename InputIterator, typename ElementCodec>
+void write_chunks(
+	std::ostream& sink,
+	InputIterator first,
+	InputIterator last,
+	std::size_t count,
+	const ElementCodec& codec,
+	std::size_t chunkBytes = defaultChunkBytes);
+
+template<typename ElementCodec, typename Reserve, typename Insert>
+void read_chunks(std::istream& source, const ElementCodec& codec, Reserve reserve, Insert insert);
+
+template<typename Container>
+class Emplacer;
+
+template<typename Container>
+class HintEmplacer;
+
+template<typename Container>
+class BackEmplacer;
+
+template<typename Container>
+class AfterEmplacer;
+
+} // namespace serialization
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_SerializationFwd_INCLUDED
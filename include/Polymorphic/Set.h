@@ -502,4 +502,16 @@ void swap(const Set<Key, Compare, Allocator>& lhs, const Set<Key, Compare, Alloc
 
 } // namespace Polymorphic
 
+#ifdef POLYMORPHIC_EXTERN_TEMPLATES
+#include <string>
+
+namespace Polymorphic {
+
+// Explicitly instantiated by the Polymorphic::Instantiations library.
+extern template class Set<int>;
+extern template class Set<std::string>;
+
+} // namespace Polymorphic
+#endif // POLYMORPHIC_EXTERN_TEMPLATES
+
 #endif // Polymorphic_Set_INCLUDED
@@ -0,0 +1,1056 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_SlabList_INCLUDED
+#define Polymorphic_SlabList_INCLUDED
+
+#include "Polymorphic/ExecutionFwd.h"
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Polymorphic {
+
+template<typename T, typename Allocator>
+class SlabList;
+
+template<typename T, typename Allocator>
+bool operator==(const SlabList<T, Allocator>& lhs, const SlabList<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+bool operator!=(const SlabList<T, Allocator>& lhs, const SlabList<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+bool operator<(const SlabList<T, Allocator>& lhs, const SlabList<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+bool operator<=(const SlabList<T, Allocator>& lhs, const SlabList<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+bool operator>(const SlabList<T, Allocator>& lhs, const SlabList<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+bool operator>=(const SlabList<T, Allocator>& lhs, const SlabList<T, Allocator>& rhs);
+
+template<typename T, typename Allocator>
+void swap(SlabList<T, Allocator>& lhs, SlabList<T, Allocator>& rhs);
+
+/// Doubly linked list providing the std::list<T> interface, storing nodes in contiguous chunks linked by index.
+///
+/// Nodes are allocated from chunks of a fixed number of slots, and erased nodes are recycled from a free list. Chunks
+/// never move, so references and iterators stay valid until the element is erased, as with std::list. Call compact()
+/// after heavy churn to move elements into consecutive slots in traversal order, restoring the iteration speed of a
+/// vector. compact() invalidates all iterators and references.
+///
+/// Unlike std::list, nodes cannot be handed over between lists. Splicing or merging from another SlabList moves the
+/// elements, invalidating iterators to them, and is linear in the number of elements transferred. Splicing within the
+/// same list, sort(), reverse() and unique() only relink nodes.
+///
+/// Like the decorators, SlabList has a virtual destructor. Add new behavior in subclasses using new virtual members.
+template<typename T, typename Allocator = std::allocator<T>>
+class SlabList
+{
+	typedef std::allocator_traits<Allocator> AllocatorTraits;
+
+	template<bool isConst>
+	class Iterator;
+
+public:
+	typedef T value_type;
+	typedef Allocator allocator_type;
+	typedef value_type& reference;
+	typedef const value_type& const_reference;
+	typedef typename AllocatorTraits::pointer pointer;
+	typedef typename AllocatorTraits::const_pointer const_pointer;
+	typedef Iterator<false> iterator;
+	typedef Iterator<true> const_iterator;
+	typedef std::reverse_iterator<iterator> reverse_iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+	typedef typename AllocatorTraits::difference_type difference_type;
+	typedef typename AllocatorTraits::size_type size_type;
+
+	/// Construct empty list without allocating chunks.
+	explicit SlabList(const allocator_type& allocator = allocator_type()) : allocator(allocator), storage(new Storage())
+	{
+	}
+
+	/// Construct list holding n value initialized elements.
+	explicit SlabList(size_type n) : SlabList()
+	{
+		resize(n);
+	}
+
+	/// Construct list holding n copies of value.
+	SlabList(size_type n, const value_type& value, const allocator_type& allocator = allocator_type()) : SlabList(allocator)
+	{
+		insert(end(), n, value);
+	}
+
+	/// Construct list holding copies of elements in range [first, last).
+	template<typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+	SlabList(InputIterator first, InputIterator last, const allocator_type& allocator = allocator_type()) : SlabList(allocator)
+	{
+		insert(end(), first, last);
+	}
+
+	/// Copy constructor.
+	SlabList(const SlabList& other) : SlabList(other, AllocatorTraits::select_on_container_copy_construction(other.allocator))
+	{
+	}
+
+	/// Copy constructor.
+	SlabList(const SlabList& other, const allocator_type& allocator) : SlabList(allocator)
+	{
+		insert(end(), other.begin(), other.end());
+	}
+
+	/// Move constructor. Iterators to elements of other stay valid and refer to elements of this list.
+	SlabList(SlabList&& other) : SlabList(other.allocator)
+	{
+		storage.swap(other.storage);
+	}
+
+	/// Move constructor.
+	SlabList(SlabList&& other, const allocator_type& allocator) : SlabList(allocator)
+	{
+		if (this->allocator == other.allocator) {
+			storage.swap(other.storage);
+		} else {
+			insert(end(), std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+			other.clear();
+		}
+	}
+
+	/// Construct list holding copies of initializer list elements.
+	SlabList(std::initializer_list<value_type> initializerList, const allocator_type& allocator = allocator_type()) :
+		SlabList(allocator)
+	{
+		insert(end(), initializerList);
+	}
+
+	/// Virtual destructor permitting derived classes to be deleted safely via a SlabList pointer.
+	virtual ~SlabList()
+	{
+		release();
+	}
+
+	/// Copy assignment operator
+	SlabList& operator=(const SlabList& other)
+	{
+		if (this != &other) {
+			assign(other.begin(), other.end());
+		}
+		return *this;
+	}
+
+	/// Move assignment operator
+	SlabList& operator=(SlabList&& other)
+	{
+		if (this != &other) {
+			if (AllocatorTraits::propagate_on_container_move_assignment::value || allocator == other.allocator) {
+				release();
+				if (AllocatorTraits::propagate_on_container_move_assignment::value) {
+					allocator = std::move(other.allocator);
+				}
+				storage.swap(other.storage);
+			} else {
+				assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+				other.clear();
+			}
+		}
+		return *this;
+	}
+
+	/// Initializer list assignment operator
+	SlabList& operator=(std::initializer_list<value_type> initializerList)
+	{
+		assign(initializerList);
+		return *this;
+	}
+
+	/// Iterator to the first element.
+	iterator begin() noexcept
+	{
+		return iterator(storage.get(), storage->anchor.next);
+	}
+
+	/// Iterator to the first element.
+	const_iterator begin() const noexcept
+	{
+		return const_iterator(storage.get(), storage->anchor.next);
+	}
+
+	/// Iterator past the last element.
+	iterator end() noexcept
+	{
+		return iterator(storage.get(), sentinel);
+	}
+
+	/// Iterator past the last element.
+	const_iterator end() const noexcept
+	{
+		return const_iterator(storage.get(), sentinel);
+	}
+
+	/// Reverse iterator to the last element.
+	reverse_iterator rbegin() noexcept
+	{
+		return reverse_iterator(end());
+	}
+
+	/// Reverse iterator to the last element.
+	const_reverse_iterator rbegin() const noexcept
+	{
+		return const_reverse_iterator(end());
+	}
+
+	/// Reverse iterator before the first element.
+	reverse_iterator rend() noexcept
+	{
+		return reverse_iterator(begin());
+	}
+
+	/// Reverse iterator before the first element.
+	const_reverse_iterator rend() const noexcept
+	{
+		return const_reverse_iterator(begin());
+	}
+
+	/// Const iterator to the first element.
+	const_iterator cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	/// Const iterator past the last element.
+	const_iterator cend() const noexcept
+	{
+		return end();
+	}
+
+	/// Const reverse iterator to the last element.
+	const_reverse_iterator crbegin() const noexcept
+	{
+		return rbegin();
+	}
+
+	/// Const reverse iterator before the first element.
+	const_reverse_iterator crend() const noexcept
+	{
+		return rend();
+	}
+
+	/// True if there are no elements.
+	bool empty() const noexcept
+	{
+		return storage->count == 0;
+	}
+
+	/// Number of elements.
+	size_type size() const noexcept
+	{
+		return storage->count;
+	}
+
+	/// Maximum number of elements.
+	size_type max_size() const noexcept
+	{
+		return std::min<size_type>(NodeAllocatorTraits::max_size(NodeAllocator(allocator)), sentinel - 1);
+	}
+
+	/// Number of node slots allocated in chunks, including those of erased elements awaiting reuse.
+	size_type capacity() const noexcept
+	{
+		return storage->chunks.size() * chunkSize;
+	}
+
+	/// First element.
+	reference front()
+	{
+		return storage->value(storage->anchor.next);
+	}
+
+	/// First element.
+	const_reference front() const
+	{
+		return storage->value(storage->anchor.next);
+	}
+
+	/// Last element.
+	reference back()
+	{
+		return storage->value(storage->anchor.prev);
+	}
+
+	/// Last element.
+	const_reference back() const
+	{
+		return storage->value(storage->anchor.prev);
+	}
+
+	/// Replace contents by copies of elements in range [first, last).
+	template<typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+	void assign(InputIterator first, InputIterator last)
+	{
+		clear();
+		insert(end(), first, last);
+	}
+
+	/// Replace contents by n copies of value.
+	void assign(size_type n, const value_type& value)
+	{
+		value_type copy(value);
+		clear();
+		insert(end(), n, copy);
+	}
+
+	/// Replace contents by copies of initializer list elements.
+	void assign(std::initializer_list<value_type> initializerList)
+	{
+		assign(initializerList.begin(), initializerList.end());
+	}
+
+	/// Construct element in front of the first one.
+	template<class... Args>
+	void emplace_front(Args&&... args)
+	{
+		emplace(begin(), std::forward<Args>(args)...);
+	}
+
+	/// Copy element in front of the first one.
+	void push_front(const value_type& value)
+	{
+		emplace(begin(), value);
+	}
+
+	/// Move element in front of the first one.
+	void push_front(value_type&& value)
+	{
+		emplace(begin(), std::move(value));
+	}
+
+	/// Erase the first element.
+	void pop_front()
+	{
+		eraseNode(storage->anchor.next);
+	}
+
+	/// Construct element behind the last one.
+	template<class... Args>
+	void emplace_back(Args&&... args)
+	{
+		emplace(end(), std::forward<Args>(args)...);
+	}
+
+	/// Copy element behind the last one.
+	void push_back(const value_type& value)
+	{
+		emplace(end(), value);
+	}
+
+	/// Move element behind the last one.
+	void push_back(value_type&& value)
+	{
+		emplace(end(), std::move(value));
+	}
+
+	/// Erase the last element.
+	void pop_back()
+	{
+		eraseNode(storage->anchor.prev);
+	}
+
+	/// Construct element before position.
+	template<typename... Args>
+	iterator emplace(const_iterator position, Args&&... args)
+	{
+		size_type index = allocateNode();
+		try {
+			AllocatorTraits::construct(allocator, std::addressof(storage->value(index)), std::forward<Args>(args)...);
+		} catch (...) {
+			freeNode(index);
+			throw;
+		}
+		storage->linkBefore(position.index, index, index);
+		++storage->count;
+		return iterator(storage.get(), index);
+	}
+
+	/// Copy element before position.
+	iterator insert(const_iterator position, const value_type& value)
+	{
+		return emplace(position, value);
+	}
+
+	/// Insert n copies of value before position.
+	iterator insert(const_iterator position, size_type n, const value_type& value)
+	{
+		iterator result(storage.get(), position.index);
+		if (n != 0) {
+			result = emplace(position, value);
+			for (size_type i = 1; i < n; ++i) {
+				emplace(position, value);
+			}
+		}
+		return result;
+	}
+
+	/// Insert copies of elements in range [first, last) before position.
+	template<typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+	iterator insert(const_iterator position, InputIterator first, InputIterator last)
+	{
+		iterator result(storage.get(), position.index);
+		if (first != last) {
+			result = emplace(position, *first);
+			for (++first; first != last; ++first) {
+				emplace(position, *first);
+			}
+		}
+		return result;
+	}
+
+	/// Move element before position.
+	iterator insert(const_iterator position, value_type&& value)
+	{
+		return emplace(position, std::move(value));
+	}
+
+	/// Insert copies of initializer list elements before position.
+	iterator insert(const_iterator position, std::initializer_list<value_type> initializerList)
+	{
+		return insert(position, initializerList.begin(), initializerList.end());
+	}
+
+	/// Erase element at position.
+	iterator erase(const_iterator position)
+	{
+		size_type next = storage->links(position.index).next;
+		eraseNode(position.index);
+		return iterator(storage.get(), next);
+	}
+
+	/// Erase elements in range [first, last).
+	iterator erase(const_iterator first, const_iterator last)
+	{
+		size_type index = first.index;
+		while (index != last.index) {
+			size_type next = storage->links(index).next;
+			eraseNode(index);
+			index = next;
+		}
+		return iterator(storage.get(), last.index);
+	}
+
+	/// Exchange contents and allocator with other. Iterators stay valid, referring to the same elements.
+	void swap(SlabList& other)
+	{
+		using std::swap;
+		swap(allocator, other.allocator);
+		storage.swap(other.storage);
+	}
+
+	/// Resize to n elements, appending value initialized elements or erasing from the back as required.
+	void resize(size_type n)
+	{
+		while (storage->count > n) {
+			pop_back();
+		}
+		while (storage->count < n) {
+			emplace_back();
+		}
+	}
+
+	/// Resize to n elements, appending copies of value or erasing from the back as required.
+	void resize(size_type n, const value_type& value)
+	{
+		while (storage->count > n) {
+			pop_back();
+		}
+		if (storage->count < n) {
+			value_type copy(value);
+			while (storage->count < n) {
+				emplace_back(copy);
+			}
+		}
+	}
+
+	/// Erase all elements, keeping allocated chunks for reuse.
+	void clear() noexcept
+	{
+		destroyAll();
+		storage->reset();
+	}
+
+	/// Move all elements of other before position.
+	void splice(const_iterator position, SlabList& other)
+	{
+		splice(position, other, other.begin(), other.end());
+	}
+
+	/// Move all elements of other before position.
+	void splice(const_iterator position, SlabList&& other)
+	{
+		splice(position, other, other.begin(), other.end());
+	}
+
+	/// Move element i of other before position.
+	void splice(const_iterator position, SlabList& other, const_iterator i)
+	{
+		const_iterator last = i;
+		splice(position, other, i, ++last);
+	}
+
+	/// Move element i of other before position.
+	void splice(const_iterator position, SlabList&& other, const_iterator i)
+	{
+		splice(position, other, i);
+	}
+
+	/// Move elements in range [first, last) of other before position. Relinks nodes if other is this list, moves
+	/// elements otherwise.
+	void splice(const_iterator position, SlabList& other, const_iterator first, const_iterator last)
+	{
+		if (first == last) {
+			return;
+		}
+		if (&other == this) {
+			if (position == first || position == last) {
+				return;
+			}
+			size_type lastIncluded = storage->links(last.index).prev;
+			storage->unlink(first.index, lastIncluded);
+			storage->linkBefore(position.index, first.index, lastIncluded);
+		} else {
+			const_iterator i = first;
+			while (i != last) {
+				emplace(position, std::move(other.storage->value(i.index)));
+				i = other.erase(i);
+			}
+		}
+	}
+
+	/// Move elements in range [first, last) of other before position.
+	void splice(const_iterator position, SlabList&& other, const_iterator first, const_iterator last)
+	{
+		splice(position, other, first, last);
+	}
+
+	/// Erase all elements equal to value.
+	void remove(const value_type& value)
+	{
+		size_type deferred = sentinel;
+		size_type index = storage->anchor.next;
+		while (index != sentinel) {
+			size_type next = storage->links(index).next;
+			if (storage->value(index) == value) {
+				if (std::addressof(storage->value(index)) == std::addressof(value)) {
+					deferred = index;
+				} else {
+					eraseNode(index);
+				}
+			}
+			index = next;
+		}
+		if (deferred != sentinel) {
+			eraseNode(deferred);
+		}
+	}
+
+	/// Erase all elements satisfying predicate.
+	template<typename Predicate>
+	void remove_if(Predicate predicate)
+	{
+		size_type index = storage->anchor.next;
+		while (index != sentinel) {
+			size_type next = storage->links(index).next;
+			if (predicate(storage->value(index))) {
+				eraseNode(index);
+			}
+			index = next;
+		}
+	}
+
+	/// Erase all but the first element of each group of consecutive equal elements.
+	void unique()
+	{
+		unique(std::equal_to<value_type>());
+	}
+
+	/// Erase all but the first element of each group of consecutive elements satisfying predicate.
+	template<typename BinaryPredicate>
+	void unique(BinaryPredicate predicate)
+	{
+		if (storage->count < 2) {
+			return;
+		}
+		size_type first = storage->anchor.next;
+		size_type next = storage->links(first).next;
+		while (next != sentinel) {
+			size_type following = storage->links(next).next;
+			if (predicate(storage->value(first), storage->value(next))) {
+				eraseNode(next);
+			} else {
+				first = next;
+			}
+			next = following;
+		}
+	}
+
+	/// Merge sorted other into this sorted list.
+	void merge(SlabList& other)
+	{
+		merge(other, std::less<value_type>());
+	}
+
+	/// Merge sorted other into this sorted list.
+	void merge(SlabList&& other)
+	{
+		merge(other, std::less<value_type>());
+	}
+
+	/// Merge other into this list, both sorted with respect to compare. Equivalent elements of this list precede those
+	/// of other.
+	template<typename Compare>
+	void merge(SlabList& other, Compare compare)
+	{
+		if (&other == this) {
+			return;
+		}
+		iterator i = begin();
+		iterator j = other.begin();
+		while (j != other.end()) {
+			if (i == end() || compare(*j, *i)) {
+				emplace(i, std::move(*j));
+				j = other.erase(j);
+			} else {
+				++i;
+			}
+		}
+	}
+
+	/// Merge other into this list, both sorted with respect to compare.
+	template<typename Compare>
+	void merge(SlabList&& other, Compare compare)
+	{
+		merge(other, compare);
+	}
+
+	/// Stable sort in ascending order by relinking nodes. Elements are not moved.
+	void sort()
+	{
+		sort(std::less<value_type>());
+	}
+
+	/// Stable sort with respect to compare by relinking nodes. Elements are not moved.
+	template<typename Compare>
+	void sort(Compare compare)
+	{
+		std::vector<size_type> order = positions();
+		std::stable_sort(order.begin(), order.end(), IndexCompare<Compare>(*storage, compare));
+		storage->relink(order);
+	}
+
+	/// Stable sort in ascending order per execution policy by relinking nodes. Elements are not moved.
+	void sort(const execution::sequenced_policy& policy)
+	{
+		sort(policy, std::less<value_type>());
+	}
+
+	/// Stable sort in ascending order per execution policy by relinking nodes. Elements are not moved.
+	void sort(const execution::parallel_policy& policy)
+	{
+		sort(policy, std::less<value_type>());
+	}
+
+	/// Stable sort with respect to compare, sorting a contiguous buffer of node indices per execution policy and
+	/// relinking nodes in buffer order. Elements are not moved. Parallel policies call compare concurrently, so it must
+	/// be safe to do so.
+	template<typename ExecutionPolicy, typename Compare>
+	void sort(const ExecutionPolicy& policy, Compare compare)
+	{
+		std::vector<size_type> order = positions();
+		execution::stable_sort(policy, order.begin(), order.end(), IndexCompare<Compare>(*storage, compare));
+		storage->relink(order);
+	}
+
+	/// Reverse order of elements by relinking nodes.
+	void reverse() noexcept
+	{
+		size_type index = sentinel;
+		do {
+			Links& links = storage->links(index);
+			std::swap(links.prev, links.next);
+			index = links.prev;
+		} while (index != sentinel);
+	}
+
+	/// Move elements into consecutive slots in traversal order and release unused chunks. Invalidates all iterators,
+	/// pointers and references.
+	void compact()
+	{
+		std::unique_ptr<Storage> compacted(new Storage());
+		size_type chunkCount = (storage->count + chunkSize - 1) / chunkSize;
+		NodeAllocator nodeAllocator(allocator);
+		compacted->chunks.reserve(chunkCount);
+		try {
+			for (size_type i = 0; i < chunkCount; ++i) {
+				compacted->chunks.push_back(NodeAllocatorTraits::allocate(nodeAllocator, chunkSize));
+			}
+			for (size_type index = storage->anchor.next; index != sentinel; index = storage->links(index).next) {
+				size_type target = compacted->used;
+				AllocatorTraits::construct(
+					allocator, std::addressof(compacted->value(target)), std::move_if_noexcept(storage->value(index)));
+				++compacted->used;
+				compacted->linkBefore(sentinel, target, target);
+				++compacted->count;
+			}
+		} catch (...) {
+			destroyAll(*compacted);
+			deallocateChunks(*compacted);
+			throw;
+		}
+		release();
+		storage.swap(compacted);
+	}
+
+	/// Copy of the allocator.
+	allocator_type get_allocator() const noexcept
+	{
+		return allocator;
+	}
+
+private:
+	/// Index linking the last element to the first one.
+	static const size_type sentinel = std::numeric_limits<size_type>::max();
+
+	/// Number of node slots per chunk.
+	static const size_type chunkSize = 64;
+
+	struct Links
+	{
+		size_type prev;
+		size_type next;
+	};
+
+	struct Node
+	{
+		Links links;
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type value;
+	};
+
+	typedef typename AllocatorTraits::template rebind_alloc<Node> NodeAllocator;
+	typedef std::allocator_traits<NodeAllocator> NodeAllocatorTraits;
+	typedef typename NodeAllocatorTraits::pointer NodePointer;
+
+	/// Chunks and links, held by pointer so iterators follow the elements on swap and move construction.
+	struct Storage
+	{
+		Storage() : used(0), freeHead(sentinel), count(0)
+		{
+			anchor.prev = SlabList::sentinel;
+			anchor.next = SlabList::sentinel;
+		}
+
+		Node& node(size_type index)
+		{
+			return chunks[index / chunkSize][index % chunkSize];
+		}
+
+		Links& links(size_type index)
+		{
+			return index == SlabList::sentinel ? anchor : node(index).links;
+		}
+
+		T& value(size_type index)
+		{
+			return *reinterpret_cast<T*>(std::addressof(node(index).value));
+		}
+
+		/// Link nodes first to last, already linked to each other, before position.
+		void linkBefore(size_type position, size_type first, size_type last)
+		{
+			size_type prev = links(position).prev;
+			links(prev).next = first;
+			links(first).prev = prev;
+			links(last).next = position;
+			links(position).prev = last;
+		}
+
+		/// Unlink nodes first to last from their neighbours, keeping links between them.
+		void unlink(size_type first, size_type last)
+		{
+			size_type prev = links(first).prev;
+			size_type next = links(last).next;
+			links(prev).next = next;
+			links(next).prev = prev;
+		}
+
+		/// Link all nodes in given order.
+		void relink(const std::vector<size_type>& order)
+		{
+			size_type prev = SlabList::sentinel;
+			for (size_type index : order) {
+				links(prev).next = index;
+				links(index).prev = prev;
+				prev = index;
+			}
+			links(prev).next = SlabList::sentinel;
+			anchor.prev = prev;
+		}
+
+		void reset()
+		{
+			used = 0;
+			freeHead = SlabList::sentinel;
+			count = 0;
+			anchor.prev = SlabList::sentinel;
+			anchor.next = SlabList::sentinel;
+		}
+
+		std::vector<NodePointer> chunks;
+		size_type used;
+		size_type freeHead;
+		size_type count;
+		Links anchor;
+	};
+
+	/// Comparison of node indices by the values they hold.
+	template<typename Compare>
+	struct IndexCompare
+	{
+		IndexCompare(Storage& nodes, Compare& compare) : nodes(nodes), compare(compare)
+		{
+		}
+
+		bool operator()(size_type lhs, size_type rhs) const
+		{
+			return compare(nodes.value(lhs), nodes.value(rhs));
+		}
+
+		Storage& nodes;
+		Compare& compare;
+	};
+
+	template<bool isConst>
+	class Iterator
+	{
+	public:
+		typedef std::bidirectional_iterator_tag iterator_category;
+		typedef T value_type;
+		typedef typename SlabList::difference_type difference_type;
+		typedef typename std::conditional<isConst, const T*, T*>::type pointer;
+		typedef typename std::conditional<isConst, const T&, T&>::type reference;
+
+		Iterator() noexcept : storage(nullptr), index(sentinel)
+		{
+		}
+
+		Iterator(Storage* storage, size_type index) noexcept : storage(storage), index(index)
+		{
+		}
+
+		/// Implicit conversion from iterator to const_iterator.
+		template<bool otherIsConst, typename = typename std::enable_if<isConst && !otherIsConst>::type>
+		Iterator(const Iterator<otherIsConst>& other) noexcept : storage(other.storage), index(other.index)
+		{
+		}
+
+		reference operator*() const
+		{
+			return storage->value(index);
+		}
+
+		pointer operator->() const
+		{
+			return std::addressof(storage->value(index));
+		}
+
+		Iterator& operator++() noexcept
+		{
+			index = storage->links(index).next;
+			return *this;
+		}
+
+		Iterator operator++(int) noexcept
+		{
+			Iterator result(*this);
+			++*this;
+			return result;
+		}
+
+		Iterator& operator--() noexcept
+		{
+			index = storage->links(index).prev;
+			return *this;
+		}
+
+		Iterator operator--(int) noexcept
+		{
+			Iterator result(*this);
+			--*this;
+			return result;
+		}
+
+		friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return lhs.storage == rhs.storage && lhs.index == rhs.index;
+		}
+
+		friend bool operator!=(const Iterator& lhs, const Iterator& rhs) noexcept
+		{
+			return !(lhs == rhs);
+		}
+
+	private:
+		Storage* storage;
+		size_type index;
+
+		friend class Iterator<!isConst>;
+		friend class SlabList;
+	};
+
+	allocator_type allocator;
+	std::unique_ptr<Storage> storage;
+
+	/// Node indices in list order.
+	std::vector<size_type> positions() const
+	{
+		std::vector<size_type> result;
+		result.reserve(storage->count);
+		for (size_type index = storage->anchor.next; index != sentinel; index = storage->links(index).next) {
+			result.push_back(index);
+		}
+		return result;
+	}
+
+	size_type allocateNode()
+	{
+		size_type index;
+		if (storage->freeHead != sentinel) {
+			index = storage->freeHead;
+			storage->freeHead = storage->node(index).links.next;
+		} else {
+			if (storage->used == storage->chunks.size() * chunkSize) {
+				NodeAllocator nodeAllocator(allocator);
+				// Reserve before allocating the chunk, so that it cannot leak, growing geometrically as push_back would.
+				if (storage->chunks.size() == storage->chunks.capacity()) {
+					storage->chunks.reserve(2 * storage->chunks.size() + 1);
+				}
+				storage->chunks.push_back(NodeAllocatorTraits::allocate(nodeAllocator, chunkSize));
+			}
+			index = storage->used++;
+		}
+		return index;
+	}
+
+	void freeNode(size_type index) noexcept
+	{
+		storage->node(index).links.next = storage->freeHead;
+		storage->freeHead = index;
+	}
+
+	void eraseNode(size_type index) noexcept
+	{
+		storage->unlink(index, index);
+		AllocatorTraits::destroy(allocator, std::addressof(storage->value(index)));
+		freeNode(index);
+		--storage->count;
+	}
+
+	void destroyAll(Storage& nodes) noexcept
+	{
+		for (size_type index = nodes.anchor.next; index != sentinel; index = nodes.links(index).next) {
+			AllocatorTraits::destroy(allocator, std::addressof(nodes.value(index)));
+		}
+	}
+
+	void destroyAll() noexcept
+	{
+		destroyAll(*storage);
+	}
+
+	void deallocateChunks(Storage& nodes) noexcept
+	{
+		NodeAllocator nodeAllocator(allocator);
+		for (auto chunk : nodes.chunks) {
+			NodeAllocatorTraits::deallocate(nodeAllocator, chunk, chunkSize);
+		}
+		nodes.chunks.clear();
+	}
+
+	/// Destroy all elements and release all chunks.
+	void release() noexcept
+	{
+		destroyAll();
+		deallocateChunks(*storage);
+		storage->reset();
+	}
+};
+
+template<typename T, typename Allocator>
+const typename SlabList<T, Allocator>::size_type SlabList<T, Allocator>::sentinel;
+
+template<typename T, typename Allocator>
+const typename SlabList<T, Allocator>::size_type SlabList<T, Allocator>::chunkSize;
+
+/// Element-wise comparison.
+template<typename T, typename Allocator>
+bool operator==(const SlabList<T, Allocator>& lhs, const SlabList<T, Allocator>& rhs)
+{
+	return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+/// Element-wise comparison.
+template<typename T, typename Allocator>
+bool operator!=(const SlabList<T, Allocator>& lhs, const SlabList<T, Allocator>& rhs)
+{
+	return !(lhs == rhs);
+}
+
+/// Lexicographical comparison.
+template<typename T, typename Allocator>
+bool operator<(const SlabList<T, Allocator>& lhs, const SlabList<T, Allocator>& rhs)
+{
+	return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+/// Lexicographical comparison.
+template<typename T, typename Allocator>
+bool operator<=(const SlabList<T, Allocator>& lhs, const SlabList<T, Allocator>& rhs)
+{
+	return !(rhs < lhs);
+}
+
+/// Lexicographical comparison.
+template<typename T, typename Allocator>
+bool operator>(const SlabList<T, Allocator>& lhs, const SlabList<T, Allocator>& rhs)
+{
+	return rhs < lhs;
+}
+
+/// Lexicographical comparison.
+template<typename T, typename Allocator>
+bool operator>=(const SlabList<T, Allocator>& lhs, const SlabList<T, Allocator>& rhs)
+{
+	return !(lhs < rhs);
+}
+
+/// Forwarded to SlabList<T, Allocator>::swap(SlabList& other).
+template<typename T, typename Allocator>
+void swap(SlabList<T, Allocator>& lhs, SlabList<T, Allocator>& rhs)
+{
+	lhs.swap(rhs);
+}
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_SlabList_INCLUDED
@@ -0,0 +1,216 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_Stack_INCLUDED
+#define Polymorphic_Stack_INCLUDED
+
+#include "Polymorphic/Deque.h"
+#include <utility>
+
+namespace Polymorphic {
+
+template<typename T, typename Container>
+class Stack;
+
+template<typename T, typename Container>
+bool operator==(const Stack<T, Container>& lhs, const Stack<T, Container>& rhs);
+
+template<typename T, typename Container>
+bool operator!=(const Stack<T, Container>& lhs, const Stack<T, Container>& rhs);
+
+template<typename T, typename Container>
+bool operator<(const Stack<T, Container>& lhs, const Stack<T, Container>& rhs);
+
+template<typename T, typename Container>
+bool operator<=(const Stack<T, Container>& lhs, const Stack<T, Container>& rhs);
+
+template<typename T, typename Container>
+bool operator>(const Stack<T, Container>& lhs, const Stack<T, Container>& rhs);
+
+template<typename T, typename Container>
+bool operator>=(const Stack<T, Container>& lhs, const Stack<T, Container>& rhs);
+
+/// LIFO adaptor providing the std::stack<T, Container> interface, with a virtual destructor.
+///
+/// Container defaults to Polymorphic::Deque<T>, but any sequence with back(), push_back() and pop_back() will do.
+/// Polymorphic::Vector<T> keeps all elements in a single allocation, which reserve() can size up front. Like those of
+/// std::stack, derived classes have access to the protected container c.
+template<typename T, typename Container = Deque<T>>
+class Stack
+{
+public:
+	typedef Container container_type;
+	typedef typename Container::value_type value_type;
+	typedef typename Container::size_type size_type;
+	typedef typename Container::reference reference;
+	typedef typename Container::const_reference const_reference;
+
+	/// Construct stack from a copy of container.
+	explicit Stack(const Container& container) : c(container)
+	{
+	}
+
+	/// Construct stack from container.
+	explicit Stack(Container&& container = Container()) : c(std::move(container))
+	{
+	}
+
+	/// Virtual destructor permitting derived classes to be deleted safely via a Stack pointer.
+	virtual ~Stack()
+	{
+	}
+
+	/// Forwarded to Container::empty().
+	bool empty() const
+	{
+		return c.empty();
+	}
+
+	/// Forwarded to Container::size().
+	size_type size() const
+	{
+		return c.size();
+	}
+
+	/// Forwarded to Container::back().
+	reference top()
+	{
+		return c.back();
+	}
+
+	/// Forwarded to Container::back() const.
+	const_reference top() const
+	{
+		return c.back();
+	}
+
+	/// Forwarded to Container::push_back(const value_type& value).
+	void push(const value_type& value)
+	{
+		c.push_back(value);
+	}
+
+	/// Forwarded to Container::push_back(value_type&& value).
+	void push(value_type&& value)
+	{
+		c.push_back(std::move(value));
+	}
+
+	/// Forwarded to Container::emplace_back(Args&&... args).
+	template<typename... Args>
+	void emplace(Args&&... args)
+	{
+		c.emplace_back(std::forward<Args>(args)...);
+	}
+
+	/// Forwarded to Container::pop_back().
+	void pop()
+	{
+		c.pop_back();
+	}
+
+	/// Push elements of [first, last) in order, the last one ending up on top. Forwarded to Container::insert(end(),
+	/// first, last), inserting in bulk.
+	template<typename InputIterator>
+	void push_range(InputIterator first, InputIterator last)
+	{
+		c.insert(c.end(), first, last);
+	}
+
+	/// Pop n elements, n not exceeding size().
+	void pop_n(size_type n)
+	{
+		for (; n != 0; --n) {
+			c.pop_back();
+		}
+	}
+
+	/// Swap elements with other.
+	void swap(Stack& other)
+	{
+		c.swap(other.c);
+	}
+
+	/// Forwarded to Container::reserve(size_type n). Available if the container has reserve().
+	template<typename C = Container>
+	auto reserve(size_type n) -> decltype(std::declval<C&>().reserve(n))
+	{
+		return c.reserve(n);
+	}
+
+	/// Forwarded to Container::capacity(). Available if the container has capacity().
+	template<typename C = Container>
+	auto capacity() const -> decltype(std::declval<const C&>().capacity())
+	{
+		return c.capacity();
+	}
+
+protected:
+	Container c;
+
+	// clang-format off
+	friend bool operator== <T, Container>(const Stack& lhs, const Stack& rhs);
+	friend bool operator!= <T, Container>(const Stack& lhs, const Stack& rhs);
+	friend bool operator< <T, Container>(const Stack& lhs, const Stack& rhs);
+	friend bool operator<= <T, Container>(const Stack& lhs, const Stack& rhs);
+	friend bool operator> <T, Container>(const Stack& lhs, const Stack& rhs);
+	friend bool operator>= <T, Container>(const Stack& lhs, const Stack& rhs);
+	// clang-format on
+};
+
+/// Forwarded to operator==(const Container& lhs, const Container& rhs).
+template<typename T, typename Container>
+bool operator==(const Stack<T, Container>& lhs, const Stack<T, Container>& rhs)
+{
+	return lhs.c == rhs.c;
+}
+
+/// Forwarded to operator!=(const Container& lhs, const Container& rhs).
+template<typename T, typename Container>
+bool operator!=(const Stack<T, Container>& lhs, const Stack<T, Container>& rhs)
+{
+	return lhs.c != rhs.c;
+}
+
+/// Forwarded to operator<(const Container& lhs, const Container& rhs).
+template<typename T, typename Container>
+bool operator<(const Stack<T, Container>& lhs, const Stack<T, Container>& rhs)
+{
+	return lhs.c < rhs.c;
+}
+
+/// Forwarded to operator<=(const Container& lhs, const Container& rhs).
+template<typename T, typename Container>
+bool operator<=(const Stack<T, Container>& lhs, const Stack<T, Container>& rhs)
+{
+	return lhs.c <= rhs.c;
+}
+
+/// Forwarded to operator>(const Container& lhs, const Container& rhs).
+template<typename T, typename Container>
+bool operator>(const Stack<T, Container>& lhs, const Stack<T, Container>& rhs)
+{
+	return lhs.c > rhs.c;
+}
+
+/// Forwarded to operator>=(const Container& lhs, const Container& rhs).
+template<typename T, typename Container>
+bool operator>=(const Stack<T, Container>& lhs, const Stack<T, Container>& rhs)
+{
+	return lhs.c >= rhs.c;
+}
+
+/// Swap elements of lhs and rhs.
+template<typename T, typename Container>
+void swap(Stack<T, Container>& lhs, Stack<T, Container>& rhs)
+{
+	lhs.swap(rhs);
+}
+
+} // namespace Polymorphic
+
+#endif // Polymorphic_Stack_INCLUDED
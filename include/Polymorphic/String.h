@@ -0,0 +1,1319 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Polymorphic_String_INCLUDED
+#define Polymorphic_String_INCLUDED
+
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+namespace Polymorphic {
+
+/// Polymorphic decorator composing std::basic_string<CharT> with the sole purpose of adding a virtual destructor..
+///
+/// Classes derived from Polymorphic::BasicString<CharT> can be safely used as targets of smart pointers.
+/// Note: forwarding member functions are *not* declared virtual! They are not meant to be overriden
+/// in subclasses. Add new behavior using new virtual members instead.
+///
+/// The delegate is held by value, so short strings keep using its small string buffer. Members taking another string
+/// accept both decorators and std::basic_string<CharT>, the former converting implicitly to its delegate.
+template<typename CharT, typename Traits = std::char_traits<CharT>, typename Allocator = std::allocator<CharT>>
+class BasicString
+{
+public:
+	typedef std::basic_string<CharT, Traits, Allocator> DelegateType;
+	typedef Traits traits_type;
+	typedef typename Traits::char_type value_type;
+	typedef Allocator allocator_type;
+	typedef typename DelegateType::size_type size_type;
+	typedef typename DelegateType::difference_type difference_type;
+	typedef typename DelegateType::reference reference;
+	typedef typename DelegateType::const_reference const_reference;
+	typedef typename DelegateType::pointer pointer;
+	typedef typename DelegateType::const_pointer const_pointer;
+	typedef typename DelegateType::iterator iterator;
+	typedef typename DelegateType::const_iterator const_iterator;
+	typedef typename DelegateType::reverse_iterator reverse_iterator;
+	typedef typename DelegateType::const_reverse_iterator const_reverse_iterator;
+
+	/// Forwarded to std::basic_string<CharT>::npos.
+	static const size_type npos = DelegateType::npos;
+
+	/// Forwarded to std::basic_string<CharT>::basic_string(const allocator_type& allocator = allocator_type()).
+	explicit BasicString(const allocator_type& allocator = allocator_type()) : delegate(allocator)
+	{
+	}
+
+	/// Copy constructor.
+	BasicString(const BasicString& other) : delegate(other.delegate)
+	{
+	}
+
+	/// Copy constructor.
+	BasicString(const BasicString& other, const allocator_type& allocator) : delegate(other.delegate, allocator)
+	{
+	}
+
+	/// Move constructor.
+	BasicString(BasicString&& other) noexcept : delegate(std::move(other.delegate))
+	{
+	}
+
+	/// Move constructor.
+	BasicString(BasicString&& other, const allocator_type& allocator) : delegate(std::move(other.delegate), allocator)
+	{
+	}
+
+	/// Forwarded to std::basic_string<CharT>::basic_string(const basic_string& str, size_type pos, size_type n = npos,
+	/// const allocator_type& allocator = allocator_type()).
+	BasicString(
+		const DelegateType& str, size_type pos, size_type n = npos, const allocator_type& allocator = allocator_type()) :
+		delegate(str, pos, n, allocator)
+	{
+	}
+
+	/// Forwarded to std::basic_string<CharT>::basic_string(const CharT* s, size_type n, const allocator_type& allocator =
+	/// allocator_type()).
+	BasicString(const CharT* s, size_type n, const allocator_type& allocator = allocator_type()) : delegate(s, n, allocator)
+	{
+	}
+
+	/// Forwarded to std::basic_string<CharT>::basic_string(const CharT* s, const allocator_type& allocator =
+	/// allocator_type()).
+	BasicString(const CharT* s, const allocator_type& allocator = allocator_type()) : delegate(s, allocator)
+	{
+	}
+
+	/// Forwarded to std::basic_string<CharT>::basic_string(size_type n, CharT c, const allocator_type& allocator =
+	/// allocator_type()).
+	BasicString(size_type n, CharT c, const allocator_type& allocator = allocator_type()) : delegate(n, c, allocator)
+	{
+	}
+
+	/// Forwarded to std::basic_string<CharT>::basic_string(InputIterator first, InputIterator last, const allocator_type&
+	/// allocator = allocator_type()).
+	template<typename InputIterator>
+	BasicString(InputIterator first, InputIterator last, const allocator_type& allocator = allocator_type()) :
+		delegate(first, last, allocator)
+	{
+	}
+
+	/// Forwarded to std::basic_string<CharT>::basic_string(std::initializer_list<CharT> initializerList, const
+	/// allocator_type& allocator = allocator_type()).
+	BasicString(std::initializer_list<CharT> initializerList, const allocator_type& allocator = allocator_type()) :
+		delegate(initializerList, allocator)
+	{
+	}
+
+	/// Copy construct from std::basic_string<CharT>.
+	BasicString(const DelegateType& other) : delegate(other)
+	{
+	}
+
+	/// Move construct from std::basic_string<CharT>.
+	BasicString(DelegateType&& other) noexcept : delegate(std::move(other))
+	{
+	}
+
+	/// Virtual destructor permitting derived classes to be deleted safely via a BasicString pointer.
+	virtual ~BasicString()
+	{
+	}
+
+	/// Copy assignment operator
+	BasicString& operator=(const BasicString& other)
+	{
+		delegate = other.delegate;
+		return *this;
+	}
+
+	/// Move assignment operator
+	BasicString& operator=(BasicString&& other)
+	{
+		delegate = std::move(other.delegate);
+		return *this;
+	}
+
+	/// Copy assignment from std::basic_string<CharT>.
+	BasicString& operator=(const DelegateType& other)
+	{
+		delegate = other;
+		return *this;
+	}
+
+	/// Move assignment from std::basic_string<CharT>.
+	BasicString& operator=(DelegateType&& other)
+	{
+		delegate = std::move(other);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::operator=(const CharT* s).
+	BasicString& operator=(const CharT* s)
+	{
+		delegate = s;
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::operator=(CharT c).
+	BasicString& operator=(CharT c)
+	{
+		delegate = c;
+		return *this;
+	}
+
+	/// Initializer list assignment operator
+	BasicString& operator=(std::initializer_list<CharT> initializerList)
+	{
+		delegate = initializerList;
+		return *this;
+	}
+
+	/// Implicit type conversion into std::basic_string<CharT> reference.
+	operator DelegateType&()
+	{
+		return delegate;
+	}
+
+	/// Implicit type conversion into const std::basic_string<CharT> reference.
+	operator const DelegateType&() const
+	{
+		return delegate;
+	}
+
+	/// Explicit type conversion into std::basic_string<CharT> rvalue reference.
+	explicit operator DelegateType &&()
+	{
+		return std::move(delegate);
+	}
+
+#if __cplusplus >= 201703L
+	/// Implicit type conversion into std::basic_string_view<CharT>, available since C++17.
+	operator std::basic_string_view<CharT, Traits>() const noexcept
+	{
+		return delegate;
+	}
+#endif
+
+	/// Forwarded to std::basic_string<CharT>::begin() noexcept.
+	iterator begin() noexcept
+	{
+		return delegate.begin();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::begin() const noexcept.
+	const_iterator begin() const noexcept
+	{
+		return delegate.begin();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::end() noexcept.
+	iterator end() noexcept
+	{
+		return delegate.end();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::end() const noexcept.
+	const_iterator end() const noexcept
+	{
+		return delegate.end();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::rbegin() noexcept.
+	reverse_iterator rbegin() noexcept
+	{
+		return delegate.rbegin();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::rbegin() const noexcept.
+	const_reverse_iterator rbegin() const noexcept
+	{
+		return delegate.rbegin();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::rend() noexcept.
+	reverse_iterator rend() noexcept
+	{
+		return delegate.rend();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::rend() const noexcept.
+	const_reverse_iterator rend() const noexcept
+	{
+		return delegate.rend();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::cbegin() const noexcept.
+	const_iterator cbegin() const noexcept
+	{
+		return delegate.cbegin();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::cend() const noexcept.
+	const_iterator cend() const noexcept
+	{
+		return delegate.cend();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::crbegin() const noexcept.
+	const_reverse_iterator crbegin() const noexcept
+	{
+		return delegate.crbegin();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::crend() const noexcept.
+	const_reverse_iterator crend() const noexcept
+	{
+		return delegate.crend();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::size() const noexcept.
+	size_type size() const noexcept
+	{
+		return delegate.size();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::length() const noexcept.
+	size_type length() const noexcept
+	{
+		return delegate.length();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::max_size() const noexcept.
+	size_type max_size() const noexcept
+	{
+		return delegate.max_size();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::resize(size_type n).
+	void resize(size_type n)
+	{
+		delegate.resize(n);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::resize(size_type n, CharT c).
+	void resize(size_type n, CharT c)
+	{
+		delegate.resize(n, c);
+	}
+
+	/// Resize to at most n characters written by operation(pointer p, size_type n), which returns the number of
+	/// characters to keep. Forwarded to std::basic_string<CharT>::resize_and_overwrite where the standard library has
+	/// it, which leaves the characters uninitialized for operation. Otherwise they are value initialized first.
+	template<typename Operation>
+	void resize_and_overwrite(size_type n, Operation operation)
+	{
+#if defined(__cpp_lib_string_resize_and_overwrite)
+		delegate.resize_and_overwrite(n, std::move(operation));
+#else
+		delegate.resize(n);
+		size_type kept = static_cast<size_type>(operation(&delegate[0], n));
+		delegate.erase(kept);
+#endif
+	}
+
+	/// Forwarded to std::basic_string<CharT>::capacity() const noexcept.
+	size_type capacity() const noexcept
+	{
+		return delegate.capacity();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::reserve(size_type n = 0).
+	void reserve(size_type n = 0)
+	{
+		delegate.reserve(n);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::shrink_to_fit().
+	void shrink_to_fit()
+	{
+		delegate.shrink_to_fit();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::clear() noexcept.
+	void clear() noexcept
+	{
+		delegate.clear();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::empty() const noexcept.
+	bool empty() const noexcept
+	{
+		return delegate.empty();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::operator[](size_type pos).
+	reference operator[](size_type pos)
+	{
+		return delegate[pos];
+	}
+
+	/// Forwarded to std::basic_string<CharT>::operator[](size_type pos) const.
+	const_reference operator[](size_type pos) const
+	{
+		return delegate[pos];
+	}
+
+	/// Forwarded to std::basic_string<CharT>::at(size_type pos).
+	reference at(size_type pos)
+	{
+		return delegate.at(pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::at(size_type pos) const.
+	const_reference at(size_type pos) const
+	{
+		return delegate.at(pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::front().
+	reference front()
+	{
+		return delegate.front();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::front() const.
+	const_reference front() const
+	{
+		return delegate.front();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::back().
+	reference back()
+	{
+		return delegate.back();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::back() const.
+	const_reference back() const
+	{
+		return delegate.back();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::operator+=(const basic_string& str).
+	BasicString& operator+=(const DelegateType& str)
+	{
+		delegate += str;
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::operator+=(const CharT* s).
+	BasicString& operator+=(const CharT* s)
+	{
+		delegate += s;
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::operator+=(CharT c).
+	BasicString& operator+=(CharT c)
+	{
+		delegate += c;
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::operator+=(std::initializer_list<CharT> initializerList).
+	BasicString& operator+=(std::initializer_list<CharT> initializerList)
+	{
+		delegate += initializerList;
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::append(const basic_string& str).
+	BasicString& append(const DelegateType& str)
+	{
+		delegate.append(str);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::append(const basic_string& str, size_type pos, size_type n = npos).
+	BasicString& append(const DelegateType& str, size_type pos, size_type n = npos)
+	{
+		delegate.append(str, pos, n);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::append(const CharT* s, size_type n).
+	BasicString& append(const CharT* s, size_type n)
+	{
+		delegate.append(s, n);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::append(const CharT* s).
+	BasicString& append(const CharT* s)
+	{
+		delegate.append(s);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::append(size_type n, CharT c).
+	BasicString& append(size_type n, CharT c)
+	{
+		delegate.append(n, c);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::append(InputIterator first, InputIterator last).
+	template<typename InputIterator>
+	BasicString& append(InputIterator first, InputIterator last)
+	{
+		delegate.append(first, last);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::append(std::initializer_list<CharT> initializerList).
+	BasicString& append(std::initializer_list<CharT> initializerList)
+	{
+		delegate.append(initializerList);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::push_back(CharT c).
+	void push_back(CharT c)
+	{
+		delegate.push_back(c);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::assign(const basic_string& str).
+	BasicString& assign(const DelegateType& str)
+	{
+		delegate.assign(str);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::assign(basic_string&& str).
+	BasicString& assign(DelegateType&& str)
+	{
+		delegate.assign(std::move(str));
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::assign(basic_string&& str).
+	BasicString& assign(BasicString&& str)
+	{
+		delegate.assign(std::move(str.delegate));
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::assign(const basic_string& str, size_type pos, size_type n = npos).
+	BasicString& assign(const DelegateType& str, size_type pos, size_type n = npos)
+	{
+		delegate.assign(str, pos, n);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::assign(const CharT* s, size_type n).
+	BasicString& assign(const CharT* s, size_type n)
+	{
+		delegate.assign(s, n);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::assign(const CharT* s).
+	BasicString& assign(const CharT* s)
+	{
+		delegate.assign(s);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::assign(size_type n, CharT c).
+	BasicString& assign(size_type n, CharT c)
+	{
+		delegate.assign(n, c);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::assign(InputIterator first, InputIterator last).
+	template<typename InputIterator>
+	BasicString& assign(InputIterator first, InputIterator last)
+	{
+		delegate.assign(first, last);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::assign(std::initializer_list<CharT> initializerList).
+	BasicString& assign(std::initializer_list<CharT> initializerList)
+	{
+		delegate.assign(initializerList);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::insert(size_type pos, const basic_string& str).
+	BasicString& insert(size_type pos, const DelegateType& str)
+	{
+		delegate.insert(pos, str);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::insert(size_type pos1, const basic_string& str, size_type pos2, size_type n
+	/// = npos).
+	BasicString& insert(size_type pos1, const DelegateType& str, size_type pos2, size_type n = npos)
+	{
+		delegate.insert(pos1, str, pos2, n);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::insert(size_type pos, const CharT* s, size_type n).
+	BasicString& insert(size_type pos, const CharT* s, size_type n)
+	{
+		delegate.insert(pos, s, n);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::insert(size_type pos, const CharT* s).
+	BasicString& insert(size_type pos, const CharT* s)
+	{
+		delegate.insert(pos, s);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::insert(size_type pos, size_type n, CharT c).
+	BasicString& insert(size_type pos, size_type n, CharT c)
+	{
+		delegate.insert(pos, n, c);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::insert(const_iterator position, CharT c).
+	iterator insert(const_iterator position, CharT c)
+	{
+		return delegate.insert(position, c);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::insert(const_iterator position, size_type n, CharT c).
+	iterator insert(const_iterator position, size_type n, CharT c)
+	{
+		return delegate.insert(position, n, c);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::insert(const_iterator position, InputIterator first, InputIterator last).
+	template<typename InputIterator>
+	iterator insert(const_iterator position, InputIterator first, InputIterator last)
+	{
+		return delegate.insert(position, first, last);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::insert(const_iterator position, std::initializer_list<CharT>
+	/// initializerList).
+	iterator insert(const_iterator position, std::initializer_list<CharT> initializerList)
+	{
+		return delegate.insert(position, initializerList);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::erase(size_type pos = 0, size_type n = npos).
+	BasicString& erase(size_type pos = 0, size_type n = npos)
+	{
+		delegate.erase(pos, n);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::erase(const_iterator position).
+	iterator erase(const_iterator position)
+	{
+		return delegate.erase(position);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::erase(const_iterator first, const_iterator last).
+	iterator erase(const_iterator first, const_iterator last)
+	{
+		return delegate.erase(first, last);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::pop_back().
+	void pop_back()
+	{
+		delegate.pop_back();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::replace(size_type pos1, size_type n1, const basic_string& str).
+	BasicString& replace(size_type pos1, size_type n1, const DelegateType& str)
+	{
+		delegate.replace(pos1, n1, str);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::replace(size_type pos1, size_type n1, const basic_string& str, size_type
+	/// pos2, size_type n2 = npos).
+	BasicString& replace(size_type pos1, size_type n1, const DelegateType& str, size_type pos2, size_type n2 = npos)
+	{
+		delegate.replace(pos1, n1, str, pos2, n2);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::replace(size_type pos, size_type n1, const CharT* s, size_type n2).
+	BasicString& replace(size_type pos, size_type n1, const CharT* s, size_type n2)
+	{
+		delegate.replace(pos, n1, s, n2);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::replace(size_type pos, size_type n1, const CharT* s).
+	BasicString& replace(size_type pos, size_type n1, const CharT* s)
+	{
+		delegate.replace(pos, n1, s);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::replace(size_type pos, size_type n1, size_type n2, CharT c).
+	BasicString& replace(size_type pos, size_type n1, size_type n2, CharT c)
+	{
+		delegate.replace(pos, n1, n2, c);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::replace(const_iterator i1, const_iterator i2, const basic_string& str).
+	BasicString& replace(const_iterator i1, const_iterator i2, const DelegateType& str)
+	{
+		delegate.replace(i1, i2, str);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::replace(const_iterator i1, const_iterator i2, const CharT* s, size_type n).
+	BasicString& replace(const_iterator i1, const_iterator i2, const CharT* s, size_type n)
+	{
+		delegate.replace(i1, i2, s, n);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::replace(const_iterator i1, const_iterator i2, const CharT* s).
+	BasicString& replace(const_iterator i1, const_iterator i2, const CharT* s)
+	{
+		delegate.replace(i1, i2, s);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::replace(const_iterator i1, const_iterator i2, size_type n, CharT c).
+	BasicString& replace(const_iterator i1, const_iterator i2, size_type n, CharT c)
+	{
+		delegate.replace(i1, i2, n, c);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::replace(const_iterator i1, const_iterator i2, InputIterator first,
+	/// InputIterator last).
+	template<typename InputIterator>
+	BasicString& replace(const_iterator i1, const_iterator i2, InputIterator first, InputIterator last)
+	{
+		delegate.replace(i1, i2, first, last);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::replace(const_iterator i1, const_iterator i2, std::initializer_list<CharT>
+	/// initializerList).
+	BasicString& replace(const_iterator i1, const_iterator i2, std::initializer_list<CharT> initializerList)
+	{
+		delegate.replace(i1, i2, initializerList);
+		return *this;
+	}
+
+	/// Forwarded to std::basic_string<CharT>::copy(CharT* s, size_type n, size_type pos = 0) const.
+	size_type copy(CharT* s, size_type n, size_type pos = 0) const
+	{
+		return delegate.copy(s, n, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::swap(basic_string& str).
+	void swap(BasicString& str)
+	{
+		delegate.swap(str.delegate);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::c_str() const noexcept.
+	const CharT* c_str() const noexcept
+	{
+		return delegate.c_str();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::data() const noexcept.
+	const CharT* data() const noexcept
+	{
+		return delegate.data();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::get_allocator() const noexcept.
+	allocator_type get_allocator() const noexcept
+	{
+		return delegate.get_allocator();
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find(const basic_string& str, size_type pos = 0) const noexcept.
+	size_type find(const DelegateType& str, size_type pos = 0) const noexcept
+	{
+		return delegate.find(str, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find(const CharT* s, size_type pos, size_type n) const.
+	size_type find(const CharT* s, size_type pos, size_type n) const
+	{
+		return delegate.find(s, pos, n);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find(const CharT* s, size_type pos = 0) const.
+	size_type find(const CharT* s, size_type pos = 0) const
+	{
+		return delegate.find(s, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find(CharT c, size_type pos = 0) const noexcept.
+	size_type find(CharT c, size_type pos = 0) const noexcept
+	{
+		return delegate.find(c, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::rfind(const basic_string& str, size_type pos = npos) const noexcept.
+	size_type rfind(const DelegateType& str, size_type pos = npos) const noexcept
+	{
+		return delegate.rfind(str, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::rfind(const CharT* s, size_type pos, size_type n) const.
+	size_type rfind(const CharT* s, size_type pos, size_type n) const
+	{
+		return delegate.rfind(s, pos, n);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::rfind(const CharT* s, size_type pos = npos) const.
+	size_type rfind(const CharT* s, size_type pos = npos) const
+	{
+		return delegate.rfind(s, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::rfind(CharT c, size_type pos = npos) const noexcept.
+	size_type rfind(CharT c, size_type pos = npos) const noexcept
+	{
+		return delegate.rfind(c, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find_first_of(const basic_string& str, size_type pos = 0) const noexcept.
+	size_type find_first_of(const DelegateType& str, size_type pos = 0) const noexcept
+	{
+		return delegate.find_first_of(str, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find_first_of(const CharT* s, size_type pos, size_type n) const.
+	size_type find_first_of(const CharT* s, size_type pos, size_type n) const
+	{
+		return delegate.find_first_of(s, pos, n);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find_first_of(const CharT* s, size_type pos = 0) const.
+	size_type find_first_of(const CharT* s, size_type pos = 0) const
+	{
+		return delegate.find_first_of(s, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find_first_of(CharT c, size_type pos = 0) const noexcept.
+	size_type find_first_of(CharT c, size_type pos = 0) const noexcept
+	{
+		return delegate.find_first_of(c, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find_last_of(const basic_string& str, size_type pos = npos) const noexcept.
+	size_type find_last_of(const DelegateType& str, size_type pos = npos) const noexcept
+	{
+		return delegate.find_last_of(str, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find_last_of(const CharT* s, size_type pos, size_type n) const.
+	size_type find_last_of(const CharT* s, size_type pos, size_type n) const
+	{
+		return delegate.find_last_of(s, pos, n);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find_last_of(const CharT* s, size_type pos = npos) const.
+	size_type find_last_of(const CharT* s, size_type pos = npos) const
+	{
+		return delegate.find_last_of(s, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find_last_of(CharT c, size_type pos = npos) const noexcept.
+	size_type find_last_of(CharT c, size_type pos = npos) const noexcept
+	{
+		return delegate.find_last_of(c, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find_first_not_of(const basic_string& str, size_type pos = 0) const
+	/// noexcept.
+	size_type find_first_not_of(const DelegateType& str, size_type pos = 0) const noexcept
+	{
+		return delegate.find_first_not_of(str, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find_first_not_of(const CharT* s, size_type pos, size_type n) const.
+	size_type find_first_not_of(const CharT* s, size_type pos, size_type n) const
+	{
+		return delegate.find_first_not_of(s, pos, n);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find_first_not_of(const CharT* s, size_type pos = 0) const.
+	size_type find_first_not_of(const CharT* s, size_type pos = 0) const
+	{
+		return delegate.find_first_not_of(s, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find_first_not_of(CharT c, size_type pos = 0) const noexcept.
+	size_type find_first_not_of(CharT c, size_type pos = 0) const noexcept
+	{
+		return delegate.find_first_not_of(c, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find_last_not_of(const basic_string& str, size_type pos = npos) const
+	/// noexcept.
+	size_type find_last_not_of(const DelegateType& str, size_type pos = npos) const noexcept
+	{
+		return delegate.find_last_not_of(str, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find_last_not_of(const CharT* s, size_type pos, size_type n) const.
+	size_type find_last_not_of(const CharT* s, size_type pos, size_type n) const
+	{
+		return delegate.find_last_not_of(s, pos, n);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find_last_not_of(const CharT* s, size_type pos = npos) const.
+	size_type find_last_not_of(const CharT* s, size_type pos = npos) const
+	{
+		return delegate.find_last_not_of(s, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::find_last_not_of(CharT c, size_type pos = npos) const noexcept.
+	size_type find_last_not_of(CharT c, size_type pos = npos) const noexcept
+	{
+		return delegate.find_last_not_of(c, pos);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::substr(size_type pos = 0, size_type n = npos) const.
+	BasicString substr(size_type pos = 0, size_type n = npos) const
+	{
+		return BasicString(delegate.substr(pos, n));
+	}
+
+	/// Forwarded to std::basic_string<CharT>::compare(const basic_string& str) const noexcept.
+	int compare(const DelegateType& str) const noexcept
+	{
+		return delegate.compare(str);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::compare(size_type pos1, size_type n1, const basic_string& str) const.
+	int compare(size_type pos1, size_type n1, const DelegateType& str) const
+	{
+		return delegate.compare(pos1, n1, str);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::compare(size_type pos1, size_type n1, const basic_string& str, size_type
+	/// pos2, size_type n2 = npos) const.
+	int compare(size_type pos1, size_type n1, const DelegateType& str, size_type pos2, size_type n2 = npos) const
+	{
+		return delegate.compare(pos1, n1, str, pos2, n2);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::compare(const CharT* s) const.
+	int compare(const CharT* s) const
+	{
+		return delegate.compare(s);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::compare(size_type pos1, size_type n1, const CharT* s) const.
+	int compare(size_type pos1, size_type n1, const CharT* s) const
+	{
+		return delegate.compare(pos1, n1, s);
+	}
+
+	/// Forwarded to std::basic_string<CharT>::compare(size_type pos1, size_type n1, const CharT* s, size_type n2) const.
+	int compare(size_type pos1, size_type n1, const CharT* s, size_type n2) const
+	{
+		return delegate.compare(pos1, n1, s, n2);
+	}
+
+private:
+	DelegateType delegate;
+};
+
+template<typename CharT, typename Traits, typename Allocator>
+const typename BasicString<CharT, Traits, Allocator>::size_type BasicString<CharT, Traits, Allocator>::npos;
+
+/// Polymorphic decorator of std::string.
+typedef BasicString<char> String;
+
+/// Polymorphic decorator of std::wstring.
+typedef BasicString<wchar_t> WString;
+
+/// Polymorphic decorator of std::u16string.
+typedef BasicString<char16_t> U16String;
+
+/// Polymorphic decorator of std::u32string.
+typedef BasicString<char32_t> U32String;
+
+/// Forwarded to operator+(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+BasicString<CharT, Traits, Allocator>
+operator+(const BasicString<CharT, Traits, Allocator>& lhs, const BasicString<CharT, Traits, Allocator>& rhs)
+{
+	BasicString<CharT, Traits, Allocator> result(lhs);
+	result.append(rhs);
+	return result;
+}
+
+/// Forwarded to operator+(std::basic_string<CharT>&& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+BasicString<CharT, Traits, Allocator>
+operator+(BasicString<CharT, Traits, Allocator>&& lhs, const BasicString<CharT, Traits, Allocator>& rhs)
+{
+	lhs.append(rhs);
+	return std::move(lhs);
+}
+
+/// Forwarded to operator+(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+BasicString<CharT, Traits, Allocator>
+operator+(const BasicString<CharT, Traits, Allocator>& lhs, const std::basic_string<CharT, Traits, Allocator>& rhs)
+{
+	BasicString<CharT, Traits, Allocator> result(lhs);
+	result.append(rhs);
+	return result;
+}
+
+/// Forwarded to operator+(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+BasicString<CharT, Traits, Allocator>
+operator+(const std::basic_string<CharT, Traits, Allocator>& lhs, const BasicString<CharT, Traits, Allocator>& rhs)
+{
+	BasicString<CharT, Traits, Allocator> result(lhs);
+	result.append(rhs);
+	return result;
+}
+
+/// Forwarded to operator+(const std::basic_string<CharT>& lhs, const CharT* rhs).
+template<typename CharT, typename Traits, typename Allocator>
+BasicString<CharT, Traits, Allocator> operator+(const BasicString<CharT, Traits, Allocator>& lhs, const CharT* rhs)
+{
+	BasicString<CharT, Traits, Allocator> result(lhs);
+	result.append(rhs);
+	return result;
+}
+
+/// Forwarded to operator+(std::basic_string<CharT>&& lhs, const CharT* rhs).
+template<typename CharT, typename Traits, typename Allocator>
+BasicString<CharT, Traits, Allocator> operator+(BasicString<CharT, Traits, Allocator>&& lhs, const CharT* rhs)
+{
+	lhs.append(rhs);
+	return std::move(lhs);
+}
+
+/// Forwarded to operator+(const CharT* lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+BasicString<CharT, Traits, Allocator> operator+(const CharT* lhs, const BasicString<CharT, Traits, Allocator>& rhs)
+{
+	BasicString<CharT, Traits, Allocator> result(lhs, rhs.get_allocator());
+	result.append(rhs);
+	return result;
+}
+
+/// Forwarded to operator+(const std::basic_string<CharT>& lhs, CharT rhs).
+template<typename CharT, typename Traits, typename Allocator>
+BasicString<CharT, Traits, Allocator> operator+(const BasicString<CharT, Traits, Allocator>& lhs, CharT rhs)
+{
+	BasicString<CharT, Traits, Allocator> result(lhs);
+	result.push_back(rhs);
+	return result;
+}
+
+/// Forwarded to operator+(std::basic_string<CharT>&& lhs, CharT rhs).
+template<typename CharT, typename Traits, typename Allocator>
+BasicString<CharT, Traits, Allocator> operator+(BasicString<CharT, Traits, Allocator>&& lhs, CharT rhs)
+{
+	lhs.push_back(rhs);
+	return std::move(lhs);
+}
+
+/// Forwarded to operator+(CharT lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+BasicString<CharT, Traits, Allocator> operator+(CharT lhs, const BasicString<CharT, Traits, Allocator>& rhs)
+{
+	BasicString<CharT, Traits, Allocator> result(1, lhs, rhs.get_allocator());
+	result.append(rhs);
+	return result;
+}
+
+/// Forwarded to operator==(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator==(const BasicString<CharT, Traits, Allocator>& lhs, const BasicString<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return lhs.compare(rhs) == 0;
+}
+
+/// Forwarded to operator==(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator==(const BasicString<CharT, Traits, Allocator>& lhs, const std::basic_string<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return lhs.compare(rhs) == 0;
+}
+
+/// Forwarded to operator==(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator==(const std::basic_string<CharT, Traits, Allocator>& lhs, const BasicString<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return rhs.compare(lhs) == 0;
+}
+
+/// Forwarded to operator==(const std::basic_string<CharT>& lhs, const CharT* rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator==(const BasicString<CharT, Traits, Allocator>& lhs, const CharT* rhs)
+{
+	return lhs.compare(rhs) == 0;
+}
+
+/// Forwarded to operator==(const CharT* lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator==(const CharT* lhs, const BasicString<CharT, Traits, Allocator>& rhs)
+{
+	return rhs.compare(lhs) == 0;
+}
+
+/// Forwarded to operator!=(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator!=(const BasicString<CharT, Traits, Allocator>& lhs, const BasicString<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return lhs.compare(rhs) != 0;
+}
+
+/// Forwarded to operator!=(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator!=(const BasicString<CharT, Traits, Allocator>& lhs, const std::basic_string<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return lhs.compare(rhs) != 0;
+}
+
+/// Forwarded to operator!=(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator!=(const std::basic_string<CharT, Traits, Allocator>& lhs, const BasicString<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return rhs.compare(lhs) != 0;
+}
+
+/// Forwarded to operator!=(const std::basic_string<CharT>& lhs, const CharT* rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator!=(const BasicString<CharT, Traits, Allocator>& lhs, const CharT* rhs)
+{
+	return lhs.compare(rhs) != 0;
+}
+
+/// Forwarded to operator!=(const CharT* lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator!=(const CharT* lhs, const BasicString<CharT, Traits, Allocator>& rhs)
+{
+	return rhs.compare(lhs) != 0;
+}
+
+/// Forwarded to operator<(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator<(const BasicString<CharT, Traits, Allocator>& lhs, const BasicString<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return lhs.compare(rhs) < 0;
+}
+
+/// Forwarded to operator<(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator<(const BasicString<CharT, Traits, Allocator>& lhs, const std::basic_string<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return lhs.compare(rhs) < 0;
+}
+
+/// Forwarded to operator<(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator<(const std::basic_string<CharT, Traits, Allocator>& lhs, const BasicString<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return rhs.compare(lhs) > 0;
+}
+
+/// Forwarded to operator<(const std::basic_string<CharT>& lhs, const CharT* rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator<(const BasicString<CharT, Traits, Allocator>& lhs, const CharT* rhs)
+{
+	return lhs.compare(rhs) < 0;
+}
+
+/// Forwarded to operator<(const CharT* lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator<(const CharT* lhs, const BasicString<CharT, Traits, Allocator>& rhs)
+{
+	return rhs.compare(lhs) > 0;
+}
+
+/// Forwarded to operator<=(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator<=(const BasicString<CharT, Traits, Allocator>& lhs, const BasicString<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return lhs.compare(rhs) <= 0;
+}
+
+/// Forwarded to operator<=(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator<=(const BasicString<CharT, Traits, Allocator>& lhs, const std::basic_string<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return lhs.compare(rhs) <= 0;
+}
+
+/// Forwarded to operator<=(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator<=(const std::basic_string<CharT, Traits, Allocator>& lhs, const BasicString<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return rhs.compare(lhs) >= 0;
+}
+
+/// Forwarded to operator<=(const std::basic_string<CharT>& lhs, const CharT* rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator<=(const BasicString<CharT, Traits, Allocator>& lhs, const CharT* rhs)
+{
+	return lhs.compare(rhs) <= 0;
+}
+
+/// Forwarded to operator<=(const CharT* lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator<=(const CharT* lhs, const BasicString<CharT, Traits, Allocator>& rhs)
+{
+	return rhs.compare(lhs) >= 0;
+}
+
+/// Forwarded to operator>(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator>(const BasicString<CharT, Traits, Allocator>& lhs, const BasicString<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return lhs.compare(rhs) > 0;
+}
+
+/// Forwarded to operator>(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator>(const BasicString<CharT, Traits, Allocator>& lhs, const std::basic_string<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return lhs.compare(rhs) > 0;
+}
+
+/// Forwarded to operator>(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator>(const std::basic_string<CharT, Traits, Allocator>& lhs, const BasicString<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return rhs.compare(lhs) < 0;
+}
+
+/// Forwarded to operator>(const std::basic_string<CharT>& lhs, const CharT* rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator>(const BasicString<CharT, Traits, Allocator>& lhs, const CharT* rhs)
+{
+	return lhs.compare(rhs) > 0;
+}
+
+/// Forwarded to operator>(const CharT* lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator>(const CharT* lhs, const BasicString<CharT, Traits, Allocator>& rhs)
+{
+	return rhs.compare(lhs) < 0;
+}
+
+/// Forwarded to operator>=(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator>=(const BasicString<CharT, Traits, Allocator>& lhs, const BasicString<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return lhs.compare(rhs) >= 0;
+}
+
+/// Forwarded to operator>=(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator>=(const BasicString<CharT, Traits, Allocator>& lhs, const std::basic_string<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return lhs.compare(rhs) >= 0;
+}
+
+/// Forwarded to operator>=(const std::basic_string<CharT>& lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator>=(const std::basic_string<CharT, Traits, Allocator>& lhs, const BasicString<CharT, Traits, Allocator>& rhs) noexcept
+{
+	return rhs.compare(lhs) <= 0;
+}
+
+/// Forwarded to operator>=(const std::basic_string<CharT>& lhs, const CharT* rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator>=(const BasicString<CharT, Traits, Allocator>& lhs, const CharT* rhs)
+{
+	return lhs.compare(rhs) >= 0;
+}
+
+/// Forwarded to operator>=(const CharT* lhs, const std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+bool operator>=(const CharT* lhs, const BasicString<CharT, Traits, Allocator>& rhs)
+{
+	return rhs.compare(lhs) <= 0;
+}
+
+/// Forwarded to swap(std::basic_string<CharT>& lhs, std::basic_string<CharT>& rhs).
+template<typename CharT, typename Traits, typename Allocator>
+void swap(BasicString<CharT, Traits, Allocator>& lhs, BasicString<CharT, Traits, Allocator>& rhs)
+{
+	lhs.swap(rhs);
+}
+
+/// Forwarded to operator<<(std::basic_ostream<CharT>& os, const std::basic_string<CharT>& str).
+template<typename CharT, typename Traits, typename Allocator>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& os, const BasicString<CharT, Traits, Allocator>& str)
+{
+	return os << static_cast<const std::basic_string<CharT, Traits, Allocator>&>(str);
+}
+
+/// Forwarded to operator>>(std::basic_istream<CharT>& is, std::basic_string<CharT>& str).
+template<typename CharT, typename Traits, typename Allocator>
+std::basic_istream<CharT, Traits>& operator>>(std::basic_istream<CharT, Traits>& is, BasicString<CharT, Traits, Allocator>& str)
+{
+	return is >> static_cast<std::basic_string<CharT, Traits, Allocator>&>(str);
+}
+
+/// Forwarded to getline(std::basic_istream<CharT>& is, std::basic_string<CharT>& str, CharT delimiter).
+template<typename CharT, typename Traits, typename Allocator>
+std::basic_istream<CharT, Traits>&
+getline(std::basic_istream<CharT, Traits>& is, BasicString<CharT, Traits, Allocator>& str, CharT delimiter)
+{
+	return std::getline(is, static_cast<std::basic_string<CharT, Traits, Allocator>&>(str), delimiter);
+}
+
+/// Forwarded to getline(std::basic_istream<CharT>& is, std::basic_string<CharT>& str).
+template<typename CharT, typename Traits, typename Allocator>
+std::basic_istream<CharT, Traits>& getline(std::basic_istream<CharT, Traits>& is, BasicString<CharT, Traits, Allocator>& str)
+{
+	return std::getline(is, static_cast<std::basic_string<CharT, Traits, Allocator>&>(str));
+}
+
+} // namespace Polymorphic
+
+namespace std {
+
+/// Hash of Polymorphic::BasicString<CharT>, equal to the hash of its std::basic_string<CharT> delegate.
+template<typename CharT, typename Traits, typename Allocator>
+struct hash<Polymorphic::BasicString<CharT, Traits, Allocator>>
+{
+	size_t operator()(const Polymorphic::BasicString<CharT, Traits, Allocator>& str) const noexcept
+	{
+		return hash<basic_string<CharT, Traits, Allocator>>()(str);
+	}
+};
+
+} // namespace std
+
+#ifdef POLYMORPHIC_EXTERN_TEMPLATES
+namespace Polymorphic {
+
+// Explicitly instantiated by the Polymorphic::Instantiations library.
+extern template class BasicString<char>;
+
+} // namespace Polymorphic
+#endif // POLYMORPHIC_EXTERN_TEMPLATES
+
+#endif // Polymorphic_String_INCLUDED
@@ -8,6 +8,10 @@
 #ifndef Polymorphic_UnorderedMap_INCLUDED
 #define Polymorphic_UnorderedMap_INCLUDED
 
+#include "Polymorphic/HashedKey.h"
+#include "Polymorphic/SerializationFwd.h"
+#include <iterator>
+#include <tuple>
 #include <unordered_map>
 
 namespace Polymorphic {
@@ -344,11 +348,12 @@ public:
 		return delegate.insert(position, std::move(value));
 	}
 
-	/// Forwarded to std::unordered_map<Key, T>::insert(InputIterator first, InputIterator last).
+	/// Forwarded to std::unordered_map<Key, T>::insert(InputIterator first, InputIterator last), after reserving buckets for
+	/// all elements of the range if InputIterator is a forward iterator, so that inserting rehashes at most once.
 	template<typename InputIterator>
 	void insert(InputIterator first, InputIterator last)
 	{
-		delegate.insert(first, last);
+		insertRange(first, last, typename std::iterator_traits<InputIterator>::iterator_category());
 	}
 
 	/// Forwarded to std::unordered_map<Key, T>::insert(std::initializer_list<value_type> initializerList).
@@ -375,6 +380,27 @@ public:
 		return delegate.erase(first, last);
 	}
 
+	/// Write elements to sink as chunked stream, encoding each by codec and writing chunks of at least chunkBytes.
+	/// Memory overhead is bounded by the chunk size. Throws serialization::Error if writing fails.
+	template<typename Codec = serialization::Codec<value_type>>
+	void serialize(
+		std::ostream& sink, const Codec& codec = Codec(), std::size_t chunkBytes = serialization::defaultChunkBytes) const
+	{
+		serialization::write_chunks(sink, delegate.begin(), delegate.end(), delegate.size(), codec, chunkBytes);
+	}
+
+	/// Replace elements by those of the chunked stream read from source, decoding each by codec while reserving
+	/// buckets up to the element count written by serialize(). Throws serialization::Error if the stream is
+	/// truncated, corrupt or incompatible, leaving this container unchanged.
+	template<typename Codec = serialization::Codec<value_type>>
+	void deserialize(std::istream& source, const Codec& codec = Codec())
+	{
+		DelegateType loaded(0, delegate.hash_function(), delegate.key_eq(), delegate.get_allocator());
+		serialization::read_chunks(
+			source, codec, [&loaded](std::size_t count) { loaded.reserve(count); }, serialization::Emplacer<DelegateType>(loaded));
+		delegate.swap(loaded);
+	}
+
 	/// Forwarded to std::unordered_map<Key, T>::swap(std::unordered_map<bool>& other).
 	void swap(UnorderedMap& other)
 	{
@@ -401,6 +427,17 @@ public:
 		return delegate.emplace_hint(position, std::forward<Args>(args)...);
 	}
 
+	/// Emplace an element with key, whose hash code was precomputed as hash_function()(key), and mapped value constructed
+	/// from args. The code is used instead of hashing key again if key_type is a HashedKey, see CachedHashUnorderedMap.
+	template<typename K, typename... Args>
+	std::pair<iterator, bool> emplace_hashed(K&& key, std::size_t hash, Args&&... args)
+	{
+		return delegate.emplace(
+			std::piecewise_construct,
+			std::forward_as_tuple(detail::Unhashed<key_type>::make(std::forward<K>(key), hash)),
+			std::forward_as_tuple(std::forward<Args>(args)...));
+	}
+
 	/// Forwarded to std::unordered_map<Key, T>::find(const key_type& key).
 	iterator find(const key_type& key)
 	{
@@ -431,6 +468,42 @@ public:
 		return delegate.equal_range(key);
 	}
 
+	/// Find key by its hash code precomputed as hash_function()(key). The code is used instead of hashing key again if
+	/// key_type is a HashedKey, see CachedHashUnorderedMap.
+	iterator find(const typename detail::Unhashed<key_type>::type& key, std::size_t hash)
+	{
+		return delegate.find(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
+	/// Find key by its hash code precomputed as hash_function()(key). The code is used instead of hashing key again if
+	/// key_type is a HashedKey, see CachedHashUnorderedMap.
+	const_iterator find(const typename detail::Unhashed<key_type>::type& key, std::size_t hash) const
+	{
+		return delegate.find(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
+	/// Count key by its hash code precomputed as hash_function()(key). The code is used instead of hashing key again if
+	/// key_type is a HashedKey, see CachedHashUnorderedMap.
+	size_type count(const typename detail::Unhashed<key_type>::type& key, std::size_t hash) const
+	{
+		return delegate.count(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
+	/// Find elements with key by its hash code precomputed as hash_function()(key). The code is used instead of hashing
+	/// key again if key_type is a HashedKey, see CachedHashUnorderedMap.
+	std::pair<iterator, iterator> equal_range(const typename detail::Unhashed<key_type>::type& key, std::size_t hash)
+	{
+		return delegate.equal_range(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
+	/// Find elements with key by its hash code precomputed as hash_function()(key). The code is used instead of hashing
+	/// key again if key_type is a HashedKey, see CachedHashUnorderedMap.
+	std::pair<const_iterator, const_iterator> equal_range(
+		const typename detail::Unhashed<key_type>::type& key, std::size_t hash) const
+	{
+		return delegate.equal_range(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
 	/// Forwarded to std::unordered_map<Key, T>::bucket_count() const noexcept.
 	size_type bucket_count() const noexcept
 	{
@@ -485,6 +558,12 @@ public:
 		delegate.reserve(n);
 	}
 
+	/// Rehash to the fewest buckets holding the current elements within max_load_factor(), e.g. after mass erases.
+	void shrink_to_fit()
+	{
+		delegate.rehash(0);
+	}
+
 	/// Forwarded to std::unordered_map<Key, T>::hash_function() const.
 	hasher hash_function() const
 	{
@@ -504,6 +583,24 @@ public:
 	}
 
 private:
+	template<typename InputIterator>
+	void insertRange(InputIterator first, InputIterator last, std::input_iterator_tag)
+	{
+		delegate.insert(first, last);
+	}
+
+	/// Reserve buckets for the elements of [first, last) before inserting them. Unless all keys are new, this leaves
+	/// more buckets than needed, see shrink_to_fit(). Never shrinks, as reserve() may.
+	template<typename ForwardIterator>
+	void insertRange(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+	{
+		size_type n = delegate.size() + static_cast<size_type>(std::distance(first, last));
+		if (n > delegate.bucket_count() * delegate.max_load_factor()) {
+			delegate.reserve(n);
+		}
+		delegate.insert(first, last);
+	}
+
 	DelegateType delegate;
 
 	// clang-format off
@@ -587,6 +684,33 @@ void swap(const UnorderedMap<Key, T, Hash, Predicate, Allocator>& lhs, const Uno
 	swap(lhs.delegate, rhs.delegate);
 }
 
+/// UnorderedMap with the cached hash policy, storing the hash code of each key computed by Hash next to it, see HashedKey.
+template<
+	typename Key,
+	typename T,
+	typename Hash = std::hash<Key>,
+	typename Predicate = std::equal_to<Key>,
+	typename Allocator = std::allocator<std::pair<const Key, T>>>
+using CachedHashUnorderedMap = UnorderedMap<
+	HashedKey<Key, Hash>,
+	T,
+	CachedHash<Key, Hash>,
+	CachedKeyEqual<Key, Hash, Predicate>,
+	typename std::allocator_traits<Allocator>::template rebind_alloc<std::pair<const HashedKey<Key, Hash>, T>>>;
+
+} // namespace Polymorphic
+
+#ifdef POLYMORPHIC_EXTERN_TEMPLATES
+#include <string>
+
+namespace Polymorphic {
+
+// Explicitly instantiated by the Polymorphic::Instantiations library.
+extern template class UnorderedMap<int, int>;
+extern template class UnorderedMap<std::string, int>;
+extern template class UnorderedMap<std::string, std::string>;
+
 } // namespace Polymorphic
+#endif // POLYMORPHIC_EXTERN_TEMPLATES
 
 #endif // Polymorphic_UnorderedMap_INCLUDED
@@ -8,6 +8,9 @@
 #ifndef Polymorphic_UnorderedMultimap_INCLUDED
 #define Polymorphic_UnorderedMultimap_INCLUDED
 
+#include "Polymorphic/HashedKey.h"
+#include <iterator>
+#include <tuple>
 #include <unordered_map>
 
 namespace Polymorphic {
@@ -322,11 +325,12 @@ public:
 		return delegate.insert(position, std::move(value));
 	}
 
-	/// Forwarded to std::unordered_multimap<Key, T>::insert(InputIterator first, InputIterator last).
+	/// Forwarded to std::unordered_multimap<Key, T>::insert(InputIterator first, InputIterator last), after reserving buckets for
+	/// all elements of the range if InputIterator is a forward iterator, so that inserting rehashes at most once.
 	template<typename InputIterator>
 	void insert(InputIterator first, InputIterator last)
 	{
-		delegate.insert(first, last);
+		insertRange(first, last, typename std::iterator_traits<InputIterator>::iterator_category());
 	}
 
 	/// Forwarded to std::unordered_multimap<Key, T>::insert(std::initializer_list<value_type> initializerList).
@@ -379,6 +383,17 @@ public:
 		return delegate.emplace_hint(position, std::forward<Args>(args)...);
 	}
 
+	/// Emplace an element with key, whose hash code was precomputed as hash_function()(key), and mapped value constructed
+	/// from args. The code is used instead of hashing key again if key_type is a HashedKey, see CachedHashUnorderedMultimap.
+	template<typename K, typename... Args>
+	iterator emplace_hashed(K&& key, std::size_t hash, Args&&... args)
+	{
+		return delegate.emplace(
+			std::piecewise_construct,
+			std::forward_as_tuple(detail::Unhashed<key_type>::make(std::forward<K>(key), hash)),
+			std::forward_as_tuple(std::forward<Args>(args)...));
+	}
+
 	/// Forwarded to std::unordered_multimap<Key, T>::find(const key_type& key).
 	iterator find(const key_type& key)
 	{
@@ -409,6 +424,42 @@ public:
 		return delegate.equal_range(key);
 	}
 
+	/// Find key by its hash code precomputed as hash_function()(key). The code is used instead of hashing key again if
+	/// key_type is a HashedKey, see CachedHashUnorderedMultimap.
+	iterator find(const typename detail::Unhashed<key_type>::type& key, std::size_t hash)
+	{
+		return delegate.find(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
+	/// Find key by its hash code precomputed as hash_function()(key). The code is used instead of hashing key again if
+	/// key_type is a HashedKey, see CachedHashUnorderedMultimap.
+	const_iterator find(const typename detail::Unhashed<key_type>::type& key, std::size_t hash) const
+	{
+		return delegate.find(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
+	/// Count key by its hash code precomputed as hash_function()(key). The code is used instead of hashing key again if
+	/// key_type is a HashedKey, see CachedHashUnorderedMultimap.
+	size_type count(const typename detail::Unhashed<key_type>::type& key, std::size_t hash) const
+	{
+		return delegate.count(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
+	/// Find elements with key by its hash code precomputed as hash_function()(key). The code is used instead of hashing
+	/// key again if key_type is a HashedKey, see CachedHashUnorderedMultimap.
+	std::pair<iterator, iterator> equal_range(const typename detail::Unhashed<key_type>::type& key, std::size_t hash)
+	{
+		return delegate.equal_range(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
+	/// Find elements with key by its hash code precomputed as hash_function()(key). The code is used instead of hashing
+	/// key again if key_type is a HashedKey, see CachedHashUnorderedMultimap.
+	std::pair<const_iterator, const_iterator> equal_range(
+		const typename detail::Unhashed<key_type>::type& key, std::size_t hash) const
+	{
+		return delegate.equal_range(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
 	/// Forwarded to std::unordered_multimap<Key, T>::bucket_count() const noexcept.
 	size_type bucket_count() const noexcept
 	{
@@ -463,6 +514,12 @@ public:
 		delegate.reserve(n);
 	}
 
+	/// Rehash to the fewest buckets holding the current elements within max_load_factor(), e.g. after mass erases.
+	void shrink_to_fit()
+	{
+		delegate.rehash(0);
+	}
+
 	/// Forwarded to std::unordered_multimap<Key, T>::hash_function() const.
 	hasher hash_function() const
 	{
@@ -482,6 +539,24 @@ public:
 	}
 
 private:
+	template<typename InputIterator>
+	void insertRange(InputIterator first, InputIterator last, std::input_iterator_tag)
+	{
+		delegate.insert(first, last);
+	}
+
+	/// Reserve buckets for the elements of [first, last) before inserting them. Unless all keys are new, this leaves
+	/// more buckets than needed, see shrink_to_fit(). Never shrinks, as reserve() may.
+	template<typename ForwardIterator>
+	void insertRange(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+	{
+		size_type n = delegate.size() + static_cast<size_type>(std::distance(first, last));
+		if (n > delegate.bucket_count() * delegate.max_load_factor()) {
+			delegate.reserve(n);
+		}
+		delegate.insert(first, last);
+	}
+
 	DelegateType delegate;
 
 	// clang-format off
@@ -567,6 +642,20 @@ void swap(
 	swap(lhs.delegate, rhs.delegate);
 }
 
+/// UnorderedMultimap with the cached hash policy, storing the hash code of each key computed by Hash next to it, see HashedKey.
+template<
+	typename Key,
+	typename T,
+	typename Hash = std::hash<Key>,
+	typename Predicate = std::equal_to<Key>,
+	typename Allocator = std::allocator<std::pair<const Key, T>>>
+using CachedHashUnorderedMultimap = UnorderedMultimap<
+	HashedKey<Key, Hash>,
+	T,
+	CachedHash<Key, Hash>,
+	CachedKeyEqual<Key, Hash, Predicate>,
+	typename std::allocator_traits<Allocator>::template rebind_alloc<std::pair<const HashedKey<Key, Hash>, T>>>;
+
 } // namespace Polymorphic
 
 #endif // Polymorphic_UnorderedMultimap_INCLUDED
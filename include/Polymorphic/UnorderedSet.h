@@ -8,6 +8,8 @@
 #ifndef Polymorphic_UnorderedSet_INCLUDED
 #define Polymorphic_UnorderedSet_INCLUDED
 
+#include "Polymorphic/HashedKey.h"
+#include <iterator>
 #include <unordered_set>
 
 namespace Polymorphic {
@@ -304,11 +306,12 @@ public:
 		return delegate.insert(position, std::move(value));
 	}
 
-	/// Forwarded to std::unordered_set<Key>::insert(InputIterator first, InputIterator last).
+	/// Forwarded to std::unordered_set<Key>::insert(InputIterator first, InputIterator last), after reserving buckets for
+	/// all elements of the range if InputIterator is a forward iterator, so that inserting rehashes at most once.
 	template<typename InputIterator>
 	void insert(InputIterator first, InputIterator last)
 	{
-		delegate.insert(first, last);
+		insertRange(first, last, typename std::iterator_traits<InputIterator>::iterator_category());
 	}
 
 	/// Forwarded to std::unordered_set<Key>::insert(std::initializer_list<value_type> initializerList).
@@ -361,6 +364,14 @@ public:
 		return delegate.emplace_hint(position, std::forward<Args>(args)...);
 	}
 
+	/// Emplace key, whose hash code was precomputed as hash_function()(key). The code is used instead of hashing key again
+	/// if key_type is a HashedKey, see CachedHashUnorderedSet.
+	template<typename K>
+	std::pair<iterator, bool> emplace_hashed(K&& key, std::size_t hash)
+	{
+		return delegate.emplace(detail::Unhashed<key_type>::make(std::forward<K>(key), hash));
+	}
+
 	/// Forwarded to std::unordered_set<Key>::find(const key_type& key).
 	iterator find(const key_type& key)
 	{
@@ -391,6 +402,42 @@ public:
 		return delegate.equal_range(key);
 	}
 
+	/// Find key by its hash code precomputed as hash_function()(key). The code is used instead of hashing key again if
+	/// key_type is a HashedKey, see CachedHashUnorderedSet.
+	iterator find(const typename detail::Unhashed<key_type>::type& key, std::size_t hash)
+	{
+		return delegate.find(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
+	/// Find key by its hash code precomputed as hash_function()(key). The code is used instead of hashing key again if
+	/// key_type is a HashedKey, see CachedHashUnorderedSet.
+	const_iterator find(const typename detail::Unhashed<key_type>::type& key, std::size_t hash) const
+	{
+		return delegate.find(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
+	/// Count key by its hash code precomputed as hash_function()(key). The code is used instead of hashing key again if
+	/// key_type is a HashedKey, see CachedHashUnorderedSet.
+	size_type count(const typename detail::Unhashed<key_type>::type& key, std::size_t hash) const
+	{
+		return delegate.count(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
+	/// Find elements with key by its hash code precomputed as hash_function()(key). The code is used instead of hashing
+	/// key again if key_type is a HashedKey, see CachedHashUnorderedSet.
+	std::pair<iterator, iterator> equal_range(const typename detail::Unhashed<key_type>::type& key, std::size_t hash)
+	{
+		return delegate.equal_range(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
+	/// Find elements with key by its hash code precomputed as hash_function()(key). The code is used instead of hashing
+	/// key again if key_type is a HashedKey, see CachedHashUnorderedSet.
+	std::pair<const_iterator, const_iterator> equal_range(
+		const typename detail::Unhashed<key_type>::type& key, std::size_t hash) const
+	{
+		return delegate.equal_range(detail::Unhashed<key_type>::probe(key, hash));
+	}
+
 	/// Forwarded to std::unordered_set<Key>::bucket_count() const noexcept.
 	size_type bucket_count() const noexcept
 	{
@@ -445,6 +492,12 @@ public:
 		delegate.reserve(n);
 	}
 
+	/// Rehash to the fewest buckets holding the current elements within max_load_factor(), e.g. after mass erases.
+	void shrink_to_fit()
+	{
+		delegate.rehash(0);
+	}
+
 	/// Forwarded to std::unordered_set<Key>::hash_function() const.
 	hasher hash_function() const
 	{
@@ -464,6 +517,24 @@ public:
 	}
 
 private:
+	template<typename InputIterator>
+	void insertRange(InputIterator first, InputIterator last, std::input_iterator_tag)
+	{
+		delegate.insert(first, last);
+	}
+
+	/// Reserve buckets for the elements of [first, last) before inserting them. Unless all keys are new, this leaves
+	/// more buckets than needed, see shrink_to_fit(). Never shrinks, as reserve() may.
+	template<typename ForwardIterator>
+	void insertRange(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+	{
+		size_type n = delegate.size() + static_cast<size_type>(std::distance(first, last));
+		if (n > delegate.bucket_count() * delegate.max_load_factor()) {
+			delegate.reserve(n);
+		}
+		delegate.insert(first, last);
+	}
+
 	DelegateType delegate;
 
 	// clang-format off
@@ -535,6 +606,30 @@ void swap(const UnorderedSet<Key, Hash, Predicate, Allocator>& lhs, const Unorde
 	swap(lhs.delegate, rhs.delegate);
 }
 
+/// UnorderedSet with the cached hash policy, storing the hash code of each key computed by Hash next to it, see HashedKey.
+template<
+	typename Key,
+	typename Hash = std::hash<Key>,
+	typename Predicate = std::equal_to<Key>,
+	typename Allocator = std::allocator<Key>>
+using CachedHashUnorderedSet = UnorderedSet<
+	HashedKey<Key, Hash>,
+	CachedHash<Key, Hash>,
+	CachedKeyEqual<Key, Hash, Predicate>,
+	typename std::allocator_traits<Allocator>::template rebind_alloc<HashedKey<Key, Hash>>>;
+
+} // namespace Polymorphic
+
+#ifdef POLYMORPHIC_EXTERN_TEMPLATES
+#include <string>
+
+namespace Polymorphic {
+
+// Explicitly instantiated by the Polymorphic::Instantiations library.
+extern template class UnorderedSet<int>;
+extern template class UnorderedSet<std::string>;
+
 } // namespace Polymorphic
+#endif // POLYMORPHIC_EXTERN_TEMPLATES
 
 #endif // Polymorphic_UnorderedSet_INCLUDED
@@ -8,6 +8,11 @@
 #ifndef Polymorphic_Vector_INCLUDED
 #define Polymorphic_Vector_INCLUDED
 
+#include "Polymorphic/DefaultInitAllocator.h"
+#include "Polymorphic/ExecutionFwd.h"
+#include "Polymorphic/Relocation.h"
+#include "Polymorphic/SerializationFwd.h"
+#include <algorithm>
 #include <vector>
 
 namespace Polymorphic {
@@ -60,7 +65,9 @@ public:
 	typedef typename DelegateType::size_type size_type;
 
 	/// Forwarded to std::vector<T>::vector(const allocator_type& allocator = allocator_type()).
-	explicit Vector(const allocator_type& allocator = allocator_type()) : delegate(allocator)
+	explicit Vector(const allocator_type& allocator = allocator_type()) noexcept(
+		std::is_nothrow_constructible<DelegateType, const allocator_type&>::value) :
+		delegate(allocator)
 	{
 	}
 
@@ -93,8 +100,19 @@ public:
 	{
 	}
 
+	/// Copy constructor, copying partitions concurrently per execution policy.
+	template<
+		typename ExecutionPolicy,
+		typename = typename std::enable_if<execution::is_execution_policy<ExecutionPolicy>::value>::type>
+	Vector(const ExecutionPolicy& policy, const Vector& other) :
+		delegate(std::allocator_traits<allocator_type>::select_on_container_copy_construction(other.get_allocator()))
+	{
+		execution::assign(policy, delegate, other.begin(), other.end());
+	}
+
 	/// Move constructor.
-	Vector(Vector&& other) : delegate(std::move(other.delegate))
+	Vector(Vector&& other) noexcept(std::is_nothrow_move_constructible<DelegateType>::value) :
+		delegate(std::move(other.delegate))
 	{
 	}
 
@@ -121,7 +139,8 @@ public:
 	}
 
 	/// Move construct from std::vector<T>.
-	Vector(DelegateType&& other) : delegate(std::move(other))
+	Vector(DelegateType&& other) noexcept(std::is_nothrow_move_constructible<DelegateType>::value) :
+		delegate(std::move(other))
 	{
 	}
 
@@ -143,7 +162,7 @@ public:
 	}
 
 	/// Move assignment operator
-	Vector& operator=(Vector&& other)
+	Vector& operator=(Vector&& other) noexcept(std::is_nothrow_move_assignable<DelegateType>::value)
 	{
 		delegate = std::move(other.delegate);
 		return *this;
@@ -290,6 +309,32 @@ public:
 		delegate.resize(n, value);
 	}
 
+	/// Resize to n elements, default initializing appended ones. With a DefaultInitAllocator these are left
+	/// uninitialized if trivially default constructible, to be overwritten by the caller. Other allocators value
+	/// initialize them, like resize(size_type n) does.
+	void resize_default_init(size_type n)
+	{
+		delegate.resize(n);
+	}
+
+	/// Resize to n elements default initialized like resize_default_init(n), let operation(pointer p, size_type n)
+	/// overwrite them in place, and keep the first operation result elements, clamped to n.
+	template<typename Operation>
+	void resize_and_overwrite(size_type n, Operation operation)
+	{
+		delegate.resize(n);
+		delegate.resize(std::min(n, static_cast<size_type>(operation(delegate.data(), n))));
+	}
+
+	/// Forwarded to std::vector<T>::resize(size_type n, const value_type& value), filling appended elements concurrently
+	/// per execution policy.
+	template<typename ExecutionPolicy>
+	typename std::enable_if<execution::is_execution_policy<ExecutionPolicy>::value>::type
+	resize(const ExecutionPolicy& policy, size_type n, const value_type& value)
+	{
+		execution::resize(policy, delegate, n, value);
+	}
+
 	/// Forwarded to std::vector<T>::capacity() noexcept.
 	size_type capacity() const noexcept
 	{
@@ -387,6 +432,15 @@ public:
 		delegate.assign(initializerList);
 	}
 
+	/// Forwarded to std::vector<T>::assign(InputIterator first, InputIterator last), copying partitions of random access
+	/// ranges concurrently per execution policy.
+	template<typename ExecutionPolicy, typename InputIterator>
+	typename std::enable_if<execution::is_execution_policy<ExecutionPolicy>::value>::type
+	assign(const ExecutionPolicy& policy, InputIterator first, InputIterator last)
+	{
+		execution::assign(policy, delegate, first, last);
+	}
+
 	/// Forwarded to std::vector<T>::push_back(const value_type& value).
 	void push_back(const value_type& value)
 	{
@@ -405,10 +459,11 @@ public:
 		delegate.pop_back();
 	}
 
-	/// Forwarded to std::vector<T>::insert(const_iterator position, const value_type& value).
+	/// Forwarded to std::vector<T>::insert(const_iterator position, const value_type& value), relocating subsequent
+	/// elements by a single memmove if value_type is_trivially_relocatable.
 	iterator insert(const_iterator position, const value_type& value)
 	{
-		return delegate.insert(position, value);
+		return detail::emplace(detail::is_relocating<T>(), delegate, position, value);
 	}
 
 	/// Forwarded to std::vector<T>::insert(const_iterator position, size_type n, const value_type& value).
@@ -424,10 +479,11 @@ public:
 		return delegate.insert(position, first, last);
 	}
 
-	/// Forwarded to std::vector<T>::insert(const_iterator position, value_type&& value).
+	/// Forwarded to std::vector<T>::insert(const_iterator position, value_type&& value), relocating subsequent elements
+	/// by a single memmove if value_type is_trivially_relocatable.
 	iterator insert(const_iterator position, value_type&& value)
 	{
-		return delegate.insert(position, std::move(value));
+		return detail::emplace(detail::is_relocating<T>(), delegate, position, std::move(value));
 	}
 
 	/// Forwarded to std::vector<T>::insert(const_iterator position, std::initializer_list<value_type> initializerList).
@@ -436,16 +492,54 @@ public:
 		return delegate.insert(position, initializerList);
 	}
 
-	/// Forwarded to std::vector<T>::erase(const_iterator position).
+	/// Forwarded to std::vector<T>::insert(const_iterator position, InputIterator first, InputIterator last), copying
+	/// partitions of random access ranges concurrently per execution policy.
+	template<typename ExecutionPolicy, typename InputIterator>
+	typename std::enable_if<execution::is_execution_policy<ExecutionPolicy>::value, iterator>::type
+	insert(const ExecutionPolicy& policy, const_iterator position, InputIterator first, InputIterator last)
+	{
+		return execution::insert(policy, delegate, position, first, last);
+	}
+
+	/// Forwarded to std::vector<T>::erase(const_iterator position), relocating subsequent elements by a single memmove
+	/// if value_type is_trivially_relocatable.
 	iterator erase(const_iterator position)
 	{
-		return delegate.erase(position);
+		return detail::erase(detail::is_relocating<T>(), delegate, position, position + 1);
 	}
 
-	/// Forwarded to std::vector<T>::erase(const_iterator first, const_iterator last).
+	/// Forwarded to std::vector<T>::erase(const_iterator first, const_iterator last), relocating subsequent elements by
+	/// a single memmove if value_type is_trivially_relocatable.
 	iterator erase(const_iterator first, const_iterator last)
 	{
-		return delegate.erase(first, last);
+		return detail::erase(detail::is_relocating<T>(), delegate, first, last);
+	}
+
+	/// Erase all elements satisfying predicate, keeping the order of the others. Partitions are filtered concurrently
+	/// per execution policy, so predicate must be safe to call concurrently. Returns number of erased elements.
+	template<typename ExecutionPolicy, typename Predicate>
+	typename std::enable_if<execution::is_execution_policy<ExecutionPolicy>::value, size_type>::type
+	erase_if(const ExecutionPolicy& policy, Predicate predicate)
+	{
+		return execution::erase_if(policy, delegate, predicate);
+	}
+
+	/// Write binary image of the elements to sink, as versioned header followed by the raw payload in a single bulk
+	/// write. Available for trivially copyable T. Throws serialization::Error if writing fails.
+	template<typename U = T>
+	typename std::enable_if<std::is_trivially_copyable<U>::value>::type serialize(std::ostream& sink) const
+	{
+		serialization::serialize<T>(sink, delegate.data(), delegate.size());
+	}
+
+	/// Replace elements by those of the binary image read from source in bulk reads. Available for trivially copyable
+	/// T. Throws serialization::Error if the image is truncated or incompatible, leaving this vector unchanged.
+	template<typename U = T>
+	typename std::enable_if<std::is_trivially_copyable<U>::value>::type deserialize(std::istream& source)
+	{
+		DelegateType loaded(delegate.get_allocator());
+		serialization::deserialize(source, loaded);
+		delegate.swap(loaded);
 	}
 
 	/// Forwarded to std::vector<T>::swap(std::vector<bool>& other).
@@ -460,11 +554,12 @@ public:
 		delegate.clear();
 	}
 
-	/// Forwarded to std::vector<T>::emplace(const_iterator position, Args&&... args).
+	/// Forwarded to std::vector<T>::emplace(const_iterator position, Args&&... args), relocating subsequent elements by
+	/// a single memmove if value_type is_trivially_relocatable.
 	template<typename... Args>
 	iterator emplace(const_iterator position, Args&&... args)
 	{
-		return delegate.emplace(position, std::forward<Args>(args)...);
+		return detail::emplace(detail::is_relocating<T>(), delegate, position, std::forward<Args>(args)...);
 	}
 
 	/// Forwarded to std::vector<T>::emplace_back(Args&&... args).
@@ -1005,6 +1100,27 @@ void swap(const Vector<T, Allocator>& lhs, const Vector<T, Allocator>& rhs)
 	swap(lhs.delegate, rhs.delegate);
 }
 
+/// Vectors are trivially relocatable if their allocator is, and std::vector is, see POLYMORPHIC_RELOCATABLE_DELEGATES.
+template<typename T, typename Allocator>
+struct is_trivially_relocatable<Vector<T, Allocator>>
+	: std::integral_constant<bool, POLYMORPHIC_RELOCATABLE_DELEGATES && is_trivially_relocatable<Allocator>::value>
+{
+};
+
+} // namespace Polymorphic
+
+#ifdef POLYMORPHIC_EXTERN_TEMPLATES
+#include <string>
+
+namespace Polymorphic {
+
+// Explicitly instantiated by the Polymorphic::Instantiations library.
+extern template class Vector<int>;
+extern template class Vector<long>;
+extern template class Vector<double>;
+extern template class Vector<std::string>;
+
 } // namespace Polymorphic
+#endif // POLYMORPHIC_EXTERN_TEMPLATES
 
 #endif // Polymorphic_Vector_INCLUDED
@@ -0,0 +1,16 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Deque.h"
+#include <string>
+
+namespace Polymorphic {
+
+template class Deque<int>;
+template class Deque<std::string>;
+
+} // namespace Polymorphic
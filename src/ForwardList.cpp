@@ -0,0 +1,17 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Execution.h"
+#include "Polymorphic/ForwardList.h"
+#include <string>
+
+namespace Polymorphic {
+
+template class ForwardList<int>;
+template class ForwardList<std::string>;
+
+} // namespace Polymorphic
@@ -0,0 +1,17 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Execution.h"
+#include "Polymorphic/List.h"
+#include <string>
+
+namespace Polymorphic {
+
+template class List<int>;
+template class List<std::string>;
+
+} // namespace Polymorphic
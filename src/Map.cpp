@@ -0,0 +1,17 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Map.h"
+#include <string>
+
+namespace Polymorphic {
+
+template class Map<int, int>;
+template class Map<std::string, int>;
+template class Map<std::string, std::string>;
+
+} // namespace Polymorphic
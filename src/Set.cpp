@@ -0,0 +1,16 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Set.h"
+#include <string>
+
+namespace Polymorphic {
+
+template class Set<int>;
+template class Set<std::string>;
+
+} // namespace Polymorphic
@@ -0,0 +1,14 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/String.h"
+
+namespace Polymorphic {
+
+template class BasicString<char>;
+
+} // namespace Polymorphic
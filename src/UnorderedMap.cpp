@@ -0,0 +1,17 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/UnorderedMap.h"
+#include <string>
+
+namespace Polymorphic {
+
+template class UnorderedMap<int, int>;
+template class UnorderedMap<std::string, int>;
+template class UnorderedMap<std::string, std::string>;
+
+} // namespace Polymorphic
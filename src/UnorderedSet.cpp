@@ -0,0 +1,16 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/UnorderedSet.h"
+#include <string>
+
+namespace Polymorphic {
+
+template class UnorderedSet<int>;
+template class UnorderedSet<std::string>;
+
+} // namespace Polymorphic
@@ -0,0 +1,18 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Vector.h"
+#include <string>
+
+namespace Polymorphic {
+
+template class Vector<int>;
+template class Vector<long>;
+template class Vector<double>;
+template class Vector<std::string>;
+
+} // namespace Polymorphic
@@ -0,0 +1,199 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_ArrayTestSuite_INCLUDED
+#define Testee_ArrayTestSuite_INCLUDED
+
+#include "Testee/TestSuite.h"
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+
+namespace Testee {
+
+/// Test ArrayType C++11 standard array interface.
+template<template<typename, std::size_t> class ArrayType, typename T>
+class ArrayTestSuite : public TestSuite
+{
+public:
+	ArrayTestSuite(const std::string& arrayType) :
+		TestSuite(
+			arrayType + " C++11 standard interface",
+			{
+
+				TestCase(
+					"typedefs",
+					[] {
+						TestCase::assert(std::is_same<typename ArrayType<T, 3>::value_type, T>::value, "value_type");
+						TestCase::assert(std::is_same<typename ArrayType<T, 3>::reference, T&>::value, "reference");
+						TestCase::assert(
+							std::is_same<typename ArrayType<T, 3>::const_reference, const T&>::value, "const_reference");
+						TestCase::assert(std::is_same<typename ArrayType<T, 3>::pointer, T*>::value, "pointer");
+						TestCase::assert(std::is_same<typename ArrayType<T, 3>::size_type, std::size_t>::value, "size_type");
+					}),
+
+				TestCase(
+					"in place storage",
+					[] {
+						// Elements live inside the object, only a vtable pointer may be added.
+						TestCase::assert(sizeof(ArrayType<T, 16>) >= sizeof(std::array<T, 16>), "lower bound");
+						TestCase::assert(
+							sizeof(ArrayType<T, 16>) <= sizeof(std::array<T, 16>) + sizeof(void*) + alignof(ArrayType<T, 16>),
+							"upper bound");
+					}),
+
+				TestCase(
+					"ctor initializer",
+					[] {
+						const ArrayType<T, 3> testee{{T(1), T(2), T(3)}};
+						TestCase::assert(testee[0] == T(1) && testee[1] == T(2) && testee[2] == T(3));
+					}),
+
+				TestCase(
+					"ctor partial initializer",
+					[] {
+						const ArrayType<T, 3> testee{{T(1)}};
+						TestCase::assert(testee[0] == T(1) && testee[1] == T() && testee[2] == T());
+					}),
+
+				TestCase(
+					"no conversion from element",
+					[] {
+						TestCase::assert(!std::is_convertible<T, ArrayType<T, 3>>::value, "partial");
+						TestCase::assert(!std::is_convertible<T, ArrayType<T, 1>>::value, "complete");
+						const ArrayType<T, 3> testee{T(1)};
+						TestCase::assert(testee[0] == T(1) && testee[1] == T(), "direct");
+					}),
+
+				TestCase(
+					"ctor copy",
+					[] {
+						const ArrayType<T, 3> other{{T(1), T(2), T(3)}};
+						ArrayType<T, 3> testee(other);
+						TestCase::assert(testee == other);
+					}),
+
+				TestCase(
+					"ctor move",
+					[] {
+						ArrayType<T, 3> other{{T(1), T(2), T(3)}};
+						ArrayType<T, 3> testee(std::move(other));
+						TestCase::assert(testee[0] == T(1) && testee[2] == T(3));
+					}),
+
+				TestCase(
+					"operator= copy",
+					[] {
+						const ArrayType<T, 3> other{{T(1), T(2), T(3)}};
+						ArrayType<T, 3> testee{};
+						auto& result = (testee = other);
+						TestCase::assert(&result == &testee, "result");
+						TestCase::assert(testee == other, "elements");
+					}),
+
+				TestCase(
+					"fill",
+					[] {
+						ArrayType<T, 3> testee{};
+						testee.fill(T(7));
+						TestCase::assert(std::count(testee.begin(), testee.end(), T(7)) == 3);
+					}),
+
+				TestCase(
+					"swap",
+					[] {
+						ArrayType<T, 2> testee{{T(1), T(2)}};
+						ArrayType<T, 2> other{{T(3), T(4)}};
+						testee.swap(other);
+						TestCase::assert(testee[0] == T(3) && other[0] == T(1), "member");
+						using std::swap;
+						swap(testee, other);
+						TestCase::assert(testee[0] == T(1) && other[0] == T(3), "non-member");
+					}),
+
+				TestCase(
+					"iterators",
+					[] {
+						ArrayType<T, 3> testee{{T(1), T(2), T(3)}};
+						TestCase::assert(testee.end() - testee.begin() == 3, "begin end");
+						TestCase::assert(*testee.rbegin() == T(3) && testee.rend() - testee.rbegin() == 3, "rbegin rend");
+						const ArrayType<T, 3>& constTestee = testee;
+						TestCase::assert(*constTestee.begin() == T(1) && *testee.cbegin() == T(1), "const");
+						TestCase::assert(*testee.crbegin() == T(3) && testee.cend() - testee.cbegin() == 3, "cbegin cend");
+						*testee.begin() = T(4);
+						TestCase::assert(testee[0] == T(4), "mutable");
+					}),
+
+				TestCase(
+					"size",
+					[] {
+						const ArrayType<T, 3> testee{};
+						TestCase::assert(testee.size() == 3, "size");
+						TestCase::assert(testee.max_size() == 3, "max_size");
+						TestCase::assert(!testee.empty(), "empty");
+						const ArrayType<T, 0> none{};
+						TestCase::assert(none.size() == 0 && none.empty() && none.begin() == none.end(), "zero");
+					}),
+
+				TestCase(
+					"element access",
+					[] {
+						ArrayType<T, 3> testee{{T(1), T(2), T(3)}};
+						testee[1] = T(5);
+						testee.at(2) = T(6);
+						const ArrayType<T, 3>& constTestee = testee;
+						TestCase::assert(constTestee.at(1) == T(5) && constTestee[2] == T(6), "at");
+						TestCase::assert(testee.front() == T(1) && constTestee.front() == T(1), "front");
+						TestCase::assert(testee.back() == T(6) && constTestee.back() == T(6), "back");
+						TestCase::assert(testee.data() == &testee[0] && constTestee.data() == &constTestee[0], "data");
+					}),
+
+				TestCase(
+					"at out of range",
+					[] {
+						const ArrayType<T, 3> testee{};
+						bool thrown = false;
+						try {
+							testee.at(3);
+						} catch (std::out_of_range&) {
+							thrown = true;
+						}
+						TestCase::assert(thrown);
+					}),
+
+				TestCase(
+					"comparison",
+					[] {
+						const ArrayType<T, 2> lower{{T(1), T(2)}};
+						const ArrayType<T, 2> upper{{T(1), T(3)}};
+						TestCase::assert(lower == lower && lower != upper, "equality");
+						TestCase::assert(lower < upper && lower <= upper && upper > lower && upper >= lower, "ordering");
+					}),
+
+				TestCase(
+					"tuple interface",
+					[] {
+						using std::get;
+						ArrayType<T, 2> testee{{T(1), T(2)}};
+						TestCase::assert(std::tuple_size<ArrayType<T, 2>>::value == 2, "tuple_size");
+						TestCase::assert(
+							std::is_same<typename std::tuple_element<1, ArrayType<T, 2>>::type, T>::value, "tuple_element");
+						get<1>(testee) = T(4);
+						const ArrayType<T, 2>& constTestee = testee;
+						TestCase::assert(get<0>(constTestee) == T(1) && get<1>(constTestee) == T(4), "get");
+						TestCase::assert(get<0>(std::move(testee)) == T(1), "get rvalue");
+					}),
+			})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_ArrayTestSuite_INCLUDED
@@ -0,0 +1,165 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_BenchCase_INCLUDED
+#define Testee_BenchCase_INCLUDED
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Testee {
+
+/// Keep the compiler from optimizing away the computation of value, or stores through it.
+template<typename T>
+inline void escape(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "g"(&value) : "memory");
+#else
+	static volatile const void* sink;
+	sink = &value;
+#endif
+}
+
+/// Distinct values for bench cases, scattered by a multiplicative hash so that their order is not sorted.
+template<typename T>
+struct BenchValue
+{
+	static T make(std::size_t i)
+	{
+		return static_cast<T>(static_cast<std::uint32_t>(i * 2654435761u));
+	}
+};
+
+/// Distinct strings for bench cases, too long for the small string optimization of common libraries.
+template<>
+struct BenchValue<std::string>
+{
+	static std::string make(std::size_t i)
+	{
+		return "bench value " + std::to_string(static_cast<std::uint32_t>(i * 2654435761u));
+	}
+};
+
+/// Wall clock time of the measured parts of a benchmark run, accumulated across start() and stop() pairs. Optionally
+/// records the duration of each pair as a lap, for latency distributions.
+class Stopwatch
+{
+public:
+	Stopwatch() : elapsed(0), started(), recording(false), laps()
+	{
+	}
+
+	void start()
+	{
+		started = Clock::now();
+	}
+
+	void stop()
+	{
+		double lap = std::chrono::duration<double>(Clock::now() - started).count();
+		elapsed += lap;
+		if (recording) {
+			laps.push_back(lap);
+		}
+	}
+
+	double seconds() const
+	{
+		return elapsed;
+	}
+
+	/// Record seconds of each subsequent start() and stop() pair, reserving room for expected laps up front, so that
+	/// recording does not allocate while measuring.
+	void recordLaps(std::size_t expected)
+	{
+		recording = true;
+		laps.reserve(expected);
+	}
+
+	/// Recorded seconds of start() and stop() pairs, in order.
+	const std::vector<double>& getLaps() const noexcept
+	{
+		return laps;
+	}
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	double elapsed;
+	Clock::time_point started;
+	bool recording;
+	std::vector<double> laps;
+};
+
+/// Operation timed on count elements, by a reference runner, e.g. using a std container, and a candidate runner, e.g.
+/// using its Polymorphic decorator. Runners set up their data, then time the operation by their Stopwatch.
+class BenchCase
+{
+public:
+	typedef std::function<void(Stopwatch&)> Runner;
+
+	BenchCase(const std::string& name, std::size_t count, const Runner& reference, const Runner& candidate) :
+		name(name),
+		count(count),
+		reference(reference),
+		candidate(candidate)
+	{
+	}
+
+	const std::string& getName() const noexcept
+	{
+		return name;
+	}
+
+	std::size_t getCount() const noexcept
+	{
+		return count;
+	}
+
+	/// Seconds measured by a run of the reference runner.
+	double runReference() const
+	{
+		Stopwatch stopwatch;
+		reference(stopwatch);
+		return stopwatch.seconds();
+	}
+
+	/// Seconds measured by a run of the candidate runner.
+	double runCandidate() const
+	{
+		Stopwatch stopwatch;
+		candidate(stopwatch);
+		return stopwatch.seconds();
+	}
+
+	/// Run the reference runner timed by stopwatch, e.g. one recording laps.
+	void runReference(Stopwatch& stopwatch) const
+	{
+		reference(stopwatch);
+	}
+
+	/// Run the candidate runner timed by stopwatch, e.g. one recording laps.
+	void runCandidate(Stopwatch& stopwatch) const
+	{
+		candidate(stopwatch);
+	}
+
+private:
+	std::string name;
+	std::size_t count;
+	Runner reference;
+	Runner candidate;
+};
+
+} // namespace Testee
+
+#endif // Testee_BenchCase_INCLUDED
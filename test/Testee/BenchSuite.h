@@ -0,0 +1,246 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_BenchSuite_INCLUDED
+#define Testee_BenchSuite_INCLUDED
+
+#include "BenchCase.h"
+#include "Json.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Testee {
+
+/// Counterpart of TestSuite timing bench cases, and reporting the difference between their reference and candidate
+/// runners per case. Runs of both alternate, so that drift of the machine affects both alike.
+class BenchSuite
+{
+public:
+	/// Options of run(const Options& options).
+	struct Options
+	{
+		/// Runs of each runner before measuring, warming caches and the allocator.
+		unsigned int warmup;
+		/// Measured runs of each runner.
+		unsigned int repetitions;
+		/// Median slowdown of candidates, in percent, reported as regression and failing run(), unchecked if 0.
+		double tolerance;
+		/// File appending one JSON line per suite run, holding the statistics of all cases, none if empty.
+		std::string json;
+
+		Options() : warmup(1), repetitions(9), tolerance(0), json()
+		{
+		}
+
+		/// Options set by environment variables TESTEE_BENCH_WARMUP, TESTEE_BENCH_REPETITIONS, TESTEE_BENCH_TOLERANCE
+		/// and TESTEE_BENCH_JSON.
+		static Options fromEnvironment()
+		{
+			Options options;
+			if (const char* warmup = std::getenv("TESTEE_BENCH_WARMUP")) {
+				options.warmup = static_cast<unsigned int>(std::strtoul(warmup, nullptr, 10));
+			}
+			if (const char* repetitions = std::getenv("TESTEE_BENCH_REPETITIONS")) {
+				options.repetitions = std::max(1u, static_cast<unsigned int>(std::strtoul(repetitions, nullptr, 10)));
+			}
+			if (const char* tolerance = std::getenv("TESTEE_BENCH_TOLERANCE")) {
+				options.tolerance = std::strtod(tolerance, nullptr);
+			}
+			if (const char* json = std::getenv("TESTEE_BENCH_JSON")) {
+				options.json = json;
+			}
+			return options;
+		}
+	};
+
+	/// Summary of samples.
+	struct Statistics
+	{
+		Statistics() : minimum(0), median(0), mean(0), deviation(0)
+		{
+		}
+
+		/// Statistics of samples, with deviation being the sample standard deviation.
+		static Statistics of(std::vector<double> samples)
+		{
+			Statistics result;
+			if (samples.empty()) {
+				return result;
+			}
+			std::sort(samples.begin(), samples.end());
+			std::size_t size = samples.size();
+			result.minimum = samples.front();
+			result.median = size % 2 ? samples[size / 2] : (samples[size / 2 - 1] + samples[size / 2]) / 2;
+			double sum = 0;
+			for (double sample : samples) {
+				sum += sample;
+			}
+			result.mean = sum / size;
+			if (size > 1) {
+				double squares = 0;
+				for (double sample : samples) {
+					squares += (sample - result.mean) * (sample - result.mean);
+				}
+				result.deviation = std::sqrt(squares / (size - 1));
+			}
+			return result;
+		}
+
+		/// Deviation relative to mean, in percent.
+		double relativeDeviation() const
+		{
+			return mean > 0 ? 100 * deviation / mean : 0;
+		}
+
+		double minimum;
+		double median;
+		double mean;
+		double deviation;
+	};
+
+	/// Statistics of a bench case, in nanoseconds per element.
+	struct Result
+	{
+		Statistics reference;
+		Statistics candidate;
+
+		/// Difference of candidate median from reference median, in percent of the latter.
+		double difference() const
+		{
+			return reference.median > 0 ? 100 * (candidate.median / reference.median - 1) : 0;
+		}
+	};
+
+	BenchSuite(
+		const std::string& subject, const std::string& reference, const std::string& candidate, std::list<BenchCase>&& benchCases) :
+		subject(subject),
+		reference(reference),
+		candidate(candidate),
+		benchCases(std::move(benchCases))
+	{
+	}
+
+	virtual ~BenchSuite()
+	{
+	}
+
+	/// Run bench cases with options from the environment, see Options::fromEnvironment().
+	virtual bool run()
+	{
+		return run(Options::fromEnvironment());
+	}
+
+	/// Run bench cases, printing median time per element of reference and candidate, their relative deviations, and
+	/// the difference of candidate from reference. Returns false if any difference exceeds options.tolerance.
+	bool run(const Options& options)
+	{
+		std::cout << "Benchmarking " << subject << ", " << candidate << " vs " << reference << ", median ns per element of "
+				  << options.repetitions << " runs ..." << std::endl;
+		char line[256];
+		const char* header = "%-28s %10s %12s %6s %12s %6s %9s";
+		std::snprintf(line, sizeof(line), header, "case", "count", "reference", "+-%", "candidate", "+-%", "diff");
+		std::cout << line << std::endl;
+		std::vector<Result> results;
+		unsigned int regressions = 0;
+		for (const auto& benchCase : benchCases) {
+			results.push_back(measure(benchCase, options));
+			const Result& result = results.back();
+			bool regressed = options.tolerance > 0 && result.difference() > options.tolerance;
+			regressions += regressed ? 1 : 0;
+			std::snprintf(
+				line,
+				sizeof(line),
+				"%-28s %10zu %12.3f %6.1f %12.3f %6.1f %+8.1f%%%s",
+				benchCase.getName().c_str(),
+				benchCase.getCount(),
+				result.reference.median,
+				result.reference.relativeDeviation(),
+				result.candidate.median,
+				result.candidate.relativeDeviation(),
+				result.difference(),
+				regressed ? "  regression" : "");
+			std::cout << line << std::endl;
+		}
+		std::cout << "... cases: " << results.size() << ", regressions: " << regressions << std::endl;
+		if (!options.json.empty()) {
+			writeJson(options.json, results);
+		}
+		return regressions == 0;
+	}
+
+protected:
+	std::string subject;
+	std::string reference;
+	std::string candidate;
+	std::list<BenchCase> benchCases;
+
+private:
+	static Result measure(const BenchCase& benchCase, const Options& options)
+	{
+		for (unsigned int i = 0; i < options.warmup; ++i) {
+			benchCase.runReference();
+			benchCase.runCandidate();
+		}
+		double scale = 1e9 / std::max<std::size_t>(benchCase.getCount(), 1);
+		std::vector<double> referenceSamples;
+		std::vector<double> candidateSamples;
+		for (unsigned int i = 0; i < options.repetitions; ++i) {
+			if (i % 2) {
+				candidateSamples.push_back(benchCase.runCandidate() * scale);
+				referenceSamples.push_back(benchCase.runReference() * scale);
+			} else {
+				referenceSamples.push_back(benchCase.runReference() * scale);
+				candidateSamples.push_back(benchCase.runCandidate() * scale);
+			}
+		}
+		Result result;
+		result.reference = Statistics::of(referenceSamples);
+		result.candidate = Statistics::of(candidateSamples);
+		return result;
+	}
+
+	static void writeStatistics(std::ostream& line, const Statistics& statistics)
+	{
+		line << "{\"minimum\":" << statistics.minimum << ",\"median\":" << statistics.median << ",\"mean\":" << statistics.mean
+			 << ",\"deviation\":" << statistics.deviation << "}";
+	}
+
+	void writeJson(const std::string& path, const std::vector<Result>& results) const
+	{
+		std::ostringstream line;
+		line.precision(9);
+		line << "{\"suite\":" << jsonString(subject) << ",\"reference\":" << jsonString(reference)
+			 << ",\"candidate\":" << jsonString(candidate) << ",\"cases\":[";
+		auto benchCase = benchCases.begin();
+		for (std::size_t i = 0; i < results.size(); ++i, ++benchCase) {
+			line << (i == 0 ? "" : ",") << "{\"name\":" << jsonString(benchCase->getName())
+				 << ",\"count\":" << benchCase->getCount() << ",\"reference\":";
+			writeStatistics(line, results[i].reference);
+			line << ",\"candidate\":";
+			writeStatistics(line, results[i].candidate);
+			line << ",\"difference\":" << results[i].difference() << "}";
+		}
+		line << "]}\n";
+		std::ofstream file(path, std::ios::app);
+		file << line.str();
+		if (!file) {
+			std::cerr << "Cannot append benchmark results to " << path << std::endl;
+		}
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_BenchSuite_INCLUDED
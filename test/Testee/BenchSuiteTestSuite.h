@@ -0,0 +1,174 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_BenchSuiteTestSuite_INCLUDED
+#define Testee_BenchSuiteTestSuite_INCLUDED
+
+#include "Polymorphic/Map.h"
+#include "Polymorphic/UnorderedMap.h"
+#include "Polymorphic/Vector.h"
+#include "Testee/BenchSuite.h"
+#include "Testee/LatencyBenchSuite.h"
+#include "Testee/MapLatencyBenchSuite.h"
+#include "Testee/MapBenchSuite.h"
+#include "Testee/SequenceBenchSuite.h"
+#include "Testee/TestSuite.h"
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Testee {
+
+/// Test Testee::BenchSuite and Testee::LatencyBenchSuite statistics, measurement and reporting.
+class BenchSuiteTestSuite : public TestSuite
+{
+public:
+	/// Busy loop of n iterations.
+	static void spin(std::size_t n)
+	{
+		for (std::size_t i = 0; i < n; ++i) {
+			escape(i);
+		}
+	}
+
+	/// Options for quick runs.
+	static BenchSuite::Options quick(unsigned int repetitions = 3)
+	{
+		BenchSuite::Options options;
+		options.warmup = 1;
+		options.repetitions = repetitions;
+		return options;
+	}
+
+	BenchSuiteTestSuite() :
+		TestSuite(
+			"Testee::BenchSuite",
+			{
+
+				TestCase(
+					"statistics",
+					[] {
+						BenchSuite::Statistics statistics = BenchSuite::Statistics::of({4, 1, 3, 2});
+						TestCase::assert(statistics.minimum == 1 && statistics.median == 2.5 && statistics.mean == 2.5, "even");
+						TestCase::assert(std::fabs(statistics.deviation - std::sqrt(5.0 / 3)) < 1e-12, "deviation");
+						statistics = BenchSuite::Statistics::of({5, 1, 3});
+						TestCase::assert(statistics.median == 3 && statistics.deviation == 2, "odd");
+						statistics = BenchSuite::Statistics::of({7});
+						TestCase::assert(statistics.median == 7 && statistics.deviation == 0, "single");
+					}),
+
+				TestCase(
+					"stopwatch",
+					[] {
+						Stopwatch stopwatch;
+						TestCase::assert(stopwatch.seconds() == 0, "initial");
+						stopwatch.start();
+						spin(100000);
+						stopwatch.stop();
+						double first = stopwatch.seconds();
+						stopwatch.start();
+						spin(100000);
+						stopwatch.stop();
+						TestCase::assert(first > 0 && stopwatch.seconds() > first, "accumulated");
+					}),
+
+				TestCase(
+					"laps and percentiles",
+					[] {
+						Stopwatch stopwatch;
+						stopwatch.recordLaps(3);
+						for (int i = 0; i < 3; ++i) {
+							stopwatch.start();
+							spin(10000);
+							stopwatch.stop();
+						}
+						TestCase::assert(stopwatch.getLaps().size() == 3, "laps");
+						std::vector<double> laps;
+						for (int i = 1000; i > 0; --i) {
+							laps.push_back(i * 1e-9);
+						}
+						LatencyBenchSuite::Percentiles percentiles = LatencyBenchSuite::Percentiles::of(laps);
+						TestCase::assert(std::fabs(percentiles.p50 - 500) < 1e-6, "p50");
+						TestCase::assert(std::fabs(percentiles.p99 - 990) < 1e-6, "p99");
+						TestCase::assert(std::fabs(percentiles.p999 - 999) < 1e-6, "p999");
+						TestCase::assert(std::fabs(percentiles.maximum - 1000) < 1e-6, "maximum");
+						MapLatencyBenchSuite<std::map, Polymorphic::Map, int, int> testee(
+							"Map<int, int>", "std::map", "Polymorphic::Map", {100});
+						TestCase::assert(testee.run(), "map latency");
+					}),
+
+				TestCase(
+					"warmup and repetitions",
+					[] {
+						auto referenceRuns = std::make_shared<int>(0);
+						auto candidateRuns = std::make_shared<int>(0);
+						BenchSuite testee(
+							"counting",
+							"reference",
+							"candidate",
+							{BenchCase(
+								"runs",
+								1,
+								[referenceRuns](Stopwatch&) { ++*referenceRuns; },
+								[candidateRuns](Stopwatch&) { ++*candidateRuns; })});
+						TestCase::assert(testee.run(quick(5)), "passed");
+						TestCase::assert(*referenceRuns == 6 && *candidateRuns == 6, "runs");
+					}),
+
+				TestCase(
+					"regressions",
+					[] {
+						auto fast = [](Stopwatch& stopwatch) {
+							stopwatch.start();
+							spin(10000);
+							stopwatch.stop();
+						};
+						auto slow = [](Stopwatch& stopwatch) {
+							stopwatch.start();
+							spin(1000000);
+							stopwatch.stop();
+						};
+						BenchSuite testee("regressions", "fast", "slow", {BenchCase("spin", 10000, fast, slow)});
+						TestCase::assert(testee.run(quick()), "unchecked");
+						BenchSuite::Options options = quick();
+						options.tolerance = 50;
+						TestCase::assert(!testee.run(options), "regression");
+						BenchSuite reversed("regressions", "slow", "fast", {BenchCase("spin", 10000, slow, fast)});
+						TestCase::assert(reversed.run(options), "improvement");
+					}),
+
+				TestCase(
+					"container suites",
+					[] {
+						std::vector<std::size_t> counts{10, 100};
+						TestCase::assert(
+							SequenceBenchSuite<std::vector, Polymorphic::Vector, std::string>(
+								"Vector<std::string>", "std::vector", "Polymorphic::Vector", counts)
+								.run(quick(1)),
+							"sequence");
+						TestCase::assert(
+							MapBenchSuite<std::map, Polymorphic::Map, std::string, int>(
+								"Map<std::string, int>", "std::map", "Polymorphic::Map", counts)
+								.run(quick(1)),
+							"map");
+						TestCase::assert(
+							MapBenchSuite<std::unordered_map, Polymorphic::UnorderedMap, int, int>(
+								"UnorderedMap<int, int>", "std::unordered_map", "Polymorphic::UnorderedMap", counts)
+								.run(quick(1)),
+							"unordered map");
+					}),
+			})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_BenchSuiteTestSuite_INCLUDED
@@ -0,0 +1,206 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_BlockDequeTestSuite_INCLUDED
+#define Testee_BlockDequeTestSuite_INCLUDED
+
+#include "Testee/TestSuite.h"
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Testee {
+
+/// Test DequeType block size and recycling extensions to the deque interface, for value_type int.
+template<typename DequeType>
+class BlockDequeTestSuite : public TestSuite
+{
+	/// DequeType with value_type U, same block size and rebound allocator.
+	template<typename Deque, typename U>
+	struct Rebind;
+
+	template<
+		template<typename, std::size_t, typename> class Deque,
+		typename T,
+		std::size_t BlockBytes,
+		typename Allocator,
+		typename U>
+	struct Rebind<Deque<T, BlockBytes, Allocator>, U>
+	{
+		typedef Deque<U, BlockBytes, typename std::allocator_traits<Allocator>::template rebind_alloc<U>> type;
+	};
+
+public:
+	typedef typename DequeType::size_type SizeType;
+
+	/// True if testee elements equal reference elements.
+	static bool equal(const DequeType& testee, const std::deque<int>& reference)
+	{
+		return testee.size() == reference.size() && std::equal(reference.begin(), reference.end(), testee.begin());
+	}
+
+	BlockDequeTestSuite(const std::string& dequeType) :
+		TestSuite(
+			dequeType + " block size and recycling extensions",
+			{
+
+				TestCase(
+					"block_size",
+					[] {
+						SizeType result = DequeType::block_size();
+						TestCase::assert(result > 0 && (result & (result - 1)) == 0, "power of two");
+						TestCase::assert(result == 1 || result * sizeof(int) <= 4096, "fits");
+					}),
+
+				TestCase(
+					"push both ends",
+					[] {
+						DequeType testee;
+						std::deque<int> reference;
+						for (int i = 0; i < 1000; ++i) {
+							testee.push_back(i);
+							reference.push_back(i);
+							testee.push_front(-i);
+							reference.push_front(-i);
+						}
+						TestCase::assert(equal(testee, reference), "elements");
+						TestCase::assert(testee[0] == -999 && testee.at(1999) == 999, "random access");
+						TestCase::assert(testee.end() - testee.begin() == 2000, "distance");
+						TestCase::assert(*(testee.begin() + 1500) == reference[1500], "iterator arithmetic");
+					}),
+
+				TestCase(
+					"random operations",
+					[] {
+						std::mt19937 random(11);
+						DequeType testee;
+						std::deque<int> reference;
+						for (int step = 0; step < 20000; ++step) {
+							int value = static_cast<int>(random() % 1000);
+							switch (random() % 8) {
+							case 0:
+							case 1:
+								testee.push_back(value);
+								reference.push_back(value);
+								break;
+							case 2:
+							case 3:
+								testee.push_front(value);
+								reference.push_front(value);
+								break;
+							case 4:
+								if (!reference.empty()) {
+									testee.pop_back();
+									reference.pop_back();
+								}
+								break;
+							case 5:
+								if (!reference.empty()) {
+									testee.pop_front();
+									reference.pop_front();
+								}
+								break;
+							case 6: {
+								std::size_t offset = random() % (reference.size() + 1);
+								testee.insert(testee.begin() + offset, value);
+								reference.insert(reference.begin() + offset, value);
+								break;
+							}
+							default:
+								if (!reference.empty()) {
+									std::size_t offset = random() % reference.size();
+									std::size_t n = std::min<std::size_t>(random() % 4, reference.size() - offset);
+									testee.erase(testee.begin() + offset, testee.begin() + (offset + n));
+									reference.erase(reference.begin() + offset, reference.begin() + (offset + n));
+								}
+							}
+						}
+						TestCase::assert(equal(testee, reference), "elements");
+						std::sort(testee.begin(), testee.end());
+						std::sort(reference.begin(), reference.end());
+						TestCase::assert(equal(testee, reference), "sorted");
+					}),
+
+				TestCase(
+					"recycling disabled",
+					[] {
+						DequeType testee;
+						TestCase::assert(!testee.recycles(), "default");
+						testee.resize(10 * DequeType::block_size());
+						testee.clear();
+						TestCase::assert(testee.spare_blocks() == 0, "freed");
+					}),
+
+				TestCase(
+					"recycling",
+					[] {
+						DequeType testee;
+						testee.set_recycling(true);
+						TestCase::assert(testee.recycles(), "enabled");
+						SizeType n = 10 * DequeType::block_size();
+						for (SizeType i = 0; i < n; ++i) {
+							testee.push_back(static_cast<int>(i));
+						}
+						for (SizeType i = 0; i < n; ++i) {
+							testee.pop_front();
+						}
+						SizeType spare = testee.spare_blocks();
+						TestCase::assert(spare >= 9, "kept");
+						for (SizeType i = 0; i < n / 2; ++i) {
+							testee.push_front(static_cast<int>(i));
+						}
+						TestCase::assert(testee.spare_blocks() < spare, "reused");
+						TestCase::assert(testee.front() == static_cast<int>(n / 2 - 1) && testee.back() == 0, "elements");
+						testee.shrink_to_fit();
+						TestCase::assert(testee.spare_blocks() == 0, "shrink_to_fit");
+						TestCase::assert(testee.size() == n / 2 && testee[n / 2 - 1] == 0, "shrunk elements");
+					}),
+
+				TestCase(
+					"move swap",
+					[] {
+						DequeType testee{1, 2, 3};
+						testee.set_recycling(true);
+						DequeType moved(std::move(testee));
+						TestCase::assert(moved.size() == 3 && moved.recycles() && testee.empty(), "move");
+						testee.push_back(4);
+						TestCase::assert(testee.size() == 1 && testee.front() == 4, "reuse moved from");
+						swap(testee, moved);
+						TestCase::assert(testee.size() == 3 && testee.recycles() && moved.size() == 1, "swap");
+						moved = std::move(testee);
+						TestCase::assert(moved.size() == 3 && moved.back() == 3, "move assignment");
+					}),
+
+				TestCase(
+					"erase empty range",
+					[] {
+						// Elements emptied by self move assignment, unlike int.
+						typename Rebind<DequeType, std::vector<int>>::type testee;
+						for (int i = 0; i < 5; ++i) {
+							testee.push_back(std::vector<int>(3, i));
+						}
+						for (int offset = 0; offset <= 5; ++offset) {
+							auto result = testee.erase(testee.begin() + offset, testee.begin() + offset);
+							TestCase::assert(result == testee.begin() + offset, "result");
+						}
+						TestCase::assert(testee.size() == 5, "size");
+						for (int i = 0; i < 5; ++i) {
+							TestCase::assert(testee[i] == std::vector<int>(3, i), "elements");
+						}
+					}),
+			})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_BlockDequeTestSuite_INCLUDED
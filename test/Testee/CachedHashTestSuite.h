@@ -0,0 +1,161 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_CachedHashTestSuite_INCLUDED
+#define Testee_CachedHashTestSuite_INCLUDED
+
+#include "Polymorphic/HashedKey.h"
+#include "Testee/TestSuite.h"
+#include <functional>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Testee {
+
+/// String hash counting its calls, per thread so that test cases may run in parallel.
+struct CountingHash
+{
+	static int& calls()
+	{
+		static thread_local int count = 0;
+		return count;
+	}
+
+	std::size_t operator()(const std::string& key) const
+	{
+		++calls();
+		return std::hash<std::string>()(key);
+	}
+};
+
+/// Test precomputed hash overloads of UnorderedType, keyed by std::string, and of CachedHashType, its cached hash
+/// policy counterpart using CountingHash.
+template<typename UnorderedType, typename CachedHashType, bool isMulti = false>
+class CachedHashTestSuite : public TestSuite
+{
+public:
+	/// Keys of 64 bytes to 4 KB.
+	static std::vector<std::string> keys()
+	{
+		std::vector<std::string> result;
+		for (std::size_t size = 64; size <= 4096; size *= 2) {
+			for (char c = 'a'; c <= 'z'; ++c) {
+				result.push_back(std::string(size - 1, 'x') + c);
+			}
+		}
+		return result;
+	}
+
+	/// Key of element at iterator.
+	template<typename Key, typename T>
+	static const Key& keyOf(const std::pair<const Key, T>& element)
+	{
+		return element.first;
+	}
+
+	/// Key of element at iterator.
+	template<typename Key>
+	static const Key& keyOf(const Key& element)
+	{
+		return element;
+	}
+
+	/// Hash code of key, as computed upstream.
+	static std::size_t hashOf(const std::string& key)
+	{
+		return std::hash<std::string>()(key);
+	}
+
+	CachedHashTestSuite(const std::string& unorderedType) :
+		TestSuite(
+			unorderedType + " precomputed hash and cached hash policy",
+			{
+
+				TestCase(
+					"HashedKey",
+					[] {
+						Polymorphic::HashedKey<std::string> key(std::string("key"));
+						TestCase::assert(key.hash_code() == hashOf("key"), "computed");
+						Polymorphic::HashedKey<std::string> precomputed(std::string("key"), 42);
+						TestCase::assert(precomputed.hash_code() == 42 && precomputed.get() == "key", "precomputed");
+						const std::string& converted = key;
+						TestCase::assert(converted == "key", "conversion");
+						TestCase::assert(key == Polymorphic::HashedKey<std::string>(std::string("key")), "equal");
+						TestCase::assert(key != precomputed, "codes differ");
+						Polymorphic::HashedKey<std::string> other(std::string("key"));
+						TestCase::assert(Polymorphic::CachedKeyEqual<std::string>()(key, other), "key_equal");
+					}),
+
+				TestCase(
+					"precomputed hash",
+					[] {
+						UnorderedType testee;
+						std::vector<std::string> values = keys();
+						for (const auto& key : values) {
+							testee.emplace_hashed(key, hashOf(key));
+						}
+						testee.emplace_hashed(values.front(), hashOf(values.front()));
+						TestCase::assert(testee.size() == values.size() + (isMulti ? 1 : 0), "emplace_hashed");
+						for (const auto& key : values) {
+							auto found = testee.find(key, hashOf(key));
+							TestCase::assert(found != testee.end() && keyOf(*found) == key, "find");
+						}
+						const UnorderedType& constTestee = testee;
+						TestCase::assert(constTestee.find(values.back(), hashOf(values.back())) != constTestee.end(), "const find");
+						TestCase::assert(testee.count(values.front(), hashOf(values.front())) == (isMulti ? 2 : 1), "count");
+						auto range = testee.equal_range(values.back(), hashOf(values.back()));
+						TestCase::assert(range.first != range.second && std::next(range.first) == range.second, "equal_range");
+						TestCase::assert(testee.find("missing", hashOf("missing")) == testee.end(), "missing");
+					}),
+
+				TestCase(
+					"cached hash policy",
+					[] {
+						CachedHashType testee;
+						std::vector<std::string> values = keys();
+						CountingHash::calls() = 0;
+						for (const auto& key : values) {
+							testee.emplace_hashed(key, hashOf(key));
+						}
+						testee.rehash(4 * testee.bucket_count());
+						testee.reserve(16 * values.size());
+						TestCase::assert(testee.size() == values.size(), "size");
+						for (const auto& key : values) {
+							auto found = testee.find(key, hashOf(key));
+							TestCase::assert(found != testee.end() && keyOf(*found).get() == key, "find");
+							TestCase::assert(testee.count(key, hashOf(key)) == 1, "count");
+						}
+						TestCase::assert(CountingHash::calls() == 0, "never hashed");
+						TestCase::assert(testee.find("missing", hashOf("missing")) == testee.end(), "missing");
+					}),
+
+				TestCase(
+					"cached hash policy hashing once",
+					[] {
+						CachedHashType testee;
+						std::vector<std::string> values = keys();
+						CountingHash::calls() = 0;
+						for (const auto& key : values) {
+							testee.emplace_hashed(key, hashOf(key));
+						}
+						testee.rehash(4 * testee.bucket_count());
+						for (const auto& key : values) {
+							typename CachedHashType::key_type hashed(key);
+							TestCase::assert(testee.find(hashed) != testee.end() && testee.count(hashed) == 1, "find");
+						}
+						TestCase::assert(CountingHash::calls() == static_cast<int>(values.size()), "hashed once per lookup");
+					}),
+			})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_CachedHashTestSuite_INCLUDED
@@ -0,0 +1,159 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_ChunkedSerializationTestSuite_INCLUDED
+#define Testee_ChunkedSerializationTestSuite_INCLUDED
+
+#include "Polymorphic/Serialization.h"
+#include "Testee/TestSuite.h"
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Testee {
+
+/// Test ContainerType chunked stream serialization round trips and codecs.
+template<typename ContainerType>
+class ChunkedSerializationTestSuite : public TestSuite
+{
+public:
+	typedef typename ContainerType::value_type ValueType;
+
+	/// Default codec counting encoded elements.
+	class CountingCodec : public Polymorphic::serialization::Codec<ValueType>
+	{
+	public:
+		explicit CountingCodec(std::size_t& encoded) : encoded(encoded)
+		{
+		}
+
+		void encode(const ValueType& value, std::vector<char>& buffer) const
+		{
+			++encoded;
+			Polymorphic::serialization::Codec<ValueType>::encode(value, buffer);
+		}
+
+	private:
+		std::size_t& encoded;
+	};
+
+	ChunkedSerializationTestSuite(const std::string& containerType, const std::vector<ValueType>& values) :
+		TestSuite(
+			containerType + " chunked stream serialization",
+			{
+
+				TestCase(
+					"round trip",
+					[values] {
+						const ContainerType original(values.begin(), values.end());
+						std::stringstream stream;
+						original.serialize(stream);
+						ContainerType testee(values.begin(), values.begin() + 1);
+						testee.deserialize(stream);
+						TestCase::assert(testee == original);
+					}),
+
+				TestCase(
+					"round trip empty",
+					[values] {
+						std::stringstream stream;
+						ContainerType().serialize(stream);
+						ContainerType testee(values.begin(), values.end());
+						testee.deserialize(stream);
+						TestCase::assert(testee.begin() == testee.end());
+					}),
+
+				TestCase(
+					"round trip small chunks",
+					[values] {
+						const ContainerType original(values.begin(), values.end());
+						std::stringstream stream;
+						original.serialize(stream, Polymorphic::serialization::Codec<ValueType>(), 1);
+						std::stringstream large;
+						original.serialize(large);
+						TestCase::assert(stream.str().size() > large.str().size(), "chunked");
+						ContainerType testee;
+						testee.deserialize(stream);
+						TestCase::assert(testee == original, "elements");
+					}),
+
+				TestCase(
+					"round trip consecutive",
+					[values] {
+						const ContainerType first(values.begin(), values.begin() + 1);
+						const ContainerType second(values.begin(), values.end());
+						std::stringstream stream;
+						first.serialize(stream);
+						second.serialize(stream);
+						ContainerType firstTestee;
+						ContainerType secondTestee;
+						firstTestee.deserialize(stream);
+						secondTestee.deserialize(stream);
+						TestCase::assert(firstTestee == first && secondTestee == second);
+					}),
+
+				TestCase(
+					"custom codec",
+					[values] {
+						const ContainerType original(values.begin(), values.end());
+						std::size_t encoded = 0;
+						std::stringstream stream;
+						original.serialize(stream, CountingCodec(encoded));
+						TestCase::assert(encoded == values.size(), "encoded");
+						ContainerType testee;
+						testee.deserialize(stream, CountingCodec(encoded));
+						TestCase::assert(testee == original, "elements");
+					}),
+
+				TestCase(
+					"corrupt count",
+					[values] {
+						std::stringstream image;
+						ContainerType(values.begin(), values.end()).serialize(image);
+						const std::uint64_t counts[] = {std::uint64_t(1) << 60, values.size() + 1, values.size() - 1};
+						for (std::uint64_t count : counts) {
+							std::string bytes = image.str();
+							Polymorphic::serialization::Header header;
+							std::memcpy(&header, bytes.data(), sizeof(header));
+							header.count = count;
+							std::memcpy(&bytes[0], &header, sizeof(header));
+							std::stringstream stream(bytes);
+							ContainerType testee(values.begin(), values.begin() + 1);
+							bool thrown = false;
+							try {
+								testee.deserialize(stream);
+							} catch (Polymorphic::serialization::Error&) {
+								thrown = true;
+							}
+							TestCase::assert(thrown, "thrown");
+							TestCase::assert(testee == ContainerType(values.begin(), values.begin() + 1), "unchanged");
+						}
+					}),
+
+				TestCase("truncated", [values] {
+					std::stringstream image;
+					ContainerType(values.begin(), values.end()).serialize(image);
+					std::stringstream stream(image.str().substr(0, image.str().size() - 1));
+					ContainerType testee(values.begin(), values.begin() + 1);
+					bool thrown = false;
+					try {
+						testee.deserialize(stream);
+					} catch (Polymorphic::serialization::Error&) {
+						thrown = true;
+					}
+					TestCase::assert(thrown, "thrown");
+					TestCase::assert(testee == ContainerType(values.begin(), values.begin() + 1), "unchanged");
+				})})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_ChunkedSerializationTestSuite_INCLUDED
@@ -0,0 +1,130 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_DefaultInitTestSuite_INCLUDED
+#define Testee_DefaultInitTestSuite_INCLUDED
+
+#include "Polymorphic/DefaultInitAllocator.h"
+#include "Testee/TestSuite.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace Testee {
+
+/// Test SequenceType resize_default_init() and resize_and_overwrite(), and DefaultInitAllocator.
+template<template<typename...> class SequenceType>
+class DefaultInitTestSuite : public TestSuite
+{
+public:
+	typedef Polymorphic::DefaultInitAllocator<int> AllocatorType;
+
+	/// Operation filling all but the first two elements with 5, keeping all but the last three.
+	struct Overwrite
+	{
+		template<typename RandomAccessIterator>
+		std::size_t operator()(RandomAccessIterator first, std::size_t n) const
+		{
+			TestCase::assert(n == 10 && first[0] == 1 && first[1] == 2, "prefix kept");
+			std::fill(first + 2, first + n, 5);
+			return n - 3;
+		}
+	};
+
+	/// Operation claiming to have written more elements than requested.
+	struct OverwriteBeyond
+	{
+		template<typename RandomAccessIterator>
+		std::size_t operator()(RandomAccessIterator, std::size_t n) const
+		{
+			return n + 5;
+		}
+	};
+
+	DefaultInitTestSuite(const std::string& sequenceType) :
+		TestSuite(
+			sequenceType + " default initialization",
+			{
+
+				TestCase(
+					"allocator construct default initializes",
+					[] {
+						AllocatorType allocator;
+						unsigned char storage[sizeof(int)];
+						std::memset(storage, 0xab, sizeof(storage));
+						allocator.construct(reinterpret_cast<int*>(storage));
+						TestCase::assert(storage[0] == 0xab && storage[sizeof(int) - 1] == 0xab, "untouched");
+						allocator.construct(reinterpret_cast<int*>(storage), 7);
+						int value;
+						std::memcpy(&value, storage, sizeof(value));
+						TestCase::assert(value == 7, "forwarded");
+					}),
+
+				TestCase(
+					"allocator rebind",
+					[] {
+						typedef std::allocator_traits<AllocatorType>::rebind_alloc<std::string> Rebound;
+						TestCase::assert(std::is_same<Rebound, Polymorphic::DefaultInitAllocator<std::string>>::value, "type");
+						Rebound rebound{AllocatorType()};
+						TestCase::assert(rebound == Rebound(), "equal");
+						std::string* element = rebound.allocate(1);
+						rebound.construct(element);
+						TestCase::assert(element->empty(), "class default constructed");
+						rebound.destroy(element);
+						rebound.deallocate(element, 1);
+					}),
+
+				TestCase(
+					"resize_default_init",
+					[] {
+						SequenceType<int, AllocatorType> testee{1, 2};
+						testee.resize_default_init(100);
+						TestCase::assert(testee.size() == 100 && testee[0] == 1 && testee[1] == 2, "grow");
+						testee.resize_default_init(1);
+						TestCase::assert(testee.size() == 1 && testee[0] == 1, "shrink");
+					}),
+
+				TestCase(
+					"resize_default_init standard allocator",
+					[] {
+						SequenceType<int> testee{1};
+						testee.resize_default_init(3);
+						TestCase::assert(testee.size() == 3 && testee[1] == 0 && testee[2] == 0);
+					}),
+
+				TestCase(
+					"resize_default_init class type",
+					[] {
+						SequenceType<std::string, Polymorphic::DefaultInitAllocator<std::string>> testee;
+						testee.resize_default_init(3);
+						TestCase::assert(testee.size() == 3 && testee[2].empty());
+					}),
+
+				TestCase(
+					"resize_and_overwrite",
+					[] {
+						SequenceType<int, AllocatorType> testee{1, 2};
+						testee.resize_and_overwrite(10, Overwrite());
+						TestCase::assert(testee.size() == 7, "size");
+						TestCase::assert(std::count(testee.begin(), testee.end(), 5) == 5, "overwritten");
+					}),
+
+				TestCase(
+					"resize_and_overwrite clamps to n",
+					[] {
+						SequenceType<int, AllocatorType> testee{1, 2};
+						testee.resize_and_overwrite(4, OverwriteBeyond());
+						TestCase::assert(testee.size() == 4 && testee[0] == 1 && testee[1] == 2, "clamped");
+					}),
+			})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_DefaultInitTestSuite_INCLUDED
@@ -0,0 +1,150 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_DequeBenchSuite_INCLUDED
+#define Testee_DequeBenchSuite_INCLUDED
+
+#include "Testee/BenchSuite.h"
+#include <list>
+#include <string>
+#include <vector>
+
+namespace Testee {
+
+/// Time double ended queue operations of Candidate, e.g. Polymorphic::BlockDeque, against Reference, e.g. std::deque,
+/// for each element count. Run it per element size, as block sizes trade off differently for small and large elements.
+template<typename Reference, typename Candidate>
+class DequeBenchSuite : public BenchSuite
+{
+public:
+	typedef typename Reference::value_type T;
+	typedef void (*Operation)(Stopwatch&, std::size_t);
+
+	/// Elements held by the sliding window case.
+	static constexpr std::size_t windowSize = 1000;
+
+	DequeBenchSuite(
+		const std::string& subject,
+		const std::string& reference,
+		const std::string& candidate,
+		const std::vector<std::size_t>& counts) :
+		BenchSuite(subject, reference, candidate, benchCases(counts))
+	{
+	}
+
+	static std::vector<T> values(std::size_t count)
+	{
+		std::vector<T> result;
+		for (std::size_t i = 0; i < count; ++i) {
+			result.push_back(BenchValue<T>::make(i));
+		}
+		return result;
+	}
+
+	/// Push all elements to the back, then pop them from the front, like a queue filled and drained in one go.
+	template<typename Deque>
+	static void fillDrain(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Deque testee;
+		stopwatch.start();
+		for (const auto& value : source) {
+			testee.push_back(value);
+		}
+		while (!testee.empty()) {
+			escape(testee.front());
+			testee.pop_front();
+		}
+		stopwatch.stop();
+	}
+
+	template<typename Deque>
+	static void pushFront(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Deque testee;
+		stopwatch.start();
+		for (const auto& value : source) {
+			testee.push_front(value);
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	template<typename Deque>
+	static void iterate(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Deque testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& value : testee) {
+			escape(value);
+		}
+		stopwatch.stop();
+	}
+
+	/// Read elements by index in a scattered order.
+	template<typename Deque>
+	static void randomAccess(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Deque testee(source.begin(), source.end());
+		stopwatch.start();
+		for (std::size_t i = 0; i < count; ++i) {
+			escape(testee[static_cast<std::uint32_t>(i * 2654435761u) % count]);
+		}
+		stopwatch.stop();
+	}
+
+	/// Push each element to the back and pop one from the front once windowSize elements are held, like a bounded
+	/// message queue. Blocks are emptied and new ones are needed at a steady rate.
+	template<typename Deque>
+	static void slidingWindow(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Deque testee;
+		stopwatch.start();
+		for (const auto& value : source) {
+			testee.push_back(value);
+			if (testee.size() > windowSize) {
+				testee.pop_front();
+			}
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+private:
+	static BenchCase benchCase(const std::string& name, std::size_t count, Operation reference, Operation candidate)
+	{
+		return BenchCase(
+			name,
+			count,
+			[reference, count](Stopwatch& stopwatch) { reference(stopwatch, count); },
+			[candidate, count](Stopwatch& stopwatch) { candidate(stopwatch, count); });
+	}
+
+	static std::list<BenchCase> benchCases(const std::vector<std::size_t>& counts)
+	{
+		std::list<BenchCase> result;
+		for (std::size_t count : counts) {
+			result.push_back(benchCase("fill drain", count, &fillDrain<Reference>, &fillDrain<Candidate>));
+			result.push_back(benchCase("push_front", count, &pushFront<Reference>, &pushFront<Candidate>));
+			result.push_back(benchCase("iterate", count, &iterate<Reference>, &iterate<Candidate>));
+			result.push_back(benchCase("random access", count, &randomAccess<Reference>, &randomAccess<Candidate>));
+			result.push_back(benchCase("sliding window", count, &slidingWindow<Reference>, &slidingWindow<Candidate>));
+		}
+		return result;
+	}
+};
+
+template<typename Reference, typename Candidate>
+constexpr std::size_t DequeBenchSuite<Reference, Candidate>::windowSize;
+
+} // namespace Testee
+
+#endif // Testee_DequeBenchSuite_INCLUDED
@@ -0,0 +1,170 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_ForwardListBenchSuite_INCLUDED
+#define Testee_ForwardListBenchSuite_INCLUDED
+
+#include "Testee/BenchSuite.h"
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace Testee {
+
+/// Time singly linked list mutators of Candidate, e.g. Polymorphic::CountedForwardList, against Reference, e.g.
+/// Polymorphic::ForwardList, for each element count. Measures what maintaining an element count costs, and what it
+/// saves where the element count is needed.
+template<typename Reference, typename Candidate>
+class ForwardListBenchSuite : public BenchSuite
+{
+public:
+	typedef typename Reference::value_type T;
+	typedef void (*Operation)(Stopwatch&, std::size_t);
+
+	ForwardListBenchSuite(
+		const std::string& subject,
+		const std::string& reference,
+		const std::string& candidate,
+		const std::vector<std::size_t>& counts) :
+		BenchSuite(subject, reference, candidate, benchCases(counts))
+	{
+	}
+
+	static std::vector<T> values(std::size_t count)
+	{
+		std::vector<T> result;
+		for (std::size_t i = 0; i < count; ++i) {
+			result.push_back(BenchValue<T>::make(i));
+		}
+		return result;
+	}
+
+	/// Element count of list, by size() where available and by walking the list otherwise.
+	template<typename List>
+	static auto length(const List& list, int) -> decltype(list.size())
+	{
+		return list.size();
+	}
+
+	template<typename List>
+	static std::size_t length(const List& list, long)
+	{
+		return static_cast<std::size_t>(std::distance(list.begin(), list.end()));
+	}
+
+	template<typename List>
+	static void pushFront(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		List testee;
+		stopwatch.start();
+		for (const auto& value : source) {
+			testee.push_front(value);
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	/// Insert each element after the previously inserted one, appending in order.
+	template<typename List>
+	static void insertAfter(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		List testee;
+		stopwatch.start();
+		auto position = testee.before_begin();
+		for (const auto& value : source) {
+			position = testee.insert_after(position, value);
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	/// Erase every second element.
+	template<typename List>
+	static void eraseAfter(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		List testee(source.begin(), source.end());
+		stopwatch.start();
+		for (auto position = testee.begin(); position != testee.end() && std::next(position) != testee.end(); ++position) {
+			testee.erase_after(position);
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	/// Remove every second element by predicate.
+	template<typename List>
+	static void removeIf(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		List testee(source.begin(), source.end());
+		bool odd = false;
+		stopwatch.start();
+		testee.remove_if([&odd](const T&) { return odd = !odd; });
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	/// Collapse consecutive pairs of equal elements.
+	template<typename List>
+	static void unique(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count / 2);
+		List testee;
+		for (const auto& value : source) {
+			testee.push_front(value);
+			testee.push_front(value);
+		}
+		stopwatch.start();
+		testee.unique();
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	/// Query the element count once, like a metrics report on a long list.
+	template<typename List>
+	static void size(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		List testee(source.begin(), source.end());
+		stopwatch.start();
+		std::size_t result = length(testee, 0);
+		stopwatch.stop();
+		escape(result);
+	}
+
+private:
+	static BenchCase benchCase(const std::string& name, std::size_t count, Operation reference, Operation candidate)
+	{
+		return BenchCase(
+			name,
+			count,
+			[reference, count](Stopwatch& stopwatch) { reference(stopwatch, count); },
+			[candidate, count](Stopwatch& stopwatch) { candidate(stopwatch, count); });
+	}
+
+	static std::list<BenchCase> benchCases(const std::vector<std::size_t>& counts)
+	{
+		std::list<BenchCase> result;
+		for (std::size_t count : counts) {
+			result.push_back(benchCase("push_front", count, &pushFront<Reference>, &pushFront<Candidate>));
+			result.push_back(benchCase("insert_after", count, &insertAfter<Reference>, &insertAfter<Candidate>));
+			result.push_back(benchCase("erase_after", count, &eraseAfter<Reference>, &eraseAfter<Candidate>));
+			result.push_back(benchCase("remove_if", count, &removeIf<Reference>, &removeIf<Candidate>));
+			result.push_back(benchCase("unique", count, &unique<Reference>, &unique<Candidate>));
+			result.push_back(benchCase("size", count, &size<Reference>, &size<Candidate>));
+		}
+		return result;
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_ForwardListBenchSuite_INCLUDED
@@ -10,6 +10,9 @@
 
 #include "Testee/TestSuite.h"
 #include <array>
+#include <forward_list>
+#include <iterator>
+#include <stdexcept>
 
 namespace Testee {
 
@@ -730,6 +733,166 @@ template<template<typename...> class ForwardListType, typename T, typename Alloc
 const typename ForwardListTestSuite<ForwardListType, T, Allocator>::ArrayType
 	ForwardListTestSuite<ForwardListType, T, Allocator>::ARRAY = {T()};
 
+/// Test ForwardListType size() maintained by every mutator, for value_type int.
+template<template<typename...> class ForwardListType>
+class CountedForwardListTestSuite : public TestSuite
+{
+public:
+	typedef ForwardListType<int> ListType;
+
+	/// True if testee size() equals the number of its elements.
+	static bool counted(const ListType& testee)
+	{
+		return testee.size() == static_cast<typename ListType::size_type>(std::distance(testee.begin(), testee.end()));
+	}
+
+	CountedForwardListTestSuite(const std::string& forwardListType) :
+		TestSuite(
+			forwardListType + " element count",
+			{
+
+				TestCase(
+					"construct assign",
+					[] {
+						std::array<int, 4> values = {{1, 2, 3, 4}};
+						ListType testee(values.begin(), values.end());
+						TestCase::assert(testee.size() == 4 && counted(testee), "range");
+						ListType copy(testee);
+						TestCase::assert(copy.size() == 4, "copy");
+						ListType moved(std::move(copy));
+						TestCase::assert(moved.size() == 4 && copy.size() == 0 && counted(copy), "move");
+						testee.assign(3, 7);
+						TestCase::assert(testee.size() == 3 && counted(testee), "assign fill");
+						testee.assign(values.begin(), values.begin() + 2);
+						TestCase::assert(testee.size() == 2 && counted(testee), "assign range");
+						testee = {1, 2, 3, 4, 5};
+						TestCase::assert(testee.size() == 5 && counted(testee), "initializer list");
+						testee = moved;
+						TestCase::assert(testee.size() == 4, "copy assignment");
+						testee = std::move(moved);
+						TestCase::assert(testee.size() == 4 && moved.size() == 0 && counted(moved), "move assignment");
+						testee = std::forward_list<int>(6, 1);
+						TestCase::assert(testee.size() == 6 && counted(testee), "delegate assignment");
+					}),
+
+				TestCase(
+					"insert erase",
+					[] {
+						ListType testee;
+						testee.push_front(1);
+						testee.emplace_front(2);
+						testee.emplace_after(testee.begin(), 3);
+						testee.insert_after(testee.before_begin(), 4);
+						TestCase::assert(testee.size() == 4 && counted(testee), "single");
+						testee.insert_after(testee.begin(), 3, 5);
+						std::array<int, 2> values = {{6, 7}};
+						testee.insert_after(testee.begin(), values.begin(), values.end());
+						testee.insert_after(testee.begin(), values.begin(), values.begin());
+						testee.insert_after(testee.before_begin(), {8, 9, 10});
+						TestCase::assert(testee.size() == 12 && counted(testee), "multiple");
+						testee.pop_front();
+						testee.erase_after(testee.begin());
+						TestCase::assert(testee.size() == 10 && counted(testee), "erase single");
+						auto last = testee.begin();
+						std::advance(last, 4);
+						testee.erase_after(testee.begin(), last);
+						testee.erase_after(testee.begin(), std::next(testee.begin()));
+						TestCase::assert(testee.size() == 7 && counted(testee), "erase range");
+						testee.resize(12);
+						TestCase::assert(testee.size() == 12 && counted(testee), "grow");
+						testee.resize(2, 1);
+						TestCase::assert(testee.size() == 2 && counted(testee), "shrink");
+						testee.clear();
+						TestCase::assert(testee.size() == 0 && testee.empty(), "clear");
+					}),
+
+				TestCase(
+					"splice",
+					[] {
+						ListType testee = {1, 2, 3};
+						ListType other = {4, 5, 6, 7, 8};
+						testee.splice_after(testee.begin(), other, other.begin());
+						TestCase::assert(testee.size() == 4 && other.size() == 4, "element");
+						auto last = other.begin();
+						std::advance(last, 3);
+						testee.splice_after(testee.before_begin(), other, other.before_begin(), last);
+						TestCase::assert(testee.size() == 7 && other.size() == 1, "range");
+						TestCase::assert(counted(testee) && counted(other), "range counted");
+						testee.splice_after(testee.before_begin(), testee, testee.begin(), std::next(testee.begin(), 3));
+						TestCase::assert(testee.size() == 7 && counted(testee), "own range");
+						testee.splice_after(testee.begin(), std::move(other));
+						TestCase::assert(testee.size() == 8 && other.size() == 0 && other.empty(), "list");
+					}),
+
+				TestCase(
+					"remove unique merge",
+					[] {
+						ListType testee = {1, 1, 2, 3, 3, 3, 4, 5, 6, 1};
+						testee.remove(1);
+						TestCase::assert(testee.size() == 7 && counted(testee), "remove");
+						testee.unique();
+						TestCase::assert(testee.size() == 5 && counted(testee), "unique");
+						testee.remove_if([](int value) { return value % 2 == 0; });
+						TestCase::assert(testee.size() == 2 && counted(testee), "remove_if");
+						testee.unique([](int lhs, int rhs) { return rhs - lhs == 2; });
+						TestCase::assert(testee.size() == 1 && counted(testee), "unique predicate");
+						ListType other = {0, 2, 4, 6};
+						testee.merge(other);
+						TestCase::assert(testee.size() == 5 && other.size() == 0 && counted(testee), "merge");
+						testee.merge(testee);
+						TestCase::assert(testee.size() == 5, "merge self");
+						testee.reverse();
+						testee.merge(ListType{9, 8, 1}, [](int lhs, int rhs) { return lhs > rhs; });
+						TestCase::assert(testee.size() == 8 && counted(testee), "merge compare");
+						testee.sort();
+						TestCase::assert(testee.size() == 8 && counted(testee) && testee.front() == 0, "sort");
+					}),
+
+				TestCase(
+					"throwing predicate",
+					[] {
+						ListType testee = {1, 2, 3, 4, 5, 6};
+						int calls = 0;
+						try {
+							testee.remove_if([&calls](int value) {
+								if (++calls == 4) {
+									throw std::runtime_error("predicate");
+								}
+								return value % 2 == 1;
+							});
+						} catch (const std::runtime_error&) {
+						}
+						TestCase::assert(counted(testee), "remove_if");
+						ListType other = {0, 7, 8};
+						calls = 0;
+						try {
+							testee.merge(other, [&calls](int lhs, int rhs) {
+								if (++calls == 2) {
+									throw std::runtime_error("compare");
+								}
+								return lhs < rhs;
+							});
+						} catch (const std::runtime_error&) {
+						}
+						TestCase::assert(counted(testee) && counted(other), "merge");
+					}),
+
+				TestCase(
+					"swap compare",
+					[] {
+						ListType lhs = {1, 2, 3};
+						ListType rhs = {1, 2};
+						TestCase::assert(lhs != rhs && rhs < lhs, "compare");
+						swap(lhs, rhs);
+						TestCase::assert(lhs.size() == 2 && rhs.size() == 3, "swap");
+						lhs.push_front(3);
+						TestCase::assert(lhs != rhs, "same size");
+					}),
+			})
+	{
+	}
+};
+
 } // namespace Testee
 
 #endif // Testee_ForwardListTestSuite_INCLUDED
@@ -0,0 +1,141 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_HashTestSuite_INCLUDED
+#define Testee_HashTestSuite_INCLUDED
+
+#include "Polymorphic/Hash.h"
+#include "Polymorphic/UnorderedMap.h"
+#include "Polymorphic/UnorderedSet.h"
+#include "Testee/TestSuite.h"
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace Testee {
+
+/// Test Polymorphic::Hash function objects, and their use by the unordered decorators.
+class HashTestSuite : public TestSuite
+{
+public:
+	enum class Color
+	{
+		red,
+		green
+	};
+
+	/// Number of distinct values of the low bits of hashes of keys.
+	template<typename Key>
+	static std::size_t lowBitsUsed(const std::vector<Key>& keys, std::size_t bits)
+	{
+		std::set<std::size_t> used;
+		for (const auto& key : keys) {
+			used.insert(Polymorphic::Hash<Key>()(key) & ((std::size_t(1) << bits) - 1));
+		}
+		return used.size();
+	}
+
+	HashTestSuite() :
+		TestSuite(
+			"Polymorphic::Hash",
+			{
+
+				TestCase(
+					"integers",
+					[] {
+						Polymorphic::Hash<int> hash;
+						TestCase::assert(hash(42) == hash(42), "deterministic");
+						TestCase::assert(hash(42) != hash(43), "distinct");
+						TestCase::assert(noexcept(hash(42)), "noexcept");
+						std::vector<std::uint64_t> strided;
+						for (std::uint64_t i = 0; i < 4096; ++i) {
+							strided.push_back(i << 12);
+						}
+						TestCase::assert(lowBitsUsed(strided, 12) > 2000, "strided keys spread");
+						TestCase::assert(
+							Polymorphic::Hash<std::uint8_t>()(7) == Polymorphic::Hash<std::uint64_t>()(7), "width independent");
+					}),
+
+				TestCase(
+					"enumerations pointers",
+					[] {
+						TestCase::assert(
+							Polymorphic::Hash<Color>()(Color::green) == Polymorphic::Hash<int>()(static_cast<int>(Color::green)),
+							"enumeration");
+						std::vector<std::uint64_t> elements(1024);
+						std::vector<std::uint64_t*> pointers;
+						for (auto& element : elements) {
+							pointers.push_back(&element);
+						}
+						TestCase::assert(lowBitsUsed(pointers, 10) > 500, "aligned pointers spread");
+					}),
+
+				TestCase(
+					"strings",
+					[] {
+						Polymorphic::Hash<std::string> hash;
+						std::string text(300, 'a');
+						for (std::size_t i = 0; i < text.size(); ++i) {
+							text[i] = static_cast<char>('a' + i % 26);
+						}
+						std::set<std::size_t> prefixes;
+						for (std::size_t size = 0; size <= text.size(); ++size) {
+							prefixes.insert(hash(text.substr(0, size)));
+						}
+						TestCase::assert(prefixes.size() == text.size() + 1, "prefixes distinct");
+						std::set<std::size_t> flipped;
+						for (std::size_t i = 0; i < text.size(); ++i) {
+							std::string changed(text);
+							changed[i] ^= 1;
+							flipped.insert(hash(changed));
+						}
+						flipped.insert(hash(text));
+						TestCase::assert(flipped.size() == text.size() + 1, "single bit changes");
+						TestCase::assert(hash(std::string("polymorphic")) == hash("polymorphic"), "transparent");
+						TestCase::assert(
+							Polymorphic::Hash<std::u16string>()(u"polymorphic") ==
+								Polymorphic::Hash<std::u16string>()(std::u16string(u"polymorphic")),
+							"wide transparent");
+#if defined(__cpp_lib_string_view)
+						TestCase::assert(
+							hash(std::string_view("polymorphic")) == hash(std::string("polymorphic")) &&
+								Polymorphic::Hash<std::string_view>()("polymorphic") == hash("polymorphic"),
+							"string_view");
+#endif
+					}),
+
+				TestCase(
+					"fallback",
+					[] {
+						TestCase::assert(Polymorphic::Hash<double>()(1.5) == std::hash<double>()(1.5), "std::hash");
+					}),
+
+				TestCase(
+					"unordered decorators",
+					[] {
+						Polymorphic::UnorderedMap<std::string, int, Polymorphic::Hash<std::string>> map;
+						Polymorphic::UnorderedSet<std::uint64_t, Polymorphic::Hash<std::uint64_t>> set;
+						for (int i = 0; i < 10000; ++i) {
+							map.emplace(std::to_string(i), i);
+							set.insert(static_cast<std::uint64_t>(i) << 20);
+						}
+						bool found = true;
+						for (int i = 0; i < 10000; ++i) {
+							found = found && map.at(std::to_string(i)) == i && set.count(static_cast<std::uint64_t>(i) << 20) == 1;
+						}
+						TestCase::assert(found && map.size() == 10000 && set.size() == 10000, "elements");
+						TestCase::assert(map.find("10000") == map.end(), "missing");
+					}),
+			})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_HashTestSuite_INCLUDED
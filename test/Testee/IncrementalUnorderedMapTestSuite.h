@@ -0,0 +1,188 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_IncrementalUnorderedMapTestSuite_INCLUDED
+#define Testee_IncrementalUnorderedMapTestSuite_INCLUDED
+
+#include "Polymorphic/IncrementalUnorderedMap.h"
+#include "Testee/TestSuite.h"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Testee {
+
+/// Test Polymorphic::IncrementalUnorderedMap migration between its tables.
+class IncrementalUnorderedMapTestSuite : public TestSuite
+{
+public:
+	typedef Polymorphic::IncrementalUnorderedMap<int, int> TesteeType;
+
+	/// Map holding keys [0, n) mapped to their negation, inserted until migration is in progress.
+	static TesteeType migratingTestee(int n = 1000)
+	{
+		TesteeType testee;
+		for (int i = 0; i < n || !testee.migrating(); ++i) {
+			testee.emplace(i, -i);
+		}
+		return testee;
+	}
+
+	/// Whether testee maps exactly keys [0, n) to their negation.
+	static bool holdsNegations(const TesteeType& testee, int n)
+	{
+		bool found = testee.size() == static_cast<TesteeType::size_type>(n);
+		for (int i = 0; i < n; ++i) {
+			auto position = testee.find(i);
+			found = found && position != testee.end() && position->second == -i && testee.count(i) == 1;
+		}
+		return found;
+	}
+
+	IncrementalUnorderedMapTestSuite() :
+		TestSuite(
+			"Polymorphic::IncrementalUnorderedMap<int, int>",
+			{
+
+				TestCase(
+					"insert find erase",
+					[] {
+						TesteeType testee;
+						bool migrated = false;
+						for (int i = 0; i < 100000; ++i) {
+							TestCase::assert(testee.insert(std::make_pair(i, -i)).second, "inserted");
+							migrated = migrated || testee.migrating();
+						}
+						TestCase::assert(migrated, "migrated");
+						TestCase::assert(holdsNegations(testee, 100000), "found");
+						TestCase::assert(!testee.insert(std::make_pair(7, 7)).second && testee.at(7) == -7, "duplicate");
+						TestCase::assert(testee.find(100000) == testee.end() && testee.count(100000) == 0, "missing");
+						for (int i = 0; i < 100000; i += 2) {
+							TestCase::assert(testee.erase(i) == 1, "erased");
+						}
+						TestCase::assert(testee.size() == 50000 && testee.erase(0) == 0, "erase");
+					}),
+
+				TestCase(
+					"bounded migration",
+					[] {
+						TesteeType testee;
+						auto buckets = testee.bucket_count();
+						int growths = 0;
+						for (int i = 0; i < 100000; ++i) {
+							bool wasMigrating = testee.migrating();
+							testee.emplace(i, -i);
+							if (testee.bucket_count() != buckets) {
+								TestCase::assert(i == 0 || (!wasMigrating && testee.migrating()), "grows by setting table aside");
+								buckets = testee.bucket_count();
+								++growths;
+							}
+						}
+						TestCase::assert(growths > 10, "grown");
+						TestCase::assert(holdsNegations(testee, 100000), "found");
+					}),
+
+				TestCase(
+					"keys in draining table",
+					[] {
+						TesteeType testee = migratingTestee();
+						TestCase::assert(!testee.emplace(0, 1).second && testee[0] == 0, "emplace");
+						TestCase::assert(!testee.insert(std::make_pair(1, 1)).second && testee.at(1) == -1, "insert");
+						testee[2] = 42;
+						TestCase::assert(testee.at(2) == 42, "subscript");
+						const TesteeType& constTestee = testee;
+						TestCase::assert(constTestee.at(3) == -3 && constTestee.find(3)->second == -3, "const");
+						auto range = testee.equal_range(4);
+						TestCase::assert(range.first != range.second && std::next(range.first) == range.second, "equal_range");
+						try {
+							testee.at(-1);
+							TestCase::assert(false, "at throws");
+						} catch (std::out_of_range&) {
+						}
+					}),
+
+				TestCase(
+					"iteration",
+					[] {
+						TesteeType testee = migratingTestee();
+						int n = static_cast<int>(testee.size());
+						std::vector<bool> seen(n, false);
+						const TesteeType& constTestee = testee;
+						for (const auto& element : constTestee) {
+							TestCase::assert(!seen[element.first], "once");
+							seen[element.first] = true;
+						}
+						TestCase::assert(std::find(seen.begin(), seen.end(), false) == seen.end(), "all");
+						for (auto position = testee.begin(); position != testee.end();) {
+							position = position->first % 2 ? testee.erase(position) : std::next(position);
+						}
+						TestCase::assert(testee.size() == static_cast<TesteeType::size_type>((n + 1) / 2), "erase odd");
+						testee.erase(testee.cbegin(), testee.cend());
+						TestCase::assert(testee.empty() && testee.begin() == testee.end(), "erase all");
+					}),
+
+				TestCase(
+					"complete migration",
+					[] {
+						TesteeType testee = migratingTestee();
+						int n = static_cast<int>(testee.size());
+						testee.reserve(testee.size() + 1);
+						TestCase::assert(!testee.migrating() && holdsNegations(testee, n), "reserve");
+						testee = migratingTestee();
+						n = static_cast<int>(testee.size());
+						testee.max_load_factor(2.0f);
+						TestCase::assert(!testee.migrating() && testee.max_load_factor() == 2.0f, "max_load_factor");
+						testee.shrink_to_fit();
+						TestCase::assert(testee.load_factor() <= 2.0f && holdsNegations(testee, n), "shrink_to_fit");
+					}),
+
+				TestCase(
+					"copy move swap",
+					[] {
+						TesteeType testee = migratingTestee();
+						int n = static_cast<int>(testee.size());
+						TesteeType copy(testee);
+						TestCase::assert(copy == testee && holdsNegations(copy, n), "copy");
+						TesteeType settled(copy);
+						settled.rehash(0);
+						TestCase::assert(settled == testee && !settled.migrating(), "equal across tables");
+						settled[0] = 1;
+						TestCase::assert(settled != testee, "unequal");
+						TesteeType moved(std::move(copy));
+						TestCase::assert(holdsNegations(moved, n), "move");
+						TesteeType other{{1, 1}};
+						swap(moved, other);
+						TestCase::assert(holdsNegations(other, n) && moved.size() == 1, "swap");
+						Polymorphic::IncrementalUnorderedMap<int, int>::DelegateType plain{{1, 2}};
+						other = plain;
+						TestCase::assert(other.size() == 1 && other.at(1) == 2 && !other.migrating(), "std::unordered_map");
+					}),
+
+				TestCase(
+					"string keys",
+					[] {
+						Polymorphic::IncrementalUnorderedMap<std::string, std::string> testee;
+						for (int i = 0; i < 10000; ++i) {
+							testee.emplace(std::to_string(i), std::string(40, 'x') + std::to_string(i));
+						}
+						bool found = testee.size() == 10000;
+						for (int i = 0; i < 10000; ++i) {
+							found = found && testee.at(std::to_string(i)) == std::string(40, 'x') + std::to_string(i);
+						}
+						TestCase::assert(found, "found");
+					}),
+			})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_IncrementalUnorderedMapTestSuite_INCLUDED
@@ -0,0 +1,37 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_Json_INCLUDED
+#define Testee_Json_INCLUDED
+
+#include <cstdio>
+#include <string>
+
+namespace Testee {
+
+/// JSON string literal of text, escaping quotes, backslashes and control characters.
+inline std::string jsonString(const std::string& text)
+{
+	std::string result("\"");
+	for (char c : text) {
+		if (c == '"' || c == '\\') {
+			result += '\\';
+			result += c;
+		} else if (static_cast<unsigned char>(c) < 0x20) {
+			char escaped[8];
+			std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+			result += escaped;
+		} else {
+			result += c;
+		}
+	}
+	return result + '"';
+}
+
+} // namespace Testee
+
+#endif // Testee_Json_INCLUDED
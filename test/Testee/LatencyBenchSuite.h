@@ -0,0 +1,209 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_LatencyBenchSuite_INCLUDED
+#define Testee_LatencyBenchSuite_INCLUDED
+
+#include "BenchCase.h"
+#include "Json.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Testee {
+
+/// Counterpart of BenchSuite reporting the distribution of single operation latencies instead of the mean time per
+/// element. Runners time each operation by its own start() and stop() pair on a Stopwatch recording laps. Tail
+/// latencies are what incremental algorithms trade throughput for, so there is no tolerance, results are reported only.
+class LatencyBenchSuite
+{
+public:
+	/// Options of run(const Options& options).
+	struct Options
+	{
+		/// File appending one JSON line per suite run, holding the percentiles of all cases, none if empty.
+		std::string json;
+
+		Options() : json()
+		{
+		}
+
+		/// Options set by environment variable TESTEE_BENCH_JSON, shared with BenchSuite.
+		static Options fromEnvironment()
+		{
+			Options options;
+			if (const char* json = std::getenv("TESTEE_BENCH_JSON")) {
+				options.json = json;
+			}
+			return options;
+		}
+	};
+
+	/// Percentiles of laps, in nanoseconds.
+	struct Percentiles
+	{
+		Percentiles() : p50(0), p99(0), p999(0), maximum(0), total(0)
+		{
+		}
+
+		/// Nearest rank percentiles of laps given in seconds.
+		static Percentiles of(std::vector<double> laps)
+		{
+			Percentiles result;
+			if (laps.empty()) {
+				return result;
+			}
+			std::sort(laps.begin(), laps.end());
+			// Rank in integer per mille, as 99.9 percent of a lap count is not exact in floating point.
+			auto rank = [&laps](std::size_t perMille) {
+				std::size_t index = (laps.size() * perMille + 999) / 1000;
+				return 1e9 * laps[std::max<std::size_t>(index, 1) - 1];
+			};
+			result.p50 = rank(500);
+			result.p99 = rank(990);
+			result.p999 = rank(999);
+			result.maximum = 1e9 * laps.back();
+			for (double lap : laps) {
+				result.total += 1e9 * lap;
+			}
+			return result;
+		}
+
+		double p50;
+		double p99;
+		double p999;
+		double maximum;
+		double total;
+	};
+
+	/// Percentiles of a bench case.
+	struct Result
+	{
+		Percentiles reference;
+		Percentiles candidate;
+	};
+
+	LatencyBenchSuite(
+		const std::string& subject, const std::string& reference, const std::string& candidate, std::list<BenchCase>&& benchCases) :
+		subject(subject),
+		reference(reference),
+		candidate(candidate),
+		benchCases(std::move(benchCases))
+	{
+	}
+
+	virtual ~LatencyBenchSuite()
+	{
+	}
+
+	/// Run bench cases with options from the environment, see Options::fromEnvironment().
+	virtual bool run()
+	{
+		return run(Options::fromEnvironment());
+	}
+
+	/// Run each runner of each bench case once, printing latency percentiles per runner. Returns true.
+	bool run(const Options& options)
+	{
+		std::cout << "Benchmarking " << subject << ", " << candidate << " vs " << reference
+				  << ", ns per operation ..." << std::endl;
+		char line[256];
+		const char* header = "%-24s %10s %-10s %10s %10s %10s %14s %12s";
+		std::snprintf(line, sizeof(line), header, "case", "count", "runner", "p50", "p99", "p99.9", "max", "total ms");
+		std::cout << line << std::endl;
+		std::vector<Result> results;
+		for (const auto& benchCase : benchCases) {
+			Result result;
+			result.reference = measure(benchCase, false);
+			result.candidate = measure(benchCase, true);
+			results.push_back(result);
+			print(benchCase.getName(), benchCase.getCount(), "reference", result.reference);
+			print("", benchCase.getCount(), "candidate", result.candidate);
+		}
+		std::cout << "... cases: " << results.size() << std::endl;
+		if (!options.json.empty()) {
+			writeJson(options.json, results);
+		}
+		return true;
+	}
+
+protected:
+	std::string subject;
+	std::string reference;
+	std::string candidate;
+	std::list<BenchCase> benchCases;
+
+private:
+	static Percentiles measure(const BenchCase& benchCase, bool isCandidate)
+	{
+		Stopwatch stopwatch;
+		stopwatch.recordLaps(benchCase.getCount());
+		if (isCandidate) {
+			benchCase.runCandidate(stopwatch);
+		} else {
+			benchCase.runReference(stopwatch);
+		}
+		return Percentiles::of(stopwatch.getLaps());
+	}
+
+	static void print(const std::string& name, std::size_t count, const char* runner, const Percentiles& percentiles)
+	{
+		char line[256];
+		std::snprintf(
+			line,
+			sizeof(line),
+			"%-24s %10zu %-10s %10.0f %10.0f %10.0f %14.0f %12.1f",
+			name.c_str(),
+			count,
+			runner,
+			percentiles.p50,
+			percentiles.p99,
+			percentiles.p999,
+			percentiles.maximum,
+			percentiles.total / 1e6);
+		std::cout << line << std::endl;
+	}
+
+	static void writePercentiles(std::ostream& line, const Percentiles& percentiles)
+	{
+		line << "{\"p50\":" << percentiles.p50 << ",\"p99\":" << percentiles.p99 << ",\"p999\":" << percentiles.p999
+			 << ",\"maximum\":" << percentiles.maximum << ",\"total\":" << percentiles.total << "}";
+	}
+
+	void writeJson(const std::string& path, const std::vector<Result>& results) const
+	{
+		std::ostringstream line;
+		line.precision(9);
+		line << "{\"suite\":" << jsonString(subject) << ",\"reference\":" << jsonString(reference)
+			 << ",\"candidate\":" << jsonString(candidate) << ",\"cases\":[";
+		auto benchCase = benchCases.begin();
+		for (std::size_t i = 0; i < results.size(); ++i, ++benchCase) {
+			line << (i == 0 ? "" : ",") << "{\"name\":" << jsonString(benchCase->getName())
+				 << ",\"count\":" << benchCase->getCount() << ",\"reference\":";
+			writePercentiles(line, results[i].reference);
+			line << ",\"candidate\":";
+			writePercentiles(line, results[i].candidate);
+			line << "}";
+		}
+		line << "]}\n";
+		std::ofstream file(path, std::ios::app);
+		file << line.str();
+		if (!file) {
+			std::cerr << "Cannot append benchmark results to " << path << std::endl;
+		}
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_LatencyBenchSuite_INCLUDED
@@ -0,0 +1,150 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_ListBenchSuite_INCLUDED
+#define Testee_ListBenchSuite_INCLUDED
+
+#include "Testee/BenchSuite.h"
+#include <list>
+#include <string>
+#include <vector>
+
+namespace Testee {
+
+/// Time doubly linked list operations of CandidateType, e.g. Polymorphic::List, against ReferenceType, e.g. std::list,
+/// for each element count.
+template<template<typename...> class ReferenceType, template<typename...> class CandidateType, typename T>
+class ListBenchSuite : public BenchSuite
+{
+public:
+	typedef ReferenceType<T> Reference;
+	typedef CandidateType<T> Candidate;
+	typedef void (*Operation)(Stopwatch&, std::size_t);
+
+	ListBenchSuite(
+		const std::string& subject,
+		const std::string& reference,
+		const std::string& candidate,
+		const std::vector<std::size_t>& counts) :
+		BenchSuite(subject, reference, candidate, benchCases(counts))
+	{
+	}
+
+	static std::vector<T> values(std::size_t count)
+	{
+		std::vector<T> result;
+		for (std::size_t i = 0; i < count; ++i) {
+			result.push_back(BenchValue<T>::make(i));
+		}
+		return result;
+	}
+
+	template<typename List>
+	static void pushBack(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		List testee;
+		stopwatch.start();
+		for (const auto& value : source) {
+			testee.push_back(value);
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	template<typename List>
+	static void pushFront(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		List testee;
+		stopwatch.start();
+		for (const auto& value : source) {
+			testee.push_front(value);
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	template<typename List>
+	static void iterate(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		List testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& value : testee) {
+			escape(value);
+		}
+		stopwatch.stop();
+	}
+
+	template<typename List>
+	static void copy(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		const List testee(source.begin(), source.end());
+		stopwatch.start();
+		List copied(testee);
+		stopwatch.stop();
+		escape(copied);
+	}
+
+	/// Erase every second element.
+	template<typename List>
+	static void erase(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		List testee(source.begin(), source.end());
+		stopwatch.start();
+		for (auto position = testee.begin(); position != testee.end();) {
+			position = testee.erase(position);
+			if (position != testee.end()) {
+				++position;
+			}
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	template<typename List>
+	static void sort(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		List testee(source.begin(), source.end());
+		stopwatch.start();
+		testee.sort();
+		stopwatch.stop();
+		escape(testee);
+	}
+
+private:
+	static BenchCase benchCase(const std::string& name, std::size_t count, Operation reference, Operation candidate)
+	{
+		return BenchCase(
+			name,
+			count,
+			[reference, count](Stopwatch& stopwatch) { reference(stopwatch, count); },
+			[candidate, count](Stopwatch& stopwatch) { candidate(stopwatch, count); });
+	}
+
+	static std::list<BenchCase> benchCases(const std::vector<std::size_t>& counts)
+	{
+		std::list<BenchCase> result;
+		for (std::size_t count : counts) {
+			result.push_back(benchCase("push_back", count, &pushBack<Reference>, &pushBack<Candidate>));
+			result.push_back(benchCase("push_front", count, &pushFront<Reference>, &pushFront<Candidate>));
+			result.push_back(benchCase("iterate", count, &iterate<Reference>, &iterate<Candidate>));
+			result.push_back(benchCase("copy", count, &copy<Reference>, &copy<Candidate>));
+			result.push_back(benchCase("erase", count, &erase<Reference>, &erase<Candidate>));
+			result.push_back(benchCase("sort", count, &sort<Reference>, &sort<Candidate>));
+		}
+		return result;
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_ListBenchSuite_INCLUDED
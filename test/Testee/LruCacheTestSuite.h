@@ -0,0 +1,267 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_LruCacheTestSuite_INCLUDED
+#define Testee_LruCacheTestSuite_INCLUDED
+
+#include "Testee/TestSuite.h"
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace Testee {
+
+/// Test LruCacheType recency, eviction and statistics.
+template<template<typename...> class LruCacheType, typename Key, typename T>
+class LruCacheTestSuite : public TestSuite
+{
+public:
+	/// Cache recording evictions and weighing entries by their mapped value.
+	class WeighingCache : public LruCacheType<Key, T>
+	{
+	public:
+		typedef LruCacheType<Key, T> BaseType;
+
+		explicit WeighingCache(typename BaseType::size_type capacity) : BaseType(capacity)
+		{
+		}
+
+		std::vector<Key> evictedKeys;
+
+	protected:
+		typename BaseType::size_type weigh(const typename BaseType::value_type& value) const override
+		{
+			return static_cast<typename BaseType::size_type>(value.second);
+		}
+
+		void evicted(typename BaseType::value_type& value) override
+		{
+			evictedKeys.push_back(value.first);
+		}
+	};
+
+	LruCacheTestSuite(const std::string& lruCacheType) :
+		TestSuite(
+			lruCacheType + " recency, eviction and statistics",
+			{
+
+				TestCase(
+					"ctor",
+					[] {
+						const LruCacheType<Key, T> testee(3);
+						TestCase::assert(testee.empty(), "empty");
+						TestCase::assert(testee.capacity() == 3, "capacity");
+					}),
+
+				TestCase(
+					"insert",
+					[] {
+						LruCacheType<Key, T> testee(3);
+						auto result = testee.insert(std::make_pair(Key(1), T(1)));
+						TestCase::assert(result.second, "inserted");
+						TestCase::assert(result.first->first == Key(1), "result");
+						result = testee.insert(std::make_pair(Key(1), T(2)));
+						TestCase::assert(!result.second, "not inserted");
+						TestCase::assert(result.first->second == T(1), "unchanged");
+						TestCase::assert(testee.size() == 1, "size");
+					}),
+
+				TestCase(
+					"insert_or_assign",
+					[] {
+						LruCacheType<Key, T> testee(3);
+						testee.insert_or_assign(Key(1), T(1));
+						auto result = testee.insert_or_assign(Key(1), T(2));
+						TestCase::assert(!result.second, "inserted");
+						TestCase::assert(result.first->second == T(2), "assigned");
+					}),
+
+				TestCase(
+					"evict least recently used",
+					[] {
+						LruCacheType<Key, T> testee(2);
+						testee.insert_or_assign(Key(1), T(1));
+						testee.insert_or_assign(Key(2), T(2));
+						testee.find(Key(1));
+						testee.insert_or_assign(Key(3), T(3));
+						TestCase::assert(testee.size() == 2, "size");
+						TestCase::assert(testee.contains(Key(1)), "1");
+						TestCase::assert(!testee.contains(Key(2)), "2");
+						TestCase::assert(testee.contains(Key(3)), "3");
+						TestCase::assert(testee.begin()->first == Key(3), "most recent");
+					}),
+
+				TestCase(
+					"peek keeps recency",
+					[] {
+						LruCacheType<Key, T> testee(2);
+						testee.insert_or_assign(Key(1), T(1));
+						testee.insert_or_assign(Key(2), T(2));
+						TestCase::assert(testee.peek(Key(1))->second == T(1), "found");
+						TestCase::assert(testee.peek(Key(4)) == testee.end(), "not found");
+						testee.insert_or_assign(Key(3), T(3));
+						TestCase::assert(!testee.contains(Key(1)), "evicted");
+						TestCase::assert(testee.statistics().hits == 0, "statistics");
+					}),
+
+				TestCase(
+					"statistics",
+					[] {
+						LruCacheType<Key, T> testee(1);
+						testee.insert_or_assign(Key(1), T(1));
+						testee.find(Key(1));
+						testee.find(Key(2));
+						testee.insert_or_assign(Key(2), T(2));
+						TestCase::assert(testee.statistics().hits == 1, "hits");
+						TestCase::assert(testee.statistics().misses == 1, "misses");
+						TestCase::assert(testee.statistics().evictions == 1, "evictions");
+						testee.reset_statistics();
+						TestCase::assert(testee.statistics().hits == 0, "reset");
+					}),
+
+				TestCase(
+					"erase",
+					[] {
+						LruCacheType<Key, T> testee(3);
+						testee.insert_or_assign(Key(1), T(1));
+						testee.insert_or_assign(Key(2), T(2));
+						TestCase::assert(testee.erase(Key(1)) == 1, "key");
+						TestCase::assert(testee.erase(Key(1)) == 0, "missing key");
+						testee.erase(testee.begin());
+						TestCase::assert(testee.empty(), "position");
+						TestCase::assert(testee.statistics().evictions == 0, "evictions");
+					}),
+
+				TestCase(
+					"set_capacity",
+					[] {
+						LruCacheType<Key, T> testee(3);
+						testee.insert_or_assign(Key(1), T(1));
+						testee.insert_or_assign(Key(2), T(2));
+						testee.insert_or_assign(Key(3), T(3));
+						testee.set_capacity(1);
+						TestCase::assert(testee.size() == 1, "size");
+						TestCase::assert(testee.contains(Key(3)), "kept");
+					}),
+
+				TestCase(
+					"weigh and evicted",
+					[] {
+						WeighingCache testee(10);
+						testee.insert_or_assign(Key(1), T(4));
+						testee.insert_or_assign(Key(2), T(4));
+						TestCase::assert(testee.weight() == 8, "weight");
+						testee.insert_or_assign(Key(3), T(4));
+						TestCase::assert(testee.weight() == 8, "evicted weight");
+						TestCase::assert(testee.evictedKeys.size() == 1 && testee.evictedKeys[0] == Key(1), "evicted");
+						testee.insert_or_assign(Key(2), T(9));
+						TestCase::assert(testee.size() == 1, "assigned");
+						TestCase::assert(testee.weight() == 9, "assigned weight");
+					}),
+
+				TestCase(
+					"copy move",
+					[] {
+						LruCacheType<Key, T> testee(3);
+						testee.insert_or_assign(Key(1), T(1));
+						testee.insert_or_assign(Key(2), T(2));
+						testee.find(Key(3));
+						LruCacheType<Key, T> copy(testee);
+						TestCase::assert(copy.erase(Key(1)) == 1 && copy.size() == 1, "erase copy");
+						TestCase::assert(testee.size() == 2 && std::distance(testee.begin(), testee.end()) == 2, "original");
+						TestCase::assert(testee.peek(Key(1))->second == T(1), "original entry");
+						copy.insert_or_assign(Key(4), T(4));
+						copy.insert_or_assign(Key(5), T(5));
+						copy.insert_or_assign(Key(6), T(6));
+						TestCase::assert(copy.size() == 3 && !copy.contains(Key(2)), "copy evicts");
+						TestCase::assert(copy.statistics().misses == 1, "copy statistics");
+						copy = testee;
+						testee.clear();
+						TestCase::assert(copy.size() == 2 && copy.begin()->first == Key(2), "copy assigned");
+						copy.find(Key(1));
+						TestCase::assert(copy.begin()->first == Key(1) && copy.weight() == 2, "copy assigned recency");
+						LruCacheType<Key, T> moved(std::move(copy));
+						TestCase::assert(copy.empty() && copy.weight() == 0, "moved from");
+						TestCase::assert(moved.erase(Key(2)) == 1 && moved.begin()->first == Key(1), "moved");
+						copy = std::move(moved);
+						TestCase::assert(moved.empty() && copy.size() == 1 && copy.capacity() == 3, "move assigned");
+						copy.insert_or_assign(Key(7), T(7));
+						copy.insert_or_assign(Key(8), T(8));
+						copy.insert_or_assign(Key(9), T(9));
+						TestCase::assert(copy.size() == 3 && !copy.contains(Key(1)), "move assigned evicts");
+					}),
+
+				TestCase("oversized entry kept", [] {
+					WeighingCache testee(10);
+					testee.insert_or_assign(Key(1), T(20));
+					TestCase::assert(testee.size() == 1, "size");
+					TestCase::assert(testee.evictedKeys.empty(), "evicted");
+				})})
+	{
+	}
+};
+
+/// Test ShardedLruCacheType concurrent access.
+template<template<typename...> class ShardedLruCacheType, typename Key, typename T>
+class ShardedLruCacheTestSuite : public TestSuite
+{
+public:
+	ShardedLruCacheTestSuite(const std::string& shardedLruCacheType) :
+		TestSuite(
+			shardedLruCacheType + " concurrent access",
+			{
+
+				TestCase(
+					"get put",
+					[] {
+						ShardedLruCacheType<Key, T> testee(16, 4);
+						T result = T();
+						TestCase::assert(testee.shard_count() == 4, "shard_count");
+						TestCase::assert(!testee.get(Key(1), result), "miss");
+						testee.put(Key(1), T(2));
+						TestCase::assert(testee.get(Key(1), result) && result == T(2), "hit");
+						TestCase::assert(testee.statistics().hits == 1, "hits");
+						TestCase::assert(testee.statistics().misses == 1, "misses");
+					}),
+
+				TestCase(
+					"erase clear",
+					[] {
+						ShardedLruCacheType<Key, T> testee(16, 4);
+						testee.put(Key(1), T(1));
+						testee.put(Key(2), T(2));
+						TestCase::assert(testee.erase(Key(1)) == 1, "erase");
+						TestCase::assert(testee.size() == 1, "size");
+						testee.clear();
+						TestCase::assert(testee.size() == 0, "clear");
+					}),
+
+				TestCase("concurrent put get", [] {
+					ShardedLruCacheType<Key, T> testee(64, 8);
+					std::vector<std::thread> threads;
+					for (int t = 0; t < 4; ++t) {
+						threads.emplace_back([&testee, t] {
+							for (int i = 0; i < 1000; ++i) {
+								T result;
+								testee.put(Key(t * 1000 + i), T(i));
+								testee.get(Key(t * 1000 + i / 2), result);
+							}
+						});
+					}
+					for (auto& thread : threads) {
+						thread.join();
+					}
+					TestCase::assert(testee.size() <= 64, "capacity");
+					TestCase::assert(testee.statistics().hits + testee.statistics().misses == 4000, "statistics");
+				})})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_LruCacheTestSuite_INCLUDED
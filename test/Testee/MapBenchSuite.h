@@ -0,0 +1,176 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_MapBenchSuite_INCLUDED
+#define Testee_MapBenchSuite_INCLUDED
+
+#include "Testee/BenchSuite.h"
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Testee {
+
+/// Time unique key map operations of CandidateType, e.g. Polymorphic::UnorderedMap, against ReferenceType, e.g.
+/// std::unordered_map, for each element count. Ordered and unordered maps share these operations.
+template<template<typename...> class ReferenceType, template<typename...> class CandidateType, typename Key, typename T>
+class MapBenchSuite : public BenchSuite
+{
+public:
+	typedef ReferenceType<Key, T> Reference;
+	typedef CandidateType<Key, T> Candidate;
+	typedef void (*Operation)(Stopwatch&, std::size_t);
+
+	MapBenchSuite(
+		const std::string& subject,
+		const std::string& reference,
+		const std::string& candidate,
+		const std::vector<std::size_t>& counts) :
+		BenchSuite(subject, reference, candidate, benchCases(counts))
+	{
+	}
+
+	/// Elements with keys scattered by BenchValue<Key>, starting at element first.
+	static std::vector<std::pair<Key, T>> elements(std::size_t count, std::size_t first = 0)
+	{
+		std::vector<std::pair<Key, T>> result;
+		for (std::size_t i = first; i < first + count; ++i) {
+			result.emplace_back(BenchValue<Key>::make(i), BenchValue<T>::make(i));
+		}
+		return result;
+	}
+
+	template<typename Map>
+	static void insert(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<std::pair<Key, T>> source = elements(count);
+		Map testee;
+		stopwatch.start();
+		for (const auto& element : source) {
+			testee.insert(element);
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	template<typename Map>
+	static void emplace(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<std::pair<Key, T>> source = elements(count);
+		Map testee;
+		stopwatch.start();
+		for (auto& element : source) {
+			testee.emplace(std::move(element.first), std::move(element.second));
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	template<typename Map>
+	static void findHit(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<std::pair<Key, T>> source = elements(count);
+		Map testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& element : source) {
+			escape(testee.find(element.first));
+		}
+		stopwatch.stop();
+	}
+
+	template<typename Map>
+	static void findMiss(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<std::pair<Key, T>> source = elements(count);
+		std::vector<std::pair<Key, T>> missing = elements(count, count);
+		Map testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& element : missing) {
+			escape(testee.find(element.first));
+		}
+		stopwatch.stop();
+	}
+
+	template<typename Map>
+	static void subscript(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<std::pair<Key, T>> source = elements(count);
+		Map testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& element : source) {
+			escape(testee[element.first]);
+		}
+		stopwatch.stop();
+	}
+
+	template<typename Map>
+	static void iterate(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<std::pair<Key, T>> source = elements(count);
+		Map testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& element : testee) {
+			escape(element);
+		}
+		stopwatch.stop();
+	}
+
+	template<typename Map>
+	static void copy(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<std::pair<Key, T>> source = elements(count);
+		const Map testee(source.begin(), source.end());
+		stopwatch.start();
+		Map copied(testee);
+		stopwatch.stop();
+		escape(copied);
+	}
+
+	template<typename Map>
+	static void erase(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<std::pair<Key, T>> source = elements(count);
+		Map testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& element : source) {
+			testee.erase(element.first);
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+private:
+	static BenchCase benchCase(const std::string& name, std::size_t count, Operation reference, Operation candidate)
+	{
+		return BenchCase(
+			name,
+			count,
+			[reference, count](Stopwatch& stopwatch) { reference(stopwatch, count); },
+			[candidate, count](Stopwatch& stopwatch) { candidate(stopwatch, count); });
+	}
+
+	static std::list<BenchCase> benchCases(const std::vector<std::size_t>& counts)
+	{
+		std::list<BenchCase> result;
+		for (std::size_t count : counts) {
+			result.push_back(benchCase("insert", count, &insert<Reference>, &insert<Candidate>));
+			result.push_back(benchCase("emplace", count, &emplace<Reference>, &emplace<Candidate>));
+			result.push_back(benchCase("find hit", count, &findHit<Reference>, &findHit<Candidate>));
+			result.push_back(benchCase("find miss", count, &findMiss<Reference>, &findMiss<Candidate>));
+			result.push_back(benchCase("operator[]", count, &subscript<Reference>, &subscript<Candidate>));
+			result.push_back(benchCase("iterate", count, &iterate<Reference>, &iterate<Candidate>));
+			result.push_back(benchCase("copy", count, &copy<Reference>, &copy<Candidate>));
+			result.push_back(benchCase("erase", count, &erase<Reference>, &erase<Candidate>));
+		}
+		return result;
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_MapBenchSuite_INCLUDED
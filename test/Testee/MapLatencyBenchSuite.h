@@ -0,0 +1,91 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_MapLatencyBenchSuite_INCLUDED
+#define Testee_MapLatencyBenchSuite_INCLUDED
+
+#include "Testee/LatencyBenchSuite.h"
+#include <list>
+#include <string>
+#include <vector>
+
+namespace Testee {
+
+/// Time single operations of unique key map CandidateType, e.g. Polymorphic::IncrementalUnorderedMap, against
+/// ReferenceType, e.g. Polymorphic::UnorderedMap, for each element count, reporting their latency distributions.
+template<template<typename...> class ReferenceType, template<typename...> class CandidateType, typename Key, typename T>
+class MapLatencyBenchSuite : public LatencyBenchSuite
+{
+public:
+	typedef ReferenceType<Key, T> Reference;
+	typedef CandidateType<Key, T> Candidate;
+	typedef void (*Operation)(Stopwatch&, std::size_t);
+
+	MapLatencyBenchSuite(
+		const std::string& subject,
+		const std::string& reference,
+		const std::string& candidate,
+		const std::vector<std::size_t>& counts) :
+		LatencyBenchSuite(subject, reference, candidate, benchCases(counts))
+	{
+	}
+
+	/// Time each emplace into an initially empty map, including those growing the table.
+	template<typename Map>
+	static void emplace(Stopwatch& stopwatch, std::size_t count)
+	{
+		Map testee;
+		for (std::size_t i = 0; i < count; ++i) {
+			Key key = BenchValue<Key>::make(i);
+			T value = BenchValue<T>::make(i);
+			stopwatch.start();
+			testee.emplace(std::move(key), std::move(value));
+			stopwatch.stop();
+		}
+		escape(testee);
+	}
+
+	/// Time each find of a present key, after inserting all keys one by one.
+	template<typename Map>
+	static void findHit(Stopwatch& stopwatch, std::size_t count)
+	{
+		Map testee;
+		for (std::size_t i = 0; i < count; ++i) {
+			testee.emplace(BenchValue<Key>::make(i), BenchValue<T>::make(i));
+		}
+		for (std::size_t i = 0; i < count; ++i) {
+			Key key = BenchValue<Key>::make(i);
+			stopwatch.start();
+			escape(testee.find(key));
+			stopwatch.stop();
+		}
+	}
+
+private:
+	static BenchCase benchCase(const std::string& name, std::size_t count, Operation reference, Operation candidate)
+	{
+		return BenchCase(
+			name,
+			count,
+			[reference, count](Stopwatch& stopwatch) { reference(stopwatch, count); },
+			[candidate, count](Stopwatch& stopwatch) { candidate(stopwatch, count); });
+	}
+
+	static std::list<BenchCase> benchCases(const std::vector<std::size_t>& counts)
+	{
+		std::list<BenchCase> result;
+		for (std::size_t count : counts) {
+			result.push_back(benchCase("emplace", count, &emplace<Reference>, &emplace<Candidate>));
+			result.push_back(benchCase("find hit", count, &findHit<Reference>, &findHit<Candidate>));
+		}
+		return result;
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_MapLatencyBenchSuite_INCLUDED
@@ -0,0 +1,231 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_MappedMapTestSuite_INCLUDED
+#define Testee_MappedMapTestSuite_INCLUDED
+
+#include "Polymorphic/Map.h"
+#include "Polymorphic/Multimap.h"
+#include "Polymorphic/Multiset.h"
+#include "Polymorphic/Set.h"
+#include "Testee/TestSuite.h"
+#include <cstddef>
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Testee {
+
+/// Image of a sorted run built by ViewType from [first, last), copied into storage aligned like a mapped file.
+template<typename ViewType>
+class SortedRunImage
+{
+public:
+	template<typename InputIterator>
+	SortedRunImage(InputIterator first, InputIterator last)
+	{
+		std::stringstream stream;
+		ViewType::build(stream, first, last);
+		std::string image = stream.str();
+		bytes = image.size();
+		storage.resize(bytes / sizeof(std::max_align_t) + 1);
+		image.copy(reinterpret_cast<char*>(storage.data()), bytes);
+	}
+
+	ViewType view() const
+	{
+		return ViewType(storage.data(), bytes);
+	}
+
+	std::vector<std::max_align_t> storage;
+	std::size_t bytes;
+};
+
+/// Test MappedMapType image building, lookup and ordered iteration.
+template<template<typename...> class MappedMapType, typename Key, typename T>
+class MappedMapTestSuite : public TestSuite
+{
+public:
+	typedef MappedMapType<Key, T> TesteeType;
+	typedef SortedRunImage<TesteeType> ImageType;
+
+	/// Map of n entries mapping even keys 2 * i to i.
+	static Polymorphic::Map<Key, T> make(int n)
+	{
+		Polymorphic::Map<Key, T> result;
+		for (int i = n - 1; i >= 0; --i) {
+			result.emplace(Key(2 * i), T(i));
+		}
+		return result;
+	}
+
+	MappedMapTestSuite(const std::string& mappedMapType) :
+		TestSuite(
+			mappedMapType + " image building, lookup and ordered iteration",
+			{
+
+				TestCase(
+					"empty",
+					[] {
+						Polymorphic::Map<Key, T> source;
+						ImageType image(source.begin(), source.end());
+						const TesteeType testee = image.view();
+						TestCase::assert(testee.empty(), "empty");
+						TestCase::assert(testee.begin() == testee.end(), "begin end");
+						TestCase::assert(testee.find(Key(1)) == testee.end(), "find");
+						TestCase::assert(testee.lower_bound(Key(1)) == testee.end(), "lower_bound");
+					}),
+
+				TestCase(
+					"ordered iteration",
+					[] {
+						Polymorphic::Map<Key, T> source = make(1000);
+						ImageType image(source.begin(), source.end());
+						const TesteeType testee = image.view();
+						TestCase::assert(testee.size() == 1000, "size");
+						TestCase::assert(std::equal(testee.begin(), testee.end(), source.begin()), "forward");
+						TestCase::assert(std::equal(testee.rbegin(), testee.rend(), source.rbegin()), "reverse");
+					}),
+
+				TestCase(
+					"find at",
+					[] {
+						Polymorphic::Map<Key, T> source = make(1000);
+						ImageType image(source.begin(), source.end());
+						const TesteeType testee = image.view();
+						for (int i = 0; i < 1000; ++i) {
+							auto found = testee.find(Key(2 * i));
+							TestCase::assert(found != testee.end() && found->second == T(i), "found");
+							TestCase::assert(testee.find(Key(2 * i + 1)) == testee.end(), "not found");
+						}
+						TestCase::assert(testee.at(Key(10)) == T(5), "at");
+						bool thrown = false;
+						try {
+							testee.at(Key(11));
+						} catch (std::out_of_range&) {
+							thrown = true;
+						}
+						TestCase::assert(thrown, "at throws");
+					}),
+
+				TestCase(
+					"bounds match Map",
+					[] {
+						for (int n = 0; n < 40; ++n) {
+							Polymorphic::Map<Key, T> source = make(n);
+							ImageType image(source.begin(), source.end());
+							const TesteeType testee = image.view();
+							for (int key = -1; key <= 2 * n + 1; ++key) {
+								TestCase::assert(
+									testee.lower_bound(Key(key)) - testee.begin() ==
+										std::distance(source.begin(), source.lower_bound(Key(key))),
+									"lower_bound");
+								TestCase::assert(
+									testee.upper_bound(Key(key)) - testee.begin() ==
+										std::distance(source.begin(), source.upper_bound(Key(key))),
+									"upper_bound");
+							}
+						}
+					}),
+
+				TestCase(
+					"multimap equal_range",
+					[] {
+						Polymorphic::Multimap<Key, T> source;
+						for (int i = 0; i < 30; ++i) {
+							source.emplace(Key(i % 3), T(i));
+						}
+						ImageType image(source.begin(), source.end());
+						const TesteeType testee = image.view();
+						TestCase::assert(std::equal(testee.begin(), testee.end(), source.begin()), "order kept");
+						auto range = testee.equal_range(Key(1));
+						TestCase::assert(range.second - range.first == 10, "range");
+						TestCase::assert(range.first->second == T(1), "first of equal keys");
+						TestCase::assert(testee.count(Key(2)) == 10 && testee.count(Key(3)) == 0, "count");
+					}),
+
+				TestCase(
+					"unsorted input",
+					[] {
+						std::vector<std::pair<const Key, T>> source{{Key(3), T(0)}, {Key(1), T(1)}, {Key(2), T(2)}};
+						ImageType image(source.begin(), source.end());
+						const TesteeType testee = image.view();
+						TestCase::assert(testee.begin()->first == Key(1) && testee.rbegin()->first == Key(3), "sorted");
+					}),
+
+				TestCase(
+					"truncated",
+					[] {
+						Polymorphic::Map<Key, T> source = make(10);
+						ImageType image(source.begin(), source.end());
+						bool thrown = false;
+						try {
+							TesteeType testee(image.storage.data(), image.bytes - 1);
+						} catch (Polymorphic::serialization::Error&) {
+							thrown = true;
+						}
+						TestCase::assert(thrown);
+					}),
+
+				TestCase("mapped file", [] {
+					std::string path("mappedMapTest.dat");
+					Polymorphic::Map<Key, T> source = make(100);
+					TesteeType::build(path, source.begin(), source.end());
+					{
+						TesteeType testee(path);
+						TestCase::assert(testee.size() == 100, "size");
+						TestCase::assert(testee.at(Key(42)) == T(21), "at");
+					}
+					std::remove(path.c_str());
+				})})
+	{
+	}
+};
+
+/// Test MappedSetType image building and lookup.
+template<template<typename...> class MappedSetType, typename Key>
+class MappedSetTestSuite : public TestSuite
+{
+public:
+	typedef MappedSetType<Key> TesteeType;
+	typedef SortedRunImage<TesteeType> ImageType;
+
+	MappedSetTestSuite(const std::string& mappedSetType) :
+		TestSuite(
+			mappedSetType + " image building and lookup",
+			{
+
+				TestCase(
+					"set",
+					[] {
+						Polymorphic::Set<Key> source{Key(5), Key(1), Key(3)};
+						ImageType image(source.begin(), source.end());
+						const TesteeType testee = image.view();
+						TestCase::assert(std::equal(testee.begin(), testee.end(), source.begin()), "elements");
+						TestCase::assert(*testee.find(Key(3)) == Key(3), "find");
+						TestCase::assert(testee.find(Key(2)) == testee.end(), "not found");
+						TestCase::assert(*testee.lower_bound(Key(2)) == Key(3), "lower_bound");
+						TestCase::assert(testee.upper_bound(Key(5)) == testee.end(), "upper_bound");
+					}),
+
+				TestCase("multiset", [] {
+					Polymorphic::Multiset<Key> source{Key(2), Key(1), Key(2), Key(2)};
+					ImageType image(source.begin(), source.end());
+					const TesteeType testee = image.view();
+					TestCase::assert(testee.size() == 4, "size");
+					TestCase::assert(testee.count(Key(2)) == 3, "count");
+					TestCase::assert(testee.equal_range(Key(1)).first == testee.begin(), "equal_range");
+				})})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_MappedMapTestSuite_INCLUDED
@@ -0,0 +1,192 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_MappedUnorderedMapTestSuite_INCLUDED
+#define Testee_MappedUnorderedMapTestSuite_INCLUDED
+
+#include "Polymorphic/UnorderedMap.h"
+#include "Testee/TestSuite.h"
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Testee {
+
+/// Test MappedUnorderedMapType image building, lookup and bucket interface.
+template<template<typename...> class MappedUnorderedMapType, typename Key, typename T>
+class MappedUnorderedMapTestSuite : public TestSuite
+{
+public:
+	typedef MappedUnorderedMapType<Key, T> TesteeType;
+	typedef Polymorphic::UnorderedMap<Key, T> SourceType;
+
+	/// Image built from source, copied into storage aligned like a mapped file.
+	class Image
+	{
+	public:
+		explicit Image(const SourceType& source, float maxLoadFactor = 1.0f)
+		{
+			std::stringstream stream;
+			TesteeType::build(stream, source.begin(), source.end(), maxLoadFactor);
+			std::string image = stream.str();
+			bytes = image.size();
+			storage.resize(bytes / sizeof(std::max_align_t) + 1);
+			image.copy(reinterpret_cast<char*>(storage.data()), bytes);
+		}
+
+		const void* data() const
+		{
+			return storage.data();
+		}
+
+		std::vector<std::max_align_t> storage;
+		std::size_t bytes;
+	};
+
+	/// Map of n entries mapping i to i * 2.
+	static SourceType make(int n)
+	{
+		SourceType result;
+		for (int i = 0; i < n; ++i) {
+			result.emplace(Key(i), T(i * 2));
+		}
+		return result;
+	}
+
+	MappedUnorderedMapTestSuite(const std::string& mappedUnorderedMapType) :
+		TestSuite(
+			mappedUnorderedMapType + " image building, lookup and bucket interface",
+			{
+
+				TestCase(
+					"empty",
+					[] {
+						Image image((SourceType()));
+						const TesteeType testee(image.data(), image.bytes);
+						TestCase::assert(testee.empty(), "empty");
+						TestCase::assert(testee.begin() == testee.end(), "begin end");
+						TestCase::assert(testee.find(Key(1)) == testee.end(), "find");
+						TestCase::assert(testee.bucket_count() == 1, "bucket_count");
+					}),
+
+				TestCase(
+					"find",
+					[] {
+						SourceType source = make(1000);
+						Image image(source);
+						const TesteeType testee(image.data(), image.bytes);
+						TestCase::assert(testee.size() == 1000, "size");
+						for (auto& value : source) {
+							auto found = testee.find(value.first);
+							TestCase::assert(found != testee.end() && found->second == value.second, "found");
+						}
+						TestCase::assert(testee.find(Key(1000)) == testee.end(), "not found");
+					}),
+
+				TestCase(
+					"count equal_range at",
+					[] {
+						Image image(make(10));
+						const TesteeType testee(image.data(), image.bytes);
+						TestCase::assert(testee.count(Key(3)) == 1 && testee.count(Key(30)) == 0, "count");
+						auto range = testee.equal_range(Key(3));
+						TestCase::assert(std::distance(range.first, range.second) == 1 && range.first->first == Key(3), "range");
+						range = testee.equal_range(Key(30));
+						TestCase::assert(range.first == range.second, "empty range");
+						TestCase::assert(testee.at(Key(4)) == T(8), "at");
+						bool thrown = false;
+						try {
+							testee.at(Key(30));
+						} catch (std::out_of_range&) {
+							thrown = true;
+						}
+						TestCase::assert(thrown, "at throws");
+					}),
+
+				TestCase(
+					"buckets",
+					[] {
+						Image image(make(1000), 4.0f);
+						const TesteeType testee(image.data(), image.bytes);
+						TestCase::assert(testee.bucket_count() == 250, "bucket_count");
+						TestCase::assert(testee.load_factor() == 4.0f, "load_factor");
+						std::size_t total = 0;
+						for (std::size_t n = 0; n < testee.bucket_count(); ++n) {
+							total += testee.bucket_size(n);
+							for (auto i = testee.begin(n); i != testee.end(n); ++i) {
+								TestCase::assert(testee.bucket(i->first) == n, "bucket");
+							}
+						}
+						TestCase::assert(total == 1000, "bucket_size");
+					}),
+
+				TestCase(
+					"duplicates skipped",
+					[] {
+						std::vector<std::pair<Key, T>> source{{Key(1), T(1)}, {Key(2), T(2)}, {Key(1), T(3)}};
+						std::stringstream stream;
+						TesteeType::build(stream, source.begin(), source.end());
+						std::string image = stream.str();
+						std::vector<std::max_align_t> storage(image.size() / sizeof(std::max_align_t) + 1);
+						image.copy(reinterpret_cast<char*>(storage.data()), image.size());
+						const TesteeType testee(storage.data(), image.size());
+						TestCase::assert(testee.size() == 2, "size");
+						TestCase::assert(testee.at(Key(1)) == T(1), "first wins");
+					}),
+
+				TestCase(
+					"invalid max load factor",
+					[] {
+						SourceType source = make(10);
+						for (float maxLoadFactor : {0.0f, -1.0f, std::numeric_limits<float>::quiet_NaN()}) {
+							std::stringstream stream;
+							bool thrown = false;
+							try {
+								TesteeType::build(stream, source.begin(), source.end(), maxLoadFactor);
+							} catch (std::invalid_argument&) {
+								thrown = true;
+							}
+							TestCase::assert(thrown && stream.str().empty());
+						}
+					}),
+
+				TestCase(
+					"truncated",
+					[] {
+						Image image(make(10));
+						bool thrown = false;
+						try {
+							TesteeType testee(image.data(), image.bytes - 1);
+						} catch (Polymorphic::serialization::Error&) {
+							thrown = true;
+						}
+						TestCase::assert(thrown);
+					}),
+
+				TestCase("mapped file", [] {
+					std::string path("mappedUnorderedMapTest.dat");
+					SourceType source = make(100);
+					TesteeType::build(path, source.begin(), source.end());
+					{
+						TesteeType testee(path);
+						TesteeType moved(std::move(testee));
+						TestCase::assert(moved.size() == 100, "size");
+						TestCase::assert(moved.at(Key(42)) == T(84), "at");
+					}
+					std::remove(path.c_str());
+				})})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_MappedUnorderedMapTestSuite_INCLUDED
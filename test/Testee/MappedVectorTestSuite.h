@@ -0,0 +1,246 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_MappedVectorTestSuite_INCLUDED
+#define Testee_MappedVectorTestSuite_INCLUDED
+
+#include "Polymorphic/Serialization.h"
+#include "Polymorphic/Vector.h"
+#include "Testee/TestSuite.h"
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace Testee {
+
+/// Test MappedVectorType file mapping, growth and persistence.
+template<template<typename...> class MappedVectorType, typename T>
+class MappedVectorTestSuite : public TestSuite
+{
+public:
+	typedef MappedVectorType<T> TesteeType;
+	typedef typename TesteeType::Mode Mode;
+
+	/// Path of a scratch file in the working directory, removed on construction and destruction. Each instance has its
+	/// own path, so that test cases may run in parallel.
+	class ScratchFile
+	{
+	public:
+		ScratchFile() : path("mappedVectorTest" + std::to_string(instances()++) + ".dat")
+		{
+			std::remove(path.c_str());
+		}
+
+		~ScratchFile()
+		{
+			std::remove(path.c_str());
+		}
+
+		std::size_t size() const
+		{
+			std::ifstream file(path, std::ios::binary | std::ios::ate);
+			return static_cast<std::size_t>(file.tellg());
+		}
+
+		const std::string path;
+
+	private:
+		static std::atomic<int>& instances()
+		{
+			static std::atomic<int> count(0);
+			return count;
+		}
+	};
+
+	MappedVectorTestSuite(const std::string& mappedVectorType) :
+		TestSuite(
+			mappedVectorType + " file mapping, growth and persistence",
+			{
+
+				TestCase(
+					"create",
+					[] {
+						ScratchFile file;
+						const TesteeType testee(file.path, Mode::read_write);
+						TestCase::assert(testee.empty(), "empty");
+						TestCase::assert(testee.writes(), "writes");
+						TestCase::assert(testee.begin() == testee.end(), "begin end");
+					}),
+
+				TestCase(
+					"open missing",
+					[] {
+						ScratchFile file;
+						bool thrown = false;
+						try {
+							TesteeType testee(file.path);
+						} catch (std::system_error&) {
+							thrown = true;
+						}
+						TestCase::assert(thrown);
+					}),
+
+				TestCase(
+					"push_back persists",
+					[] {
+						ScratchFile file;
+						{
+							TesteeType testee(file.path, Mode::read_write);
+							for (int i = 0; i < 1000; ++i) {
+								testee.push_back(T(i));
+							}
+							TestCase::assert(testee.size() == 1000, "size");
+							TestCase::assert(testee.capacity() >= 1000, "capacity");
+							testee.sync();
+						}
+						const TesteeType testee(file.path);
+						TestCase::assert(!testee.writes(), "read only");
+						TestCase::assert(testee.size() == 1000, "reopened size");
+						TestCase::assert(testee[0] == T(0) && testee.at(999) == T(999), "elements");
+						TestCase::assert(testee.front() == T(0) && testee.back() == T(999), "front back");
+						TestCase::assert(*testee.rbegin() == T(999), "rbegin");
+					}),
+
+				TestCase(
+					"close truncates reserve",
+					[] {
+						ScratchFile file;
+						{
+							TesteeType testee(file.path, Mode::read_write);
+							testee.reserve(100);
+							TestCase::assert(testee.capacity() == 100, "capacity");
+							testee.resize(10, T(7));
+						}
+						TestCase::assert(file.size() == sizeof(Polymorphic::serialization::Header) + 10 * sizeof(T));
+					}),
+
+				TestCase(
+					"resize pop_back clear",
+					[] {
+						ScratchFile file;
+						TesteeType testee(file.path, Mode::read_write);
+						testee.resize(5, T(3));
+						testee.resize(7);
+						TestCase::assert(testee.size() == 7 && testee[4] == T(3) && testee[6] == T(), "resize");
+						testee.pop_back();
+						TestCase::assert(testee.size() == 6, "pop_back");
+						testee.clear();
+						TestCase::assert(testee.empty(), "clear");
+					}),
+
+				TestCase(
+					"shrink_to_fit",
+					[] {
+						ScratchFile file;
+						TesteeType testee(file.path, Mode::read_write);
+						testee.reserve(100);
+						testee.push_back(T(1));
+						testee.shrink_to_fit();
+						TestCase::assert(testee.capacity() == 1, "capacity");
+						TestCase::assert(testee[0] == T(1), "element");
+					}),
+
+				TestCase(
+					"read only throws on growth",
+					[] {
+						ScratchFile file;
+						{
+							TesteeType testee(file.path, Mode::read_write);
+						}
+						TesteeType testee(file.path);
+						bool thrown = false;
+						try {
+							testee.push_back(T(1));
+						} catch (std::logic_error&) {
+							thrown = true;
+						}
+						TestCase::assert(thrown);
+					}),
+
+				TestCase(
+					"read only writes stay private",
+					[] {
+						ScratchFile file;
+						{
+							TesteeType testee(file.path, Mode::read_write);
+							testee.push_back(T(1));
+						}
+						{
+							TesteeType testee(file.path);
+							testee[0] = T(2);
+							TestCase::assert(testee.front() == T(2), "written");
+						}
+						TesteeType testee(file.path);
+						TestCase::assert(testee[0] == T(1), "file");
+					}),
+
+				TestCase(
+					"at out of range",
+					[] {
+						ScratchFile file;
+						TesteeType testee(file.path, Mode::read_write);
+						bool thrown = false;
+						try {
+							testee.at(0);
+						} catch (std::out_of_range&) {
+							thrown = true;
+						}
+						TestCase::assert(thrown);
+					}),
+
+				TestCase(
+					"maps serialized Vector",
+					[] {
+						ScratchFile file;
+						Polymorphic::Vector<T> original;
+						for (int i = 0; i < 100; ++i) {
+							original.push_back(T(i));
+						}
+						{
+							std::ofstream stream(file.path, std::ios::binary);
+							original.serialize(stream);
+						}
+						TesteeType testee(file.path);
+						testee.advise(TesteeType::Advice::sequential);
+						TestCase::assert(testee.size() == 100, "size");
+						TestCase::assert(std::equal(testee.begin(), testee.end(), original.begin()), "elements");
+					}),
+
+				TestCase(
+					"rejects foreign file",
+					[] {
+						ScratchFile file;
+						{
+							std::ofstream stream(file.path, std::ios::binary);
+							stream << std::string(64, 'x');
+						}
+						bool thrown = false;
+						try {
+							TesteeType testee(file.path);
+						} catch (Polymorphic::serialization::Error&) {
+							thrown = true;
+						}
+						TestCase::assert(thrown);
+					}),
+
+				TestCase("move", [] {
+					ScratchFile file;
+					TesteeType testee(file.path, Mode::read_write);
+					testee.push_back(T(1));
+					TesteeType moved(std::move(testee));
+					TestCase::assert(moved.size() == 1 && moved[0] == T(1), "moved");
+					TestCase::assert(testee.empty(), "source");
+				})})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_MappedVectorTestSuite_INCLUDED
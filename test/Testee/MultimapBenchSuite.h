@@ -0,0 +1,187 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_MultimapBenchSuite_INCLUDED
+#define Testee_MultimapBenchSuite_INCLUDED
+
+#include "Testee/BenchSuite.h"
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Testee {
+
+/// Time multimap operations of CandidateType, e.g. Polymorphic::UnorderedMultimap, against ReferenceType, e.g.
+/// std::unordered_multimap, for each element count. Ordered and unordered multimaps share these operations.
+template<template<typename...> class ReferenceType, template<typename...> class CandidateType, typename Key, typename T>
+class MultimapBenchSuite : public BenchSuite
+{
+public:
+	typedef ReferenceType<Key, T> Reference;
+	typedef CandidateType<Key, T> Candidate;
+	typedef void (*Operation)(Stopwatch&, std::size_t);
+
+	MultimapBenchSuite(
+		const std::string& subject,
+		const std::string& reference,
+		const std::string& candidate,
+		const std::vector<std::size_t>& counts) :
+		BenchSuite(subject, reference, candidate, benchCases(counts))
+	{
+	}
+
+	/// Elements with keys scattered by BenchValue<Key>, each key held by two consecutive elements.
+	static std::vector<std::pair<Key, T>> elements(std::size_t count)
+	{
+		std::vector<std::pair<Key, T>> result;
+		for (std::size_t i = 0; i < count; ++i) {
+			result.emplace_back(BenchValue<Key>::make(i / 2), BenchValue<T>::make(i));
+		}
+		return result;
+	}
+
+	/// Keys not held by count elements.
+	static std::vector<Key> missingKeys(std::size_t count)
+	{
+		std::vector<Key> result;
+		for (std::size_t i = count; i < 2 * count; ++i) {
+			result.push_back(BenchValue<Key>::make(i));
+		}
+		return result;
+	}
+
+	template<typename Map>
+	static void insert(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<std::pair<Key, T>> source = elements(count);
+		Map testee;
+		stopwatch.start();
+		for (const auto& element : source) {
+			testee.insert(element);
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	template<typename Map>
+	static void emplace(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<std::pair<Key, T>> source = elements(count);
+		Map testee;
+		stopwatch.start();
+		for (auto& element : source) {
+			testee.emplace(std::move(element.first), std::move(element.second));
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	template<typename Map>
+	static void findHit(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<std::pair<Key, T>> source = elements(count);
+		Map testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& element : source) {
+			escape(testee.find(element.first));
+		}
+		stopwatch.stop();
+	}
+
+	template<typename Map>
+	static void findMiss(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<std::pair<Key, T>> source = elements(count);
+		std::vector<Key> missing = missingKeys(count);
+		Map testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& key : missing) {
+			escape(testee.find(key));
+		}
+		stopwatch.stop();
+	}
+
+	template<typename Map>
+	static void equalRange(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<std::pair<Key, T>> source = elements(count);
+		Map testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& element : source) {
+			escape(testee.equal_range(element.first));
+		}
+		stopwatch.stop();
+	}
+
+	template<typename Map>
+	static void iterate(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<std::pair<Key, T>> source = elements(count);
+		Map testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& element : testee) {
+			escape(element);
+		}
+		stopwatch.stop();
+	}
+
+	template<typename Map>
+	static void copy(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<std::pair<Key, T>> source = elements(count);
+		const Map testee(source.begin(), source.end());
+		stopwatch.start();
+		Map copied(testee);
+		stopwatch.stop();
+		escape(copied);
+	}
+
+	/// Erase all elements by key, half of the keys erasing two elements and the other half none.
+	template<typename Map>
+	static void erase(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<std::pair<Key, T>> source = elements(count);
+		Map testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& element : source) {
+			testee.erase(element.first);
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+private:
+	static BenchCase benchCase(const std::string& name, std::size_t count, Operation reference, Operation candidate)
+	{
+		return BenchCase(
+			name,
+			count,
+			[reference, count](Stopwatch& stopwatch) { reference(stopwatch, count); },
+			[candidate, count](Stopwatch& stopwatch) { candidate(stopwatch, count); });
+	}
+
+	static std::list<BenchCase> benchCases(const std::vector<std::size_t>& counts)
+	{
+		std::list<BenchCase> result;
+		for (std::size_t count : counts) {
+			result.push_back(benchCase("insert", count, &insert<Reference>, &insert<Candidate>));
+			result.push_back(benchCase("emplace", count, &emplace<Reference>, &emplace<Candidate>));
+			result.push_back(benchCase("find hit", count, &findHit<Reference>, &findHit<Candidate>));
+			result.push_back(benchCase("find miss", count, &findMiss<Reference>, &findMiss<Candidate>));
+			result.push_back(benchCase("equal_range", count, &equalRange<Reference>, &equalRange<Candidate>));
+			result.push_back(benchCase("iterate", count, &iterate<Reference>, &iterate<Candidate>));
+			result.push_back(benchCase("copy", count, &copy<Reference>, &copy<Candidate>));
+			result.push_back(benchCase("erase", count, &erase<Reference>, &erase<Candidate>));
+		}
+		return result;
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_MultimapBenchSuite_INCLUDED
@@ -0,0 +1,183 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_ParallelSequenceTestSuite_INCLUDED
+#define Testee_ParallelSequenceTestSuite_INCLUDED
+
+#include "Polymorphic/Execution.h"
+#include "Testee/TestSuite.h"
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <vector>
+
+namespace Testee {
+
+/// Test SequenceType bulk operations per execution policy.
+template<template<typename...> class SequenceType>
+class ParallelSequenceTestSuite : public TestSuite
+{
+public:
+	typedef SequenceType<int> TesteeType;
+
+	/// Executor counting bulk invocations, running tasks sequentially.
+	class CountingExecutor : public Polymorphic::execution::Executor
+	{
+	public:
+		CountingExecutor() : invocations(0)
+		{
+		}
+
+		void bulk(std::size_t n, const std::function<void(std::size_t)>& task) override
+		{
+			++invocations;
+			for (std::size_t i = 0; i < n; ++i) {
+				task(i);
+			}
+		}
+
+		unsigned invocations;
+	};
+
+	/// Values 0 to n - 1.
+	static std::vector<int> iota(int n)
+	{
+		std::vector<int> result(n);
+		for (int i = 0; i < n; ++i) {
+			result[i] = i;
+		}
+		return result;
+	}
+
+	static bool equal(const TesteeType& testee, const std::vector<int>& expected)
+	{
+		return testee.size() == expected.size() && std::equal(testee.begin(), testee.end(), expected.begin());
+	}
+
+	ParallelSequenceTestSuite(const std::string& sequenceType) :
+		TestSuite(
+			sequenceType + " bulk operations per execution policy",
+			{
+
+				TestCase(
+					"copy ctor par",
+					[] {
+						std::vector<int> values = iota(1000);
+						TesteeType other;
+						other.assign(values.begin(), values.end());
+						const TesteeType testee(Polymorphic::execution::par.with_threshold(0).with_concurrency(4), other);
+						TestCase::assert(equal(testee, values));
+					}),
+
+				TestCase(
+					"assign seq",
+					[] {
+						std::vector<int> values = iota(100);
+						TesteeType testee(3, 7);
+						testee.assign(Polymorphic::execution::seq, values.begin(), values.end());
+						TestCase::assert(equal(testee, values));
+					}),
+
+				TestCase(
+					"assign par",
+					[] {
+						std::vector<int> values = iota(1000);
+						TesteeType testee(3, 7);
+						testee.assign(
+							Polymorphic::execution::par.with_threshold(0).with_concurrency(4), values.begin(), values.end());
+						TestCase::assert(equal(testee, values));
+					}),
+
+				TestCase(
+					"assign par input iterators",
+					[] {
+						std::vector<int> values = iota(1000);
+						std::list<int> source(values.begin(), values.end());
+						TesteeType testee;
+						testee.assign(Polymorphic::execution::par.with_threshold(0), source.begin(), source.end());
+						TestCase::assert(equal(testee, values));
+					}),
+
+				TestCase(
+					"insert par",
+					[] {
+						std::vector<int> values = iota(1000);
+						TesteeType testee;
+						testee.assign(values.begin(), values.begin() + 10);
+						testee.insert(testee.end(), values.begin() + 990, values.end());
+						auto result = testee.insert(
+							Polymorphic::execution::par.with_threshold(0).with_concurrency(3),
+							testee.cbegin() + 10,
+							values.begin() + 10,
+							values.begin() + 990);
+						TestCase::assert(result == testee.begin() + 10, "result");
+						TestCase::assert(equal(testee, values), "values");
+					}),
+
+				TestCase(
+					"resize par",
+					[] {
+						TesteeType testee(10, 1);
+						testee.resize(Polymorphic::execution::par.with_threshold(0).with_concurrency(4), 1000, 2);
+						TestCase::assert(testee.size() == 1000, "size");
+						TestCase::assert(std::count(testee.begin(), testee.end(), 1) == 10, "kept");
+						TestCase::assert(std::count(testee.begin() + 10, testee.end(), 2) == 990, "appended");
+						testee.resize(Polymorphic::execution::par.with_threshold(0), 5, 2);
+						TestCase::assert(testee.size() == 5, "shrunk");
+					}),
+
+				TestCase(
+					"erase_if par",
+					[] {
+						std::vector<int> values = iota(1000);
+						TesteeType testee;
+						testee.assign(values.begin(), values.end());
+						auto divisible = [](int value) { return value % 3 == 0; };
+						auto erased = testee.erase_if(Polymorphic::execution::par.with_threshold(0).with_concurrency(7), divisible);
+						values.erase(std::remove_if(values.begin(), values.end(), divisible), values.end());
+						TestCase::assert(erased == 334, "erased");
+						TestCase::assert(equal(testee, values), "kept in order");
+					}),
+
+				TestCase(
+					"erase_if seq",
+					[] {
+						std::vector<int> values = iota(10);
+						TesteeType testee;
+						testee.assign(values.begin(), values.end());
+						auto erased = testee.erase_if(Polymorphic::execution::seq, [](int value) { return value >= 5; });
+						TestCase::assert(erased == 5, "erased");
+						TestCase::assert(equal(testee, iota(5)), "kept");
+					}),
+
+				TestCase(
+					"par below threshold",
+					[] {
+						CountingExecutor executor;
+						std::vector<int> values = iota(100);
+						TesteeType testee;
+						testee.assign(Polymorphic::execution::par.with_threshold(1000).on(executor), values.begin(), values.end());
+						TestCase::assert(equal(testee, values), "values");
+						TestCase::assert(executor.invocations == 0, "sequential");
+					}),
+
+				TestCase("par on executor", [] {
+					CountingExecutor executor;
+					std::vector<int> values = iota(1000);
+					TesteeType testee;
+					auto policy = Polymorphic::execution::par.with_threshold(0).with_concurrency(4).on(executor);
+					testee.assign(policy, values.begin(), values.end());
+					TestCase::assert(equal(testee, values), "values");
+					TestCase::assert(executor.invocations == 1, "executor");
+				})})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_ParallelSequenceTestSuite_INCLUDED
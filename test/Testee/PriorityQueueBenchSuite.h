@@ -0,0 +1,117 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_PriorityQueueBenchSuite_INCLUDED
+#define Testee_PriorityQueueBenchSuite_INCLUDED
+
+#include "Testee/BenchSuite.h"
+#include <list>
+#include <string>
+#include <vector>
+
+namespace Testee {
+
+/// Time priority queue operations of Candidate, e.g. Polymorphic::PriorityQueue of arity 4, against Reference, e.g.
+/// of arity 2, for each element count.
+template<typename Reference, typename Candidate>
+class PriorityQueueBenchSuite : public BenchSuite
+{
+public:
+	typedef typename Reference::value_type T;
+	typedef void (*Operation)(Stopwatch&, std::size_t);
+
+	PriorityQueueBenchSuite(
+		const std::string& subject,
+		const std::string& reference,
+		const std::string& candidate,
+		const std::vector<std::size_t>& counts) :
+		BenchSuite(subject, reference, candidate, benchCases(counts))
+	{
+	}
+
+	static std::vector<T> values(std::size_t count)
+	{
+		std::vector<T> result;
+		for (std::size_t i = 0; i < count; ++i) {
+			result.push_back(BenchValue<T>::make(i));
+		}
+		return result;
+	}
+
+	template<typename Queue>
+	static void push(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Queue testee;
+		stopwatch.start();
+		for (const auto& value : source) {
+			testee.push(value);
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	/// Pop all elements of a queue filled up front, reading each top.
+	template<typename Queue>
+	static void pop(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Queue testee;
+		for (const auto& value : source) {
+			testee.push(value);
+		}
+		stopwatch.start();
+		while (!testee.empty()) {
+			escape(testee.top());
+			testee.pop();
+		}
+		stopwatch.stop();
+	}
+
+	/// Replace the top of a full queue by a new element count times, like a scheduler or a k-way merge does.
+	template<typename Queue>
+	static void replaceTop(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(2 * count);
+		Queue testee;
+		for (std::size_t i = 0; i < count; ++i) {
+			testee.push(source[i]);
+		}
+		stopwatch.start();
+		for (std::size_t i = count; i < 2 * count; ++i) {
+			testee.pop();
+			testee.push(source[i]);
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+private:
+	static BenchCase benchCase(const std::string& name, std::size_t count, Operation reference, Operation candidate)
+	{
+		return BenchCase(
+			name,
+			count,
+			[reference, count](Stopwatch& stopwatch) { reference(stopwatch, count); },
+			[candidate, count](Stopwatch& stopwatch) { candidate(stopwatch, count); });
+	}
+
+	static std::list<BenchCase> benchCases(const std::vector<std::size_t>& counts)
+	{
+		std::list<BenchCase> result;
+		for (std::size_t count : counts) {
+			result.push_back(benchCase("push", count, &push<Reference>, &push<Candidate>));
+			result.push_back(benchCase("pop", count, &pop<Reference>, &pop<Candidate>));
+			result.push_back(benchCase("replace top", count, &replaceTop<Reference>, &replaceTop<Candidate>));
+		}
+		return result;
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_PriorityQueueBenchSuite_INCLUDED
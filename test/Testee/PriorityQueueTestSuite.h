@@ -0,0 +1,329 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_PriorityQueueTestSuite_INCLUDED
+#define Testee_PriorityQueueTestSuite_INCLUDED
+
+#include "Testee/TestSuite.h"
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace Testee {
+
+/// Test QueueType C++11 standard priority_queue interface, for value_type int.
+template<typename QueueType>
+class PriorityQueueTestSuite : public TestSuite
+{
+public:
+	typedef typename QueueType::value_type ValueType;
+	typedef typename QueueType::container_type ContainerType;
+	typedef typename QueueType::value_compare CompareType;
+
+	/// Values in random order, and sorted the way the queue pops them.
+	static std::pair<std::vector<ValueType>, std::vector<ValueType>> values(std::size_t count)
+	{
+		std::vector<ValueType> shuffled;
+		for (std::size_t i = 0; i < count; ++i) {
+			shuffled.push_back(ValueType(i % (count / 2 + 1)));
+		}
+		std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(42));
+		std::vector<ValueType> sorted(shuffled);
+		std::sort(sorted.begin(), sorted.end(), [](const ValueType& lhs, const ValueType& rhs) {
+			return CompareType()(rhs, lhs);
+		});
+		return std::make_pair(shuffled, sorted);
+	}
+
+	/// Pop all elements of testee in order.
+	static std::vector<ValueType> drain(QueueType& testee)
+	{
+		std::vector<ValueType> result;
+		while (!testee.empty()) {
+			result.push_back(testee.top());
+			testee.pop();
+		}
+		return result;
+	}
+
+	PriorityQueueTestSuite(const std::string& queueType) :
+		TestSuite(
+			queueType + " C++11 standard interface",
+			{
+
+				TestCase(
+					"typedefs",
+					[] {
+						TestCase::assert(std::is_same<typename ContainerType::value_type, ValueType>::value, "value_type");
+						TestCase::assert(
+							std::is_same<typename QueueType::size_type, typename ContainerType::size_type>::value, "size_type");
+						TestCase::assert(
+							std::is_same<typename QueueType::const_reference, typename ContainerType::const_reference>::value,
+							"const_reference");
+					}),
+
+				TestCase(
+					"ctor default",
+					[] {
+						const QueueType testee;
+						TestCase::assert(testee.empty() && testee.size() == 0);
+					}),
+
+				TestCase(
+					"ctor container",
+					[] {
+						auto input = values(50);
+						const ContainerType container(input.first.begin(), input.first.end());
+						QueueType testee(CompareType(), container);
+						TestCase::assert(testee.size() == 50, "size");
+						TestCase::assert(drain(testee) == input.second, "order");
+					}),
+
+				TestCase(
+					"ctor range",
+					[] {
+						auto input = values(50);
+						QueueType testee(input.first.begin(), input.first.end());
+						TestCase::assert(drain(testee) == input.second);
+					}),
+
+				TestCase(
+					"ctor range container",
+					[] {
+						auto input = values(50);
+						const ContainerType container(input.first.begin(), input.first.begin() + 20);
+						QueueType testee(input.first.begin() + 20, input.first.end(), CompareType(), container);
+						TestCase::assert(drain(testee) == input.second);
+					}),
+
+				TestCase(
+					"push pop",
+					[] {
+						for (std::size_t count : {1, 2, 3, 9, 10, 100, 1000}) {
+							auto input = values(count);
+							QueueType testee;
+							for (const auto& value : input.first) {
+								testee.push(value);
+							}
+							TestCase::assert(testee.size() == count, "size");
+							TestCase::assert(drain(testee) == input.second, "order");
+						}
+					}),
+
+				TestCase(
+					"push rvalue emplace",
+					[] {
+						QueueType testee;
+						ValueType value(3);
+						testee.push(std::move(value));
+						testee.emplace(7);
+						testee.emplace(5);
+						std::vector<ValueType> expected{ValueType(7), ValueType(5), ValueType(3)};
+						if (CompareType()(ValueType(7), ValueType(3))) {
+							std::reverse(expected.begin(), expected.end());
+						}
+						TestCase::assert(drain(testee) == expected);
+					}),
+
+				TestCase(
+					"interleaved",
+					[] {
+						auto input = values(500);
+						QueueType testee;
+						std::vector<ValueType> reference;
+						auto before = [](const ValueType& lhs, const ValueType& rhs) { return CompareType()(lhs, rhs); };
+						for (std::size_t i = 0; i < input.first.size(); ++i) {
+							testee.push(input.first[i]);
+							reference.push_back(input.first[i]);
+							std::push_heap(reference.begin(), reference.end(), before);
+							if (i % 3 == 2) {
+								TestCase::assert(testee.top() == reference.front(), "top");
+								testee.pop();
+								std::pop_heap(reference.begin(), reference.end(), before);
+								reference.pop_back();
+							}
+						}
+						TestCase::assert(testee.size() == reference.size(), "size");
+					}),
+
+				TestCase(
+					"swap",
+					[] {
+						QueueType testee;
+						testee.push(ValueType(1));
+						QueueType other;
+						other.push(ValueType(2));
+						other.push(ValueType(3));
+						testee.swap(other);
+						TestCase::assert(testee.size() == 2 && other.size() == 1, "member");
+						using std::swap;
+						swap(testee, other);
+						TestCase::assert(testee.size() == 1 && other.size() == 2, "non-member");
+					}),
+			})
+	{
+	}
+};
+
+/// Test IndexedQueueType handles, update() and erase(), for value_type int and std::less<int>.
+template<template<typename, typename, std::size_t> class IndexedQueueType, std::size_t Arity>
+class IndexedPriorityQueueTestSuite : public TestSuite
+{
+public:
+	typedef IndexedQueueType<int, std::less<int>, Arity> QueueType;
+	typedef typename QueueType::handle_type HandleType;
+
+	IndexedPriorityQueueTestSuite(const std::string& queueType) :
+		TestSuite(
+			queueType + " handles",
+			{
+
+				TestCase(
+					"push returns handles",
+					[] {
+						QueueType testee;
+						HandleType first = testee.push(3);
+						HandleType second = testee.emplace(5);
+						TestCase::assert(first != second, "distinct");
+						TestCase::assert(testee.contains(first) && testee.contains(second), "contains");
+						TestCase::assert(testee.value(first) == 3 && testee.value(second) == 5, "value");
+						TestCase::assert(testee.top() == 5 && testee.top_handle() == second, "top");
+					}),
+
+				TestCase(
+					"pop releases handle",
+					[] {
+						QueueType testee;
+						HandleType first = testee.push(3);
+						HandleType second = testee.push(5);
+						testee.pop();
+						TestCase::assert(!testee.contains(second) && testee.contains(first), "contains");
+						TestCase::assert(testee.push(4) == second, "reused");
+						TestCase::assert(testee.top() == 4, "top");
+					}),
+
+				TestCase(
+					"update",
+					[] {
+						QueueType testee;
+						std::vector<HandleType> handles;
+						for (int i = 0; i < 20; ++i) {
+							handles.push_back(testee.push(i));
+						}
+						testee.update(handles[3], 100);
+						TestCase::assert(testee.top_handle() == handles[3], "increase");
+						testee.update(handles[3], -1);
+						TestCase::assert(testee.top() == 19, "decrease");
+						testee.update(handles[19], -2);
+						std::vector<int> popped;
+						while (!testee.empty()) {
+							popped.push_back(testee.top());
+							testee.pop();
+						}
+						TestCase::assert(popped.size() == 20 && popped.front() == 18 && popped.back() == -2, "order");
+						TestCase::assert(std::is_sorted(popped.rbegin(), popped.rend()), "sorted");
+					}),
+
+				TestCase(
+					"erase",
+					[] {
+						QueueType testee;
+						std::vector<HandleType> handles;
+						for (int i = 0; i < 20; ++i) {
+							handles.push_back(testee.push(i));
+						}
+						testee.erase(handles[19]);
+						testee.erase(handles[0]);
+						testee.erase(handles[7]);
+						TestCase::assert(testee.size() == 17 && !testee.contains(handles[7]), "size");
+						TestCase::assert(testee.top() == 18, "top");
+						bool thrown = false;
+						try {
+							testee.erase(handles[7]);
+						} catch (std::out_of_range&) {
+							thrown = true;
+						}
+						TestCase::assert(thrown, "stale handle");
+					}),
+
+				TestCase(
+					"random operations",
+					[] {
+						std::mt19937 random(7);
+						QueueType testee;
+						testee.reserve(1000);
+						typedef std::pair<HandleType, int> Entry;
+						std::vector<Entry> live;
+						for (int step = 0; step < 5000; ++step) {
+							int action = static_cast<int>(random() % 4);
+							if (action == 0 || live.empty()) {
+								int value = static_cast<int>(random() % 1000);
+								live.push_back(std::make_pair(testee.push(value), value));
+							} else {
+								std::size_t index = random() % live.size();
+								if (action == 1) {
+									int value = static_cast<int>(random() % 1000);
+									testee.update(live[index].first, value);
+									live[index].second = value;
+								} else if (action == 2) {
+									testee.erase(live[index].first);
+									live.erase(live.begin() + index);
+								} else {
+									auto less = [](const Entry& lhs, const Entry& rhs) { return lhs.second < rhs.second; };
+									auto greatest = std::max_element(live.begin(), live.end(), less);
+									TestCase::assert(testee.top() == greatest->second, "top");
+									HandleType top = testee.top_handle();
+									testee.pop();
+									live.erase(std::find_if(
+										live.begin(), live.end(), [top](const Entry& entry) { return entry.first == top; }));
+								}
+							}
+							TestCase::assert(testee.size() == live.size(), "size");
+						}
+					}),
+
+				TestCase(
+					"pop and erase release payloads",
+					[] {
+						IndexedQueueType<std::shared_ptr<int>, std::less<std::shared_ptr<int>>, Arity> testee;
+						std::shared_ptr<int> popped = std::make_shared<int>(1);
+						std::shared_ptr<int> erased = std::make_shared<int>(2);
+						std::shared_ptr<int> kept = std::make_shared<int>(3);
+						testee.push(popped);
+						HandleType handle = testee.push(erased);
+						testee.push(kept);
+						TestCase::assert(popped.use_count() == 2 && erased.use_count() == 2, "held");
+						testee.erase(handle);
+						TestCase::assert(erased.use_count() == 1, "erase");
+						while (testee.size() > 1) {
+							testee.pop();
+						}
+						TestCase::assert(popped.use_count() + kept.use_count() == 3, "pop");
+					}),
+
+				TestCase(
+					"clear swap",
+					[] {
+						QueueType testee;
+						HandleType handle = testee.push(1);
+						QueueType other;
+						testee.swap(other);
+						TestCase::assert(testee.empty() && other.contains(handle), "swap");
+						other.clear();
+						TestCase::assert(other.empty() && !other.contains(handle), "clear");
+					}),
+			})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_PriorityQueueTestSuite_INCLUDED
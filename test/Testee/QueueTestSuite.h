@@ -0,0 +1,161 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_QueueTestSuite_INCLUDED
+#define Testee_QueueTestSuite_INCLUDED
+
+#include "Testee/TestSuite.h"
+#include <vector>
+
+namespace Testee {
+
+/// Test QueueType C++11 standard queue interface, for value_type int.
+template<typename QueueType>
+class QueueTestSuite : public TestSuite
+{
+public:
+	typedef typename QueueType::container_type ContainerType;
+
+	QueueTestSuite(const std::string& queueType) :
+		TestSuite(
+			queueType + " C++11 standard interface",
+			{
+
+				TestCase(
+					"typedefs",
+					[] {
+						TestCase::assert(std::is_same<typename QueueType::value_type, int>::value, "value_type");
+						TestCase::assert(std::is_same<typename QueueType::reference, int&>::value, "reference");
+						TestCase::assert(std::is_same<typename QueueType::const_reference, const int&>::value, "const_reference");
+						TestCase::assert(
+							std::is_same<typename QueueType::size_type, typename ContainerType::size_type>::value, "size_type");
+					}),
+
+				TestCase(
+					"ctor default",
+					[] {
+						const QueueType testee;
+						TestCase::assert(testee.empty() && testee.size() == 0);
+					}),
+
+				TestCase(
+					"ctor container",
+					[] {
+						const ContainerType container{1, 2, 3};
+						const QueueType testee(container);
+						TestCase::assert(testee.size() == 3 && testee.front() == 1 && testee.back() == 3, "copy");
+						QueueType moved(ContainerType{4, 5});
+						TestCase::assert(moved.size() == 2 && moved.front() == 4, "move");
+					}),
+
+				TestCase(
+					"push pop",
+					[] {
+						QueueType testee;
+						int value = 1;
+						testee.push(value);
+						testee.push(2);
+						testee.emplace(3);
+						TestCase::assert(testee.size() == 3 && testee.front() == 1 && testee.back() == 3, "push");
+						testee.front() = 4;
+						testee.back() = 5;
+						testee.pop();
+						const QueueType& constTestee = testee;
+						TestCase::assert(constTestee.front() == 2 && constTestee.back() == 5, "pop");
+						testee.pop();
+						testee.pop();
+						TestCase::assert(testee.empty(), "empty");
+					}),
+
+				TestCase(
+					"comparison",
+					[] {
+						const QueueType lower(ContainerType{1, 2});
+						const QueueType upper(ContainerType{1, 3});
+						TestCase::assert(lower == lower && lower != upper, "equality");
+						TestCase::assert(lower < upper && lower <= upper && upper > lower && upper >= lower, "ordering");
+					}),
+
+				TestCase(
+					"swap",
+					[] {
+						QueueType testee(ContainerType{1});
+						QueueType other(ContainerType{2, 3});
+						testee.swap(other);
+						TestCase::assert(testee.size() == 2 && other.front() == 1, "member");
+						using std::swap;
+						swap(testee, other);
+						TestCase::assert(testee.size() == 1 && other.back() == 3, "non-member");
+					}),
+			})
+	{
+	}
+};
+
+/// Test QueueType bulk push_range() and pop_n(), and reserve() if the container has it, for value_type int.
+template<typename QueueType>
+class QueueExtensionsTestSuite : public TestSuite
+{
+public:
+	template<typename Testee>
+	static auto reserves(Testee& testee, int) -> decltype(testee.reserve(64), bool())
+	{
+		testee.reserve(64);
+		return testee.capacity() >= 64;
+	}
+
+	template<typename Testee>
+	static bool reserves(Testee&, long)
+	{
+		return true;
+	}
+
+	QueueExtensionsTestSuite(const std::string& queueType) :
+		TestSuite(
+			queueType + " bulk extensions",
+			{
+
+				TestCase(
+					"push_range",
+					[] {
+						QueueType testee;
+						testee.push(0);
+						const std::vector<int> values{1, 2, 3};
+						testee.push_range(values.begin(), values.end());
+						TestCase::assert(testee.size() == 4 && testee.back() == 3, "back");
+						testee.pop();
+						TestCase::assert(testee.front() == 1, "order");
+					}),
+
+				TestCase(
+					"pop_n",
+					[] {
+						QueueType testee;
+						const std::vector<int> values{1, 2, 3, 4, 5};
+						testee.push_range(values.begin(), values.end());
+						testee.pop_n(3);
+						TestCase::assert(testee.size() == 2 && testee.front() == 4, "partial");
+						testee.pop_n(0);
+						TestCase::assert(testee.size() == 2, "none");
+						testee.pop_n(2);
+						TestCase::assert(testee.empty(), "all");
+					}),
+
+				TestCase(
+					"reserve",
+					[] {
+						QueueType testee;
+						TestCase::assert(reserves(testee, 0));
+					}),
+			})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_QueueTestSuite_INCLUDED
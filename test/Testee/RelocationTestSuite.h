@@ -0,0 +1,230 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_RelocationTestSuite_INCLUDED
+#define Testee_RelocationTestSuite_INCLUDED
+
+#include "Polymorphic/Array.h"
+#include "Polymorphic/Relocation.h"
+#include "Polymorphic/Vector.h"
+#include "Testee/TestSuite.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Testee {
+
+/// Element owning heap memory and counting live instances per thread, to detect elements relocated but destroyed twice
+/// or never.
+class Relocatable
+{
+public:
+	static int& live()
+	{
+		static thread_local int count = 0;
+		return count;
+	}
+
+	Relocatable() noexcept
+	{
+		++live();
+	}
+
+	Relocatable(int value) : value(new int(value))
+	{
+		++live();
+	}
+
+	Relocatable(const Relocatable& other) : value(other.value ? new int(*other.value) : nullptr)
+	{
+		++live();
+	}
+
+	Relocatable(Relocatable&& other) noexcept : value(std::move(other.value))
+	{
+		++live();
+	}
+
+	~Relocatable()
+	{
+		--live();
+	}
+
+	Relocatable& operator=(Relocatable other) noexcept
+	{
+		value = std::move(other.value);
+		return *this;
+	}
+
+	bool operator==(int other) const
+	{
+		return value && *value == other;
+	}
+
+private:
+	std::unique_ptr<int> value;
+};
+
+} // namespace Testee
+
+namespace Polymorphic {
+
+template<>
+struct is_trivially_relocatable<Testee::Relocatable> : std::true_type
+{
+};
+
+} // namespace Polymorphic
+
+namespace Testee {
+
+/// Test SequenceType erase and insert of trivially relocatable elements, and is_trivially_relocatable.
+template<template<typename...> class SequenceType>
+class RelocationTestSuite : public TestSuite
+{
+public:
+	/// Sequence of elements constructed from 0 .. n - 1.
+	template<typename T>
+	static SequenceType<T> iota(int n)
+	{
+		SequenceType<T> result;
+		for (int i = 0; i < n; ++i) {
+			result.push_back(T(i));
+		}
+		return result;
+	}
+
+	/// True if testee elements equal expected values.
+	template<typename T>
+	static bool equal(const SequenceType<T>& testee, const std::vector<int>& expected)
+	{
+		if (testee.size() != expected.size()) {
+			return false;
+		}
+		for (std::size_t i = 0; i < expected.size(); ++i) {
+			if (!(testee[i] == expected[i])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	RelocationTestSuite(const std::string& sequenceType) :
+		TestSuite(
+			sequenceType + " relocation",
+			{
+
+				TestCase(
+					"is_trivially_relocatable",
+					[] {
+						TestCase::assert(Polymorphic::is_trivially_relocatable<int>::value, "trivially copyable");
+						TestCase::assert(!Polymorphic::is_trivially_relocatable<std::string>::value, "default");
+						TestCase::assert(Polymorphic::is_trivially_relocatable<Relocatable>::value, "specialized");
+						TestCase::assert(
+							Polymorphic::is_trivially_relocatable<SequenceType<std::string>>::value ==
+								(POLYMORPHIC_RELOCATABLE_DELEGATES != 0),
+							"decorator");
+						TestCase::assert(
+							Polymorphic::is_trivially_relocatable<Polymorphic::Array<Relocatable, 2>>::value &&
+								!Polymorphic::is_trivially_relocatable<Polymorphic::Array<std::string, 2>>::value,
+							"array");
+					}),
+
+				TestCase(
+					"nothrow move",
+					[] {
+						TestCase::assert(
+							std::is_nothrow_move_constructible<SequenceType<int>>::value ==
+								std::is_nothrow_move_constructible<typename SequenceType<int>::DelegateType>::value,
+							"constructible");
+						TestCase::assert(std::is_nothrow_move_constructible<Polymorphic::Vector<int>>::value, "vector");
+						TestCase::assert(std::is_nothrow_move_assignable<Polymorphic::Vector<int>>::value, "vector assignable");
+					}),
+
+				TestCase(
+					"erase",
+					[] {
+						{
+							SequenceType<Relocatable> testee = iota<Relocatable>(10);
+							TestCase::assert(*testee.erase(testee.begin() + 2) == 3, "position result");
+							TestCase::assert(equal(testee, {0, 1, 3, 4, 5, 6, 7, 8, 9}), "position");
+							TestCase::assert(*testee.erase(testee.begin() + 5, testee.begin() + 8) == 9, "range result");
+							TestCase::assert(equal(testee, {0, 1, 3, 4, 5, 9}), "range");
+							auto back = testee.erase(testee.begin() + 4, testee.end());
+							TestCase::assert(back == testee.end(), "back result");
+							TestCase::assert(equal(testee, {0, 1, 3, 4}), "back");
+							testee.erase(testee.begin(), testee.begin() + 1);
+							TestCase::assert(equal(testee, {1, 3, 4}), "front");
+							testee.erase(testee.begin() + 1, testee.begin() + 1);
+							TestCase::assert(equal(testee, {1, 3, 4}), "empty range");
+							TestCase::assert(Relocatable::live() == 3, "live");
+						}
+						TestCase::assert(Relocatable::live() == 0, "destroyed");
+					}),
+
+				TestCase(
+					"erase nested",
+					[] {
+						SequenceType<Polymorphic::Vector<int>> testee;
+						for (int i = 0; i < 100; ++i) {
+							testee.push_back(Polymorphic::Vector<int>(static_cast<std::size_t>(i), i));
+						}
+						testee.erase(testee.begin() + 10, testee.begin() + 20);
+						testee.erase(testee.begin() + 70);
+						testee.erase(testee.begin() + 5);
+						TestCase::assert(testee.size() == 88, "size");
+						for (std::size_t i = 0; i < testee.size(); ++i) {
+							int expected = static_cast<int>(i < 5 ? i : i < 9 ? i + 1 : i < 69 ? i + 11 : i + 12);
+							TestCase::assert(
+								testee[i].size() == static_cast<std::size_t>(expected) &&
+									(testee[i].empty() || testee[i].front() == expected),
+								"element");
+						}
+					}),
+
+				TestCase(
+					"insert emplace",
+					[] {
+						{
+							SequenceType<Relocatable> testee = iota<Relocatable>(5);
+							Relocatable value(7);
+							TestCase::assert(*testee.insert(testee.begin() + 1, value) == 7, "copy result");
+							TestCase::assert(*testee.insert(testee.begin(), Relocatable(8)) == 8, "move result");
+							TestCase::assert(*testee.emplace(testee.begin() + 3, 9) == 9, "emplace result");
+							TestCase::assert(*testee.emplace(testee.end(), 6) == 6, "emplace back result");
+							TestCase::assert(equal(testee, {8, 0, 7, 9, 1, 2, 3, 4, 6}), "elements");
+							testee.insert(testee.begin(), testee[4]);
+							TestCase::assert(equal(testee, {1, 8, 0, 7, 9, 1, 2, 3, 4, 6}), "own element");
+							TestCase::assert(Relocatable::live() == 11, "live");
+						}
+						TestCase::assert(Relocatable::live() == 0, "destroyed");
+					}),
+
+				TestCase(
+					"insert growing",
+					[] {
+						{
+							SequenceType<Relocatable> testee;
+							for (int i = 0; i < 100; ++i) {
+								testee.insert(testee.begin(), Relocatable(i));
+							}
+							std::vector<int> expected;
+							for (int i = 100; i-- > 0;) {
+								expected.push_back(i);
+							}
+							TestCase::assert(equal(testee, expected), "elements");
+						}
+						TestCase::assert(Relocatable::live() == 0, "destroyed");
+					}),
+			})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_RelocationTestSuite_INCLUDED
@@ -0,0 +1,253 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_RingBufferTestSuite_INCLUDED
+#define Testee_RingBufferTestSuite_INCLUDED
+
+#include "Testee/TestSuite.h"
+#include <stdexcept>
+#include <vector>
+
+namespace Testee {
+
+/// Test RingBufferType capacity and overwrite extensions to the deque interface.
+template<template<typename...> class RingBufferType, typename T, typename Allocator = std::allocator<T>>
+class RingBufferTestSuite : public TestSuite
+{
+public:
+	RingBufferTestSuite(const std::string& ringBufferType) :
+		TestSuite(
+			ringBufferType + " capacity and overwrite extensions",
+			{
+
+				TestCase(
+					"capacity default",
+					[] {
+						const RingBufferType<T, Allocator> testee;
+						auto result = testee.capacity();
+						TestCase::assert(
+							std::is_same<typename RingBufferType<T, Allocator>::size_type, decltype(result)>::value, "type");
+						TestCase::assert(result == 0, "result");
+					}),
+
+				TestCase(
+					"reserve power of two",
+					[] {
+						RingBufferType<T, Allocator> testee;
+						testee.reserve(5);
+						TestCase::assert(testee.capacity() == 8, "capacity");
+						TestCase::assert(testee.size() == 0, "size");
+					}),
+
+				TestCase(
+					"reserve max_size",
+					[] {
+						RingBufferType<T, Allocator> testee;
+						bool thrown = false;
+						try {
+							testee.reserve(testee.max_size() + 1);
+						} catch (std::length_error&) {
+							thrown = true;
+						}
+						TestCase::assert(thrown);
+					}),
+
+				TestCase(
+					"full",
+					[] {
+						RingBufferType<T, Allocator> testee;
+						testee.reserve(2);
+						testee.push_back(T(1));
+						TestCase::assert(!testee.full(), "not full");
+						testee.push_back(T(2));
+						TestCase::assert(testee.full(), "full");
+					}),
+
+				TestCase(
+					"push_back grows",
+					[] {
+						RingBufferType<T, Allocator> testee;
+						testee.reserve(2);
+						for (int i = 0; i < 5; ++i) {
+							testee.push_back(T(i));
+						}
+						TestCase::assert(testee.capacity() == 8, "capacity");
+						TestCase::assert(testee.size() == 5, "size");
+						TestCase::assert(testee.front() == T(0) && testee.back() == T(4), "order");
+					}),
+
+				TestCase(
+					"sliding window keeps capacity",
+					[] {
+						RingBufferType<T, Allocator> testee;
+						testee.reserve(4);
+						for (int i = 0; i < 100; ++i) {
+							testee.push_back(T(i));
+							if (testee.size() > 3) {
+								testee.pop_front();
+							}
+						}
+						TestCase::assert(testee.capacity() == 4, "capacity");
+						TestCase::assert(testee[0] == T(97) && testee[1] == T(98) && testee[2] == T(99), "elements");
+					}),
+
+				TestCase(
+					"push_front wraps",
+					[] {
+						RingBufferType<T, Allocator> testee;
+						testee.reserve(4);
+						testee.push_back(T(2));
+						testee.push_front(T(1));
+						testee.push_front(T(0));
+						TestCase::assert(testee.capacity() == 4, "capacity");
+						TestCase::assert(testee[0] == T(0) && testee[1] == T(1) && testee[2] == T(2), "elements");
+					}),
+
+				TestCase(
+					"overwrite push_back",
+					[] {
+						RingBufferType<T, Allocator> testee;
+						testee.reserve(4);
+						testee.set_overwrite(true);
+						TestCase::assert(testee.overwrites(), "overwrites");
+						for (int i = 0; i < 10; ++i) {
+							testee.push_back(T(i));
+						}
+						TestCase::assert(testee.capacity() == 4, "capacity");
+						TestCase::assert(testee.size() == 4, "size");
+						TestCase::assert(testee.front() == T(6) && testee.back() == T(9), "elements");
+					}),
+
+				TestCase(
+					"overwrite push_front",
+					[] {
+						RingBufferType<T, Allocator> testee;
+						testee.reserve(2);
+						testee.set_overwrite(true);
+						for (int i = 0; i < 5; ++i) {
+							testee.push_front(T(i));
+						}
+						TestCase::assert(testee.size() == 2, "size");
+						TestCase::assert(testee.front() == T(4) && testee.back() == T(3), "elements");
+					}),
+
+				TestCase(
+					"copy keeps capacity and overwrite",
+					[] {
+						RingBufferType<T, Allocator> testee;
+						testee.reserve(8);
+						testee.set_overwrite(true);
+						for (int i = 0; i < 3; ++i) {
+							testee.push_back(T(i));
+						}
+						RingBufferType<T, Allocator> copy(testee);
+						TestCase::assert(copy.capacity() == 8 && copy.overwrites(), "copy");
+						RingBufferType<T, Allocator> assigned;
+						assigned.reserve(32);
+						assigned = testee;
+						TestCase::assert(assigned.capacity() == 8 && assigned.overwrites(), "assigned");
+						for (int i = 3; i < 10; ++i) {
+							copy.push_back(T(i));
+							assigned.push_back(T(i));
+						}
+						TestCase::assert(copy.size() == 8 && copy.front() == T(2) && copy.back() == T(9), "copy window");
+						TestCase::assert(assigned == copy && assigned.capacity() == 8, "assigned window");
+					}),
+
+				TestCase(
+					"overwrite without capacity grows",
+					[] {
+						RingBufferType<T, Allocator> testee;
+						testee.set_overwrite(true);
+						testee.push_back(T(1));
+						TestCase::assert(testee.size() == 1, "size");
+						TestCase::assert(testee.capacity() == 1, "capacity");
+					}),
+
+				TestCase(
+					"insert across wrap",
+					[] {
+						RingBufferType<T, Allocator> testee;
+						testee.reserve(8);
+						for (int i = 0; i < 6; ++i) {
+							testee.push_back(T(i));
+						}
+						testee.erase(testee.begin(), testee.begin() + 4);
+						testee.push_back(T(6));
+						testee.push_back(T(7));
+						testee.push_back(T(8));
+						auto result = testee.insert(testee.begin() + 2, T(10));
+						TestCase::assert(*result == T(10), "result");
+						const T expected[] = {T(4), T(5), T(10), T(6), T(7), T(8)};
+						TestCase::assert(std::equal(testee.begin(), testee.end(), expected), "elements");
+					}),
+
+				TestCase(
+					"erase across wrap",
+					[] {
+						RingBufferType<T, Allocator> testee;
+						testee.reserve(4);
+						for (int i = 0; i < 6; ++i) {
+							testee.push_back(T(i));
+							if (testee.size() > 4) {
+								testee.pop_front();
+							}
+						}
+						auto result = testee.erase(testee.begin() + 1);
+						TestCase::assert(*result == T(4), "result");
+						const T expected[] = {T(2), T(4), T(5)};
+						TestCase::assert(std::equal(testee.begin(), testee.end(), expected), "elements");
+					}),
+
+				TestCase(
+					"at out of range",
+					[] {
+						RingBufferType<T, Allocator> testee(2);
+						bool thrown = false;
+						try {
+							testee.at(2);
+						} catch (std::out_of_range&) {
+							thrown = true;
+						}
+						TestCase::assert(thrown);
+					}),
+
+				TestCase("shrink_to_fit capacity", [] {
+					RingBufferType<T, Allocator> testee;
+					testee.reserve(16);
+					testee.push_back(T(1));
+					testee.push_back(T(2));
+					testee.push_back(T(3));
+					testee.shrink_to_fit();
+					TestCase::assert(testee.capacity() == 4, "capacity");
+					TestCase::assert(testee[0] == T(1) && testee[2] == T(3), "elements");
+				}),
+
+				TestCase(
+					"erase empty range",
+					[] {
+						// Elements emptied by self move assignment, unlike T.
+						RingBufferType<std::vector<int>> testee;
+						for (int i = 0; i < 5; ++i) {
+							testee.push_back(std::vector<int>(3, i));
+						}
+						for (int offset = 0; offset <= 5; ++offset) {
+							auto result = testee.erase(testee.begin() + offset, testee.begin() + offset);
+							TestCase::assert(result == testee.begin() + offset, "result");
+						}
+						TestCase::assert(testee.size() == 5, "size");
+						for (int i = 0; i < 5; ++i) {
+							TestCase::assert(testee[i] == std::vector<int>(3, i), "elements");
+						}
+					})})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_RingBufferTestSuite_INCLUDED
@@ -0,0 +1,147 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_SequenceBenchSuite_INCLUDED
+#define Testee_SequenceBenchSuite_INCLUDED
+
+#include "Testee/BenchSuite.h"
+#include <list>
+#include <string>
+#include <vector>
+
+namespace Testee {
+
+/// Time random access sequence operations of CandidateType, e.g. Polymorphic::Vector, against ReferenceType, e.g.
+/// std::vector, for each element count.
+template<template<typename...> class ReferenceType, template<typename...> class CandidateType, typename T>
+class SequenceBenchSuite : public BenchSuite
+{
+public:
+	typedef ReferenceType<T> Reference;
+	typedef CandidateType<T> Candidate;
+	typedef void (*Operation)(Stopwatch&, std::size_t);
+
+	SequenceBenchSuite(
+		const std::string& subject,
+		const std::string& reference,
+		const std::string& candidate,
+		const std::vector<std::size_t>& counts) :
+		BenchSuite(subject, reference, candidate, benchCases(counts))
+	{
+	}
+
+	static std::vector<T> values(std::size_t count)
+	{
+		std::vector<T> result;
+		for (std::size_t i = 0; i < count; ++i) {
+			result.push_back(BenchValue<T>::make(i));
+		}
+		return result;
+	}
+
+	template<typename Sequence>
+	static void pushBack(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Sequence testee;
+		stopwatch.start();
+		for (const auto& value : source) {
+			testee.push_back(value);
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	template<typename Sequence>
+	static void emplaceBack(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Sequence testee;
+		stopwatch.start();
+		for (auto& value : source) {
+			testee.emplace_back(std::move(value));
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	template<typename Sequence>
+	static void subscript(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Sequence testee(source.begin(), source.end());
+		stopwatch.start();
+		for (std::size_t i = 0; i < count; ++i) {
+			escape(testee[i]);
+		}
+		stopwatch.stop();
+	}
+
+	template<typename Sequence>
+	static void iterate(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Sequence testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& value : testee) {
+			escape(value);
+		}
+		stopwatch.stop();
+	}
+
+	template<typename Sequence>
+	static void copy(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		const Sequence testee(source.begin(), source.end());
+		stopwatch.start();
+		Sequence copied(testee);
+		stopwatch.stop();
+		escape(copied);
+	}
+
+	template<typename Sequence>
+	static void popBack(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Sequence testee(source.begin(), source.end());
+		stopwatch.start();
+		while (!testee.empty()) {
+			testee.pop_back();
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+private:
+	static BenchCase benchCase(const std::string& name, std::size_t count, Operation reference, Operation candidate)
+	{
+		return BenchCase(
+			name,
+			count,
+			[reference, count](Stopwatch& stopwatch) { reference(stopwatch, count); },
+			[candidate, count](Stopwatch& stopwatch) { candidate(stopwatch, count); });
+	}
+
+	static std::list<BenchCase> benchCases(const std::vector<std::size_t>& counts)
+	{
+		std::list<BenchCase> result;
+		for (std::size_t count : counts) {
+			result.push_back(benchCase("push_back", count, &pushBack<Reference>, &pushBack<Candidate>));
+			result.push_back(benchCase("emplace_back", count, &emplaceBack<Reference>, &emplaceBack<Candidate>));
+			result.push_back(benchCase("operator[]", count, &subscript<Reference>, &subscript<Candidate>));
+			result.push_back(benchCase("iterate", count, &iterate<Reference>, &iterate<Candidate>));
+			result.push_back(benchCase("copy", count, &copy<Reference>, &copy<Candidate>));
+			result.push_back(benchCase("pop_back", count, &popBack<Reference>, &popBack<Candidate>));
+		}
+		return result;
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_SequenceBenchSuite_INCLUDED
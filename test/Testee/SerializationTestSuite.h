@@ -0,0 +1,163 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_SerializationTestSuite_INCLUDED
+#define Testee_SerializationTestSuite_INCLUDED
+
+#include "Polymorphic/Serialization.h"
+#include "Testee/TestSuite.h"
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Testee {
+
+/// Test SequenceType binary serialization round trips and zero copy views.
+template<template<typename...> class SequenceType>
+class SerializationTestSuite : public TestSuite
+{
+public:
+	struct Point
+	{
+		int x;
+		double y;
+
+		bool operator==(const Point& other) const
+		{
+			return x == other.x && y == other.y;
+		}
+	};
+
+	typedef SequenceType<Point> TesteeType;
+
+	static TesteeType make(int n)
+	{
+		TesteeType result;
+		for (int i = 0; i < n; ++i) {
+			result.push_back(Point{i, i * 0.5});
+		}
+		return result;
+	}
+
+	/// Image copied into storage aligned for doubles.
+	static std::vector<double> aligned(const std::string& image)
+	{
+		std::vector<double> result(image.size() / sizeof(double) + 1);
+		image.copy(reinterpret_cast<char*>(result.data()), image.size());
+		return result;
+	}
+
+	SerializationTestSuite(const std::string& sequenceType) :
+		TestSuite(
+			sequenceType + " binary serialization",
+			{
+
+				TestCase(
+					"round trip",
+					[] {
+						const TesteeType original = make(1000);
+						std::stringstream stream;
+						original.serialize(stream);
+						TestCase::assert(
+							stream.str().size() == sizeof(Polymorphic::serialization::Header) + 1000 * sizeof(Point), "size");
+						TesteeType testee = make(3);
+						testee.deserialize(stream);
+						TestCase::assert(testee == original, "elements");
+					}),
+
+				TestCase(
+					"round trip empty",
+					[] {
+						std::stringstream stream;
+						TesteeType().serialize(stream);
+						TesteeType testee = make(3);
+						testee.deserialize(stream);
+						TestCase::assert(testee.empty());
+					}),
+
+				TestCase(
+					"round trip consecutive",
+					[] {
+						std::stringstream stream;
+						make(2).serialize(stream);
+						make(5).serialize(stream);
+						TesteeType first;
+						TesteeType second;
+						first.deserialize(stream);
+						second.deserialize(stream);
+						TestCase::assert(first == make(2) && second == make(5));
+					}),
+
+				TestCase(
+					"truncated",
+					[] {
+						std::stringstream image;
+						make(10).serialize(image);
+						std::stringstream stream(image.str().substr(0, image.str().size() - 1));
+						TesteeType testee = make(3);
+						bool thrown = false;
+						try {
+							testee.deserialize(stream);
+						} catch (Polymorphic::serialization::Error&) {
+							thrown = true;
+						}
+						TestCase::assert(thrown, "thrown");
+						TestCase::assert(testee == make(3), "unchanged");
+					}),
+
+				TestCase(
+					"element size mismatch",
+					[] {
+						std::stringstream stream;
+						make(10).serialize(stream);
+						SequenceType<char> testee;
+						bool thrown = false;
+						try {
+							testee.deserialize(stream);
+						} catch (Polymorphic::serialization::Error&) {
+							thrown = true;
+						}
+						TestCase::assert(thrown);
+					}),
+
+				TestCase(
+					"view",
+					[] {
+						std::stringstream stream;
+						make(100).serialize(stream);
+						std::string image = stream.str();
+						std::vector<double> buffer = aligned(image);
+						Polymorphic::SerializedView<Point> testee(buffer.data(), image.size());
+						TestCase::assert(testee.size() == 100, "size");
+						TestCase::assert(testee.at(42) == Point{42, 21.0}, "at");
+						TestCase::assert(
+							reinterpret_cast<const char*>(testee.data()) ==
+								reinterpret_cast<const char*>(buffer.data()) + sizeof(Polymorphic::serialization::Header),
+							"zero copy");
+						TestCase::assert(std::equal(testee.begin(), testee.end(), make(100).begin()), "elements");
+					}),
+
+				TestCase("view truncated", [] {
+					std::stringstream stream;
+					make(100).serialize(stream);
+					std::string image = stream.str();
+					std::vector<double> buffer = aligned(image);
+					bool thrown = false;
+					try {
+						Polymorphic::SerializedView<Point>(buffer.data(), image.size() - 1);
+					} catch (Polymorphic::serialization::Error&) {
+						thrown = true;
+					}
+					TestCase::assert(thrown);
+				})})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_SerializationTestSuite_INCLUDED
@@ -0,0 +1,176 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_SetBenchSuite_INCLUDED
+#define Testee_SetBenchSuite_INCLUDED
+
+#include "Testee/BenchSuite.h"
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Testee {
+
+/// Time set operations of CandidateType, e.g. Polymorphic::UnorderedSet, against ReferenceType, e.g.
+/// std::unordered_set, for each element count. Ordered and unordered sets, unique or multi, share these operations.
+template<template<typename...> class ReferenceType, template<typename...> class CandidateType, typename Key>
+class SetBenchSuite : public BenchSuite
+{
+public:
+	typedef ReferenceType<Key> Reference;
+	typedef CandidateType<Key> Candidate;
+	typedef void (*Operation)(Stopwatch&, std::size_t);
+
+	SetBenchSuite(
+		const std::string& subject,
+		const std::string& reference,
+		const std::string& candidate,
+		const std::vector<std::size_t>& counts) :
+		BenchSuite(subject, reference, candidate, benchCases(counts))
+	{
+	}
+
+	/// Keys scattered by BenchValue<Key>, starting at key first.
+	static std::vector<Key> keys(std::size_t count, std::size_t first = 0)
+	{
+		std::vector<Key> result;
+		for (std::size_t i = first; i < first + count; ++i) {
+			result.push_back(BenchValue<Key>::make(i));
+		}
+		return result;
+	}
+
+	template<typename Set>
+	static void insert(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<Key> source = keys(count);
+		Set testee;
+		stopwatch.start();
+		for (const auto& key : source) {
+			testee.insert(key);
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	template<typename Set>
+	static void emplace(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<Key> source = keys(count);
+		Set testee;
+		stopwatch.start();
+		for (auto& key : source) {
+			testee.emplace(std::move(key));
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	template<typename Set>
+	static void findHit(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<Key> source = keys(count);
+		Set testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& key : source) {
+			escape(testee.find(key));
+		}
+		stopwatch.stop();
+	}
+
+	template<typename Set>
+	static void findMiss(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<Key> source = keys(count);
+		std::vector<Key> missing = keys(count, count);
+		Set testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& key : missing) {
+			escape(testee.find(key));
+		}
+		stopwatch.stop();
+	}
+
+	template<typename Set>
+	static void countKeys(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<Key> source = keys(count);
+		Set testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& key : source) {
+			escape(testee.count(key));
+		}
+		stopwatch.stop();
+	}
+
+	template<typename Set>
+	static void iterate(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<Key> source = keys(count);
+		Set testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& key : testee) {
+			escape(key);
+		}
+		stopwatch.stop();
+	}
+
+	template<typename Set>
+	static void copy(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<Key> source = keys(count);
+		const Set testee(source.begin(), source.end());
+		stopwatch.start();
+		Set copied(testee);
+		stopwatch.stop();
+		escape(copied);
+	}
+
+	template<typename Set>
+	static void erase(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<Key> source = keys(count);
+		Set testee(source.begin(), source.end());
+		stopwatch.start();
+		for (const auto& key : source) {
+			testee.erase(key);
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+private:
+	static BenchCase benchCase(const std::string& name, std::size_t count, Operation reference, Operation candidate)
+	{
+		return BenchCase(
+			name,
+			count,
+			[reference, count](Stopwatch& stopwatch) { reference(stopwatch, count); },
+			[candidate, count](Stopwatch& stopwatch) { candidate(stopwatch, count); });
+	}
+
+	static std::list<BenchCase> benchCases(const std::vector<std::size_t>& counts)
+	{
+		std::list<BenchCase> result;
+		for (std::size_t count : counts) {
+			result.push_back(benchCase("insert", count, &insert<Reference>, &insert<Candidate>));
+			result.push_back(benchCase("emplace", count, &emplace<Reference>, &emplace<Candidate>));
+			result.push_back(benchCase("find hit", count, &findHit<Reference>, &findHit<Candidate>));
+			result.push_back(benchCase("find miss", count, &findMiss<Reference>, &findMiss<Candidate>));
+			result.push_back(benchCase("count", count, &countKeys<Reference>, &countKeys<Candidate>));
+			result.push_back(benchCase("iterate", count, &iterate<Reference>, &iterate<Candidate>));
+			result.push_back(benchCase("copy", count, &copy<Reference>, &copy<Candidate>));
+			result.push_back(benchCase("erase", count, &erase<Reference>, &erase<Candidate>));
+		}
+		return result;
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_SetBenchSuite_INCLUDED
@@ -0,0 +1,162 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_SlabListTestSuite_INCLUDED
+#define Testee_SlabListTestSuite_INCLUDED
+
+#include "Testee/TestSuite.h"
+#include <algorithm>
+#include <functional>
+
+namespace Testee {
+
+/// Test SlabListType node recycling, stability and compaction.
+template<template<typename...> class SlabListType, typename T, typename Allocator = std::allocator<T>>
+class SlabListTestSuite : public TestSuite
+{
+public:
+	SlabListTestSuite(const std::string& slabListType) :
+		TestSuite(
+			slabListType + " node recycling, stability and compaction",
+			{
+
+				TestCase(
+					"capacity",
+					[] {
+						SlabListType<T, Allocator> testee;
+						TestCase::assert(testee.capacity() == 0, "empty");
+						testee.push_back(T(1));
+						TestCase::assert(testee.capacity() >= 1, "allocated");
+					}),
+
+				TestCase(
+					"erased slots reused",
+					[] {
+						SlabListType<T, Allocator> testee;
+						for (int i = 0; i < 1000; ++i) {
+							testee.push_back(T(i));
+						}
+						auto capacity = testee.capacity();
+						for (int i = 0; i < 10; ++i) {
+							testee.remove_if([](const T& value) -> bool { return value % 2 == 0; });
+							testee.resize(1000, T(2));
+						}
+						TestCase::assert(testee.capacity() == capacity);
+					}),
+
+				TestCase(
+					"iterators stable on insert",
+					[] {
+						SlabListType<T, Allocator> testee;
+						testee.push_back(T(1));
+						auto position = testee.begin();
+						const T* address = &*position;
+						for (int i = 0; i < 1000; ++i) {
+							testee.push_front(T(0));
+							testee.push_back(T(2));
+						}
+						TestCase::assert(&*position == address, "address");
+						TestCase::assert(*position == T(1), "value");
+					}),
+
+				TestCase(
+					"iterators stable on swap",
+					[] {
+						SlabListType<T, Allocator> testee{T(1), T(2)};
+						SlabListType<T, Allocator> other{T(3)};
+						auto position = testee.begin();
+						testee.swap(other);
+						TestCase::assert(*position == T(1), "first");
+						TestCase::assert(*++position == T(2), "second");
+						TestCase::assert(++position == other.end(), "end");
+					}),
+
+				TestCase(
+					"splice within list",
+					[] {
+						SlabListType<T, Allocator> testee{T(1), T(2), T(3), T(4)};
+						auto first = testee.begin();
+						auto last = first;
+						++++last;
+						const T* address = &*first;
+						testee.splice(testee.end(), testee, first, last);
+						const T expected[] = {T(3), T(4), T(1), T(2)};
+						TestCase::assert(std::equal(testee.begin(), testee.end(), expected), "elements");
+						TestCase::assert(&*first == address, "address");
+						TestCase::assert(testee.size() == 4, "size");
+					}),
+
+				TestCase(
+					"splice from other list",
+					[] {
+						SlabListType<T, Allocator> testee{T(1), T(4)};
+						SlabListType<T, Allocator> other{T(2), T(3)};
+						testee.splice(++testee.begin(), other);
+						const T expected[] = {T(1), T(2), T(3), T(4)};
+						TestCase::assert(std::equal(testee.begin(), testee.end(), expected), "elements");
+						TestCase::assert(other.empty(), "other");
+					}),
+
+				TestCase(
+					"sort stable keeps addresses",
+					[] {
+						SlabListType<T, Allocator> testee{T(3), T(1), T(2)};
+						const T* address = &testee.front();
+						testee.sort();
+						const T expected[] = {T(1), T(2), T(3)};
+						TestCase::assert(std::equal(testee.begin(), testee.end(), expected), "elements");
+						TestCase::assert(&testee.back() == address, "address");
+					}),
+
+				TestCase(
+					"merge ordered",
+					[] {
+						SlabListType<T, Allocator> testee{T(1), T(3), T(5)};
+						SlabListType<T, Allocator> other{T(2), T(3), T(6)};
+						testee.merge(other);
+						const T expected[] = {T(1), T(2), T(3), T(3), T(5), T(6)};
+						TestCase::assert(std::equal(testee.begin(), testee.end(), expected), "elements");
+						TestCase::assert(other.empty(), "other");
+					}),
+
+				TestCase(
+					"reverse",
+					[] {
+						SlabListType<T, Allocator> testee{T(1), T(2), T(3)};
+						testee.reverse();
+						const T expected[] = {T(3), T(2), T(1)};
+						TestCase::assert(std::equal(testee.begin(), testee.end(), expected), "forward");
+						TestCase::assert(std::equal(testee.rbegin(), testee.rend(), expected + 0, [](const T& lhs, const T& rhs) {
+							return lhs == T(4) - rhs;
+						}), "backward");
+					}),
+
+				TestCase("compact", [] {
+					SlabListType<T, Allocator> testee;
+					for (int i = 0; i < 1000; ++i) {
+						testee.push_front(T(i));
+					}
+					testee.remove_if([](const T& value) -> bool { return value >= 10; });
+					testee.compact();
+					TestCase::assert(testee.size() == 10, "size");
+					TestCase::assert(testee.capacity() < 1000, "capacity");
+					const T* previous = nullptr;
+					std::less<const T*> before;
+					int expected = 9;
+					for (auto& value : testee) {
+						TestCase::assert(value == T(expected--), "value");
+						TestCase::assert(previous == nullptr || before(previous, &value), "traversal order");
+						previous = &value;
+					}
+				})})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_SlabListTestSuite_INCLUDED
@@ -0,0 +1,164 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_SortTestSuite_INCLUDED
+#define Testee_SortTestSuite_INCLUDED
+
+#include "Polymorphic/Execution.h"
+#include "Testee/TestSuite.h"
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace Testee {
+
+/// Test ListType sort per execution policy.
+template<template<typename...> class ListType>
+class SortTestSuite : public TestSuite
+{
+public:
+	typedef std::pair<int, int> ValueType;
+	typedef ListType<ValueType> TesteeType;
+
+	/// Executor counting bulk invocations, running tasks sequentially.
+	class CountingExecutor : public Polymorphic::execution::Executor
+	{
+	public:
+		CountingExecutor() : invocations(0)
+		{
+		}
+
+		void bulk(std::size_t n, const std::function<void(std::size_t)>& task) override
+		{
+			++invocations;
+			for (std::size_t i = 0; i < n; ++i) {
+				task(i);
+			}
+		}
+
+		unsigned invocations;
+	};
+
+	/// List of n elements with keys descending modulo 7 and unique ascending second members.
+	static TesteeType make(int n)
+	{
+		TesteeType result;
+		for (int i = n - 1; i >= 0; --i) {
+			result.push_front(ValueType((n - i) % 7, i));
+		}
+		return result;
+	}
+
+	/// True if testee holds n elements ordered by key, and by second member for equal keys.
+	static bool sortedStable(const TesteeType& testee, int n)
+	{
+		std::vector<ValueType> values(testee.begin(), testee.end());
+		return values.size() == static_cast<std::size_t>(n) && std::is_sorted(values.begin(), values.end());
+	}
+
+	static bool byKey(const ValueType& lhs, const ValueType& rhs)
+	{
+		return lhs.first < rhs.first;
+	}
+
+	SortTestSuite(const std::string& listType) :
+		TestSuite(
+			listType + " sort per execution policy",
+			{
+
+				TestCase(
+					"sort seq",
+					[] {
+						TesteeType testee = make(100);
+						testee.sort(Polymorphic::execution::seq);
+						TestCase::assert(sortedStable(testee, 100));
+					}),
+
+				TestCase(
+					"sort par",
+					[] {
+						TesteeType testee = make(1000);
+						testee.sort(Polymorphic::execution::par.with_threshold(0).with_concurrency(4));
+						TestCase::assert(sortedStable(testee, 1000));
+					}),
+
+				TestCase(
+					"sort par stable",
+					[] {
+						TesteeType testee = make(1000);
+						testee.sort(Polymorphic::execution::par.with_threshold(0).with_concurrency(3), byKey);
+						TestCase::assert(sortedStable(testee, 1000));
+					}),
+
+				TestCase(
+					"sort seq stable",
+					[] {
+						TesteeType testee = make(100);
+						testee.sort(Polymorphic::execution::seq, byKey);
+						TestCase::assert(sortedStable(testee, 100));
+					}),
+
+				TestCase(
+					"sort par below threshold",
+					[] {
+						CountingExecutor executor;
+						TesteeType testee = make(100);
+						testee.sort(Polymorphic::execution::par.with_threshold(1000).on(executor), byKey);
+						TestCase::assert(sortedStable(testee, 100), "sorted");
+						TestCase::assert(executor.invocations == 0, "sequential");
+					}),
+
+				TestCase(
+					"sort par on executor",
+					[] {
+						CountingExecutor executor;
+						TesteeType testee = make(1000);
+						testee.sort(Polymorphic::execution::par.with_threshold(0).with_concurrency(4).on(executor), byKey);
+						TestCase::assert(sortedStable(testee, 1000), "sorted");
+						TestCase::assert(executor.invocations != 0, "executor");
+					}),
+
+				TestCase(
+					"sort keeps addresses",
+					[] {
+						TesteeType testee = make(100);
+						std::vector<const ValueType*> addresses;
+						for (auto& value : testee) {
+							addresses.push_back(&value);
+						}
+						testee.sort(Polymorphic::execution::par.with_threshold(0), byKey);
+						for (auto& value : testee) {
+							TestCase::assert(&value == addresses[value.second], "address");
+						}
+					}),
+
+				TestCase("sort compare throws", [] {
+					TesteeType testee = make(1000);
+					bool thrown = false;
+					try {
+						testee.sort(
+							Polymorphic::execution::par.with_threshold(0).with_concurrency(4),
+							[](const ValueType& lhs, const ValueType& rhs) -> bool {
+								if (lhs.second == 500 || rhs.second == 500) {
+									throw std::runtime_error("compare");
+								}
+								return lhs < rhs;
+							});
+					} catch (std::runtime_error&) {
+						thrown = true;
+					}
+					TestCase::assert(thrown, "thrown");
+					TestCase::assert(std::distance(testee.begin(), testee.end()) == 1000, "elements");
+				})})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_SortTestSuite_INCLUDED
@@ -0,0 +1,145 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_StackBenchSuite_INCLUDED
+#define Testee_StackBenchSuite_INCLUDED
+
+#include "Testee/BenchSuite.h"
+#include <list>
+#include <string>
+#include <vector>
+
+namespace Testee {
+
+/// Time stack operations of Candidate, e.g. Polymorphic::Stack over a Vector, against Reference, e.g.
+/// Polymorphic::Stack over a Deque, for each element count.
+template<typename Reference, typename Candidate>
+class StackBenchSuite : public BenchSuite
+{
+public:
+	typedef typename Reference::value_type T;
+	typedef void (*Operation)(Stopwatch&, std::size_t);
+
+	StackBenchSuite(
+		const std::string& subject,
+		const std::string& reference,
+		const std::string& candidate,
+		const std::vector<std::size_t>& counts) :
+		BenchSuite(subject, reference, candidate, benchCases(counts))
+	{
+	}
+
+	static std::vector<T> values(std::size_t count)
+	{
+		std::vector<T> result;
+		for (std::size_t i = 0; i < count; ++i) {
+			result.push_back(BenchValue<T>::make(i));
+		}
+		return result;
+	}
+
+	template<typename Stack>
+	static void push(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Stack testee;
+		stopwatch.start();
+		for (const auto& value : source) {
+			testee.push(value);
+		}
+		stopwatch.stop();
+		escape(testee);
+	}
+
+	/// Push all elements, then pop them reading each top.
+	template<typename Stack>
+	static void pushPop(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Stack testee;
+		stopwatch.start();
+		for (const auto& value : source) {
+			testee.push(value);
+		}
+		while (!testee.empty()) {
+			escape(testee.top());
+			testee.pop();
+		}
+		stopwatch.stop();
+	}
+
+	/// Push all elements and pop them again on a stack that held as many before, like a work list reused across
+	/// rounds. Containers keeping their capacity do not allocate.
+	template<typename Stack>
+	static void refill(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Stack testee;
+		for (const auto& value : source) {
+			testee.push(value);
+		}
+		while (!testee.empty()) {
+			testee.pop();
+		}
+		stopwatch.start();
+		for (const auto& value : source) {
+			testee.push(value);
+		}
+		while (!testee.empty()) {
+			escape(testee.top());
+			testee.pop();
+		}
+		stopwatch.stop();
+	}
+
+	/// Push three elements and pop two in turn, like a depth first traversal growing and shrinking its stack, then
+	/// pop the remaining ones.
+	template<typename Stack>
+	static void interleaved(Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Stack testee;
+		stopwatch.start();
+		for (std::size_t i = 0; i < count; ++i) {
+			testee.push(source[i]);
+			if (i % 3 == 2) {
+				testee.pop();
+				testee.pop();
+			}
+		}
+		while (!testee.empty()) {
+			testee.pop();
+		}
+		stopwatch.stop();
+	}
+
+private:
+	static BenchCase benchCase(const std::string& name, std::size_t count, Operation reference, Operation candidate)
+	{
+		return BenchCase(
+			name,
+			count,
+			[reference, count](Stopwatch& stopwatch) { reference(stopwatch, count); },
+			[candidate, count](Stopwatch& stopwatch) { candidate(stopwatch, count); });
+	}
+
+	static std::list<BenchCase> benchCases(const std::vector<std::size_t>& counts)
+	{
+		std::list<BenchCase> result;
+		for (std::size_t count : counts) {
+			result.push_back(benchCase("push", count, &push<Reference>, &push<Candidate>));
+			result.push_back(benchCase("push pop", count, &pushPop<Reference>, &pushPop<Candidate>));
+			result.push_back(benchCase("refill", count, &refill<Reference>, &refill<Candidate>));
+			result.push_back(benchCase("interleaved", count, &interleaved<Reference>, &interleaved<Candidate>));
+		}
+		return result;
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_StackBenchSuite_INCLUDED
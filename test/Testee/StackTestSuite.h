@@ -0,0 +1,159 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_StackTestSuite_INCLUDED
+#define Testee_StackTestSuite_INCLUDED
+
+#include "Testee/TestSuite.h"
+#include <vector>
+
+namespace Testee {
+
+/// Test StackType C++11 standard stack interface, for value_type int.
+template<typename StackType>
+class StackTestSuite : public TestSuite
+{
+public:
+	typedef typename StackType::container_type ContainerType;
+
+	StackTestSuite(const std::string& stackType) :
+		TestSuite(
+			stackType + " C++11 standard interface",
+			{
+
+				TestCase(
+					"typedefs",
+					[] {
+						TestCase::assert(std::is_same<typename StackType::value_type, int>::value, "value_type");
+						TestCase::assert(std::is_same<typename StackType::reference, int&>::value, "reference");
+						TestCase::assert(std::is_same<typename StackType::const_reference, const int&>::value, "const_reference");
+						TestCase::assert(
+							std::is_same<typename StackType::size_type, typename ContainerType::size_type>::value, "size_type");
+					}),
+
+				TestCase(
+					"ctor default",
+					[] {
+						const StackType testee;
+						TestCase::assert(testee.empty() && testee.size() == 0);
+					}),
+
+				TestCase(
+					"ctor container",
+					[] {
+						const ContainerType container{1, 2, 3};
+						const StackType testee(container);
+						TestCase::assert(testee.size() == 3 && testee.top() == 3, "copy");
+						StackType moved(ContainerType{4, 5});
+						TestCase::assert(moved.size() == 2 && moved.top() == 5, "move");
+					}),
+
+				TestCase(
+					"push pop",
+					[] {
+						StackType testee;
+						int value = 1;
+						testee.push(value);
+						testee.push(2);
+						testee.emplace(3);
+						TestCase::assert(testee.size() == 3 && testee.top() == 3, "push");
+						testee.top() = 4;
+						testee.pop();
+						TestCase::assert(testee.top() == 2, "pop");
+						testee.pop();
+						testee.pop();
+						TestCase::assert(testee.empty(), "empty");
+					}),
+
+				TestCase(
+					"comparison",
+					[] {
+						const StackType lower(ContainerType{1, 2});
+						const StackType upper(ContainerType{1, 3});
+						TestCase::assert(lower == lower && lower != upper, "equality");
+						TestCase::assert(lower < upper && lower <= upper && upper > lower && upper >= lower, "ordering");
+					}),
+
+				TestCase(
+					"swap",
+					[] {
+						StackType testee(ContainerType{1});
+						StackType other(ContainerType{2, 3});
+						testee.swap(other);
+						TestCase::assert(testee.size() == 2 && other.top() == 1, "member");
+						using std::swap;
+						swap(testee, other);
+						TestCase::assert(testee.size() == 1 && other.top() == 3, "non-member");
+					}),
+			})
+	{
+	}
+};
+
+/// Test StackType bulk push_range() and pop_n(), and reserve() if the container has it, for value_type int.
+template<typename StackType>
+class StackExtensionsTestSuite : public TestSuite
+{
+public:
+	template<typename Testee>
+	static auto reserves(Testee& testee, int) -> decltype(testee.reserve(64), bool())
+	{
+		testee.reserve(64);
+		return testee.capacity() >= 64;
+	}
+
+	template<typename Testee>
+	static bool reserves(Testee&, long)
+	{
+		return true;
+	}
+
+	StackExtensionsTestSuite(const std::string& stackType) :
+		TestSuite(
+			stackType + " bulk extensions",
+			{
+
+				TestCase(
+					"push_range",
+					[] {
+						StackType testee;
+						testee.push(0);
+						const std::vector<int> values{1, 2, 3};
+						testee.push_range(values.begin(), values.end());
+						TestCase::assert(testee.size() == 4 && testee.top() == 3, "top");
+						testee.pop();
+						TestCase::assert(testee.top() == 2, "order");
+					}),
+
+				TestCase(
+					"pop_n",
+					[] {
+						StackType testee;
+						const std::vector<int> values{1, 2, 3, 4, 5};
+						testee.push_range(values.begin(), values.end());
+						testee.pop_n(3);
+						TestCase::assert(testee.size() == 2 && testee.top() == 2, "partial");
+						testee.pop_n(0);
+						TestCase::assert(testee.size() == 2, "none");
+						testee.pop_n(2);
+						TestCase::assert(testee.empty(), "all");
+					}),
+
+				TestCase(
+					"reserve",
+					[] {
+						StackType testee;
+						TestCase::assert(reserves(testee, 0));
+					}),
+			})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_StackTestSuite_INCLUDED
@@ -0,0 +1,367 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Testee_StringTestSuite_INCLUDED
+#define Testee_StringTestSuite_INCLUDED
+
+#include "Testee/TestSuite.h"
+#include <cstring>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+
+namespace Testee {
+
+/// Test StringType C++11 standard basic_string interface, for CharT char.
+template<template<typename...> class StringType>
+class StringTestSuite : public TestSuite
+{
+public:
+	typedef StringType<char> Testee;
+
+	StringTestSuite(const std::string& stringType) :
+		TestSuite(
+			stringType + " C++11 standard interface",
+			{
+
+				TestCase(
+					"typedefs",
+					[] {
+						TestCase::assert(std::is_same<typename Testee::value_type, char>::value, "value_type");
+						TestCase::assert(std::is_same<typename Testee::traits_type, std::char_traits<char>>::value, "traits_type");
+						TestCase::assert(std::is_same<typename Testee::reference, char&>::value, "reference");
+						TestCase::assert(std::is_same<typename Testee::size_type, std::size_t>::value, "size_type");
+						TestCase::assert(Testee::npos == std::string::npos, "npos");
+					}),
+
+				TestCase(
+					"ctor",
+					[] {
+						TestCase::assert(Testee().empty(), "default");
+						TestCase::assert(Testee("abc").size() == 3, "c string");
+						TestCase::assert(Testee("abcdef", 2) == "ab", "c string n");
+						TestCase::assert(Testee(3, 'x') == "xxx", "fill");
+						TestCase::assert(Testee({'a', 'b'}) == "ab", "initializer list");
+						const Testee other("abcdef");
+						TestCase::assert(Testee(other) == "abcdef", "copy");
+						TestCase::assert(Testee(other, 2, 3) == "cde", "substring");
+						TestCase::assert(Testee(other.begin() + 1, other.end()) == "bcdef", "range");
+						Testee moved("abcdef");
+						TestCase::assert(Testee(std::move(moved)) == "abcdef", "move");
+					}),
+
+				TestCase(
+					"operator=",
+					[] {
+						Testee testee;
+						testee = "abc";
+						TestCase::assert(testee == "abc", "c string");
+						testee = 'x';
+						TestCase::assert(testee == "x", "char");
+						testee = {'a', 'b'};
+						TestCase::assert(testee == "ab", "initializer list");
+						const Testee other("def");
+						auto& result = (testee = other);
+						TestCase::assert(&result == &testee && testee == "def", "copy");
+					}),
+
+				TestCase(
+					"capacity",
+					[] {
+						Testee testee("abc");
+						TestCase::assert(testee.size() == 3 && testee.length() == 3, "size");
+						TestCase::assert(testee.max_size() >= testee.size(), "max_size");
+						testee.reserve(100);
+						TestCase::assert(testee.capacity() >= 100, "reserve");
+						testee.shrink_to_fit();
+						TestCase::assert(testee.capacity() >= 3, "shrink_to_fit");
+						testee.resize(5, 'x');
+						TestCase::assert(testee == "abcxx", "resize value");
+						testee.resize(2);
+						TestCase::assert(testee == "ab", "resize");
+						testee.clear();
+						TestCase::assert(testee.empty(), "clear");
+					}),
+
+				TestCase(
+					"small string in place",
+					[] {
+						// Short strings stay in the buffer embedded in the object, without heap allocation.
+						const Testee testee("abc");
+						const char* begin = reinterpret_cast<const char*>(&testee);
+						TestCase::assert(testee.data() >= begin && testee.data() < begin + sizeof(testee));
+					}),
+
+				TestCase(
+					"element access",
+					[] {
+						Testee testee("abc");
+						testee[0] = 'x';
+						testee.at(1) = 'y';
+						const Testee& constTestee = testee;
+						TestCase::assert(constTestee[0] == 'x' && constTestee.at(1) == 'y', "subscript at");
+						TestCase::assert(testee.front() == 'x' && constTestee.back() == 'c', "front back");
+						TestCase::assert(std::strcmp(testee.c_str(), "xyc") == 0 && testee.data() == testee.c_str(), "c_str");
+						bool thrown = false;
+						try {
+							constTestee.at(3);
+						} catch (std::out_of_range&) {
+							thrown = true;
+						}
+						TestCase::assert(thrown, "at out of range");
+					}),
+
+				TestCase(
+					"iterators",
+					[] {
+						Testee testee("abc");
+						TestCase::assert(testee.end() - testee.begin() == 3 && *testee.rbegin() == 'c', "begin end");
+						TestCase::assert(*testee.cbegin() == 'a' && *testee.crbegin() == 'c', "const");
+						TestCase::assert(testee.rend() - testee.rbegin() == 3 && testee.crend() - testee.crbegin() == 3, "rend");
+					}),
+
+				TestCase(
+					"append",
+					[] {
+						Testee testee("a");
+						testee += Testee("b");
+						testee += "c";
+						testee += 'd';
+						testee += {'e'};
+						TestCase::assert(testee == "abcde", "operator+=");
+						testee.append(Testee("fgh"), 1, 1).append("ij", 1).append("k").append(2, 'l');
+						TestCase::assert(testee == "abcdegikll", "append");
+						const std::string tail("mn");
+						testee.append(tail.begin(), tail.end()).append({'o'});
+						testee.push_back('p');
+						TestCase::assert(testee == "abcdegikllmnop", "range push_back");
+					}),
+
+				TestCase(
+					"assign",
+					[] {
+						Testee testee;
+						TestCase::assert(testee.assign(Testee("abc")) == "abc", "copy");
+						TestCase::assert(testee.assign(Testee("abcdef"), 2, 2) == "cd", "substring");
+						TestCase::assert(testee.assign("abc", 1) == "a", "c string n");
+						TestCase::assert(testee.assign("xyz") == "xyz", "c string");
+						TestCase::assert(testee.assign(2, 'q') == "qq", "fill");
+						TestCase::assert(testee.assign({'r', 's'}) == "rs", "initializer list");
+					}),
+
+				TestCase(
+					"insert",
+					[] {
+						Testee testee("ad");
+						testee.insert(1, Testee("c")).insert(1, "b");
+						TestCase::assert(testee == "abcd", "string");
+						testee.insert(0, 2, '-');
+						TestCase::assert(testee == "--abcd", "fill");
+						auto position = testee.insert(testee.cend(), '!');
+						TestCase::assert(*position == '!' && testee == "--abcd!", "char");
+						testee.insert(testee.cbegin(), {'<'});
+						TestCase::assert(testee == "<--abcd!", "initializer list");
+					}),
+
+				TestCase(
+					"erase",
+					[] {
+						Testee testee("abcdef");
+						testee.erase(4);
+						TestCase::assert(testee == "abcd", "tail");
+						testee.erase(testee.cbegin());
+						TestCase::assert(testee == "bcd", "position");
+						testee.erase(testee.cbegin(), testee.cbegin() + 2);
+						TestCase::assert(testee == "d", "range");
+						testee.pop_back();
+						TestCase::assert(testee.empty(), "pop_back");
+					}),
+
+				TestCase(
+					"replace",
+					[] {
+						Testee testee("abcdef");
+						testee.replace(1, 2, Testee("XY"));
+						TestCase::assert(testee == "aXYdef", "string");
+						testee.replace(0, 1, "12345", 2);
+						TestCase::assert(testee == "12XYdef", "c string n");
+						testee.replace(testee.cbegin(), testee.cbegin() + 2, 3, '_');
+						TestCase::assert(testee == "___XYdef", "iterators fill");
+					}),
+
+				TestCase(
+					"copy swap",
+					[] {
+						const Testee testee("abcdef");
+						char buffer[3] = {};
+						TestCase::assert(testee.copy(buffer, 2, 1) == 2 && buffer[0] == 'b' && buffer[1] == 'c', "copy");
+						Testee lhs("a");
+						Testee rhs("b");
+						lhs.swap(rhs);
+						TestCase::assert(lhs == "b" && rhs == "a", "member swap");
+						using std::swap;
+						swap(lhs, rhs);
+						TestCase::assert(lhs == "a" && rhs == "b", "swap");
+					}),
+
+				TestCase(
+					"find",
+					[] {
+						const Testee testee("abcabc");
+						TestCase::assert(testee.find(Testee("bc")) == 1 && testee.find("bc", 2) == 4, "find");
+						TestCase::assert(testee.find('z') == Testee::npos, "find missing");
+						TestCase::assert(testee.rfind("bc") == 4 && testee.rfind('a', 2) == 0, "rfind");
+						TestCase::assert(testee.find_first_of("cb") == 1 && testee.find_last_of('a') == 3, "first last of");
+						TestCase::assert(testee.find_first_not_of("ab") == 2, "find_first_not_of");
+						TestCase::assert(testee.find_last_not_of(Testee("c")) == 4, "find_last_not_of");
+					}),
+
+				TestCase(
+					"substr compare",
+					[] {
+						const Testee testee("abcdef");
+						auto result = testee.substr(2, 3);
+						TestCase::assert(std::is_same<Testee, decltype(result)>::value && result == "cde", "substr");
+						TestCase::assert(testee.compare("abcdef") == 0 && testee.compare(Testee("b")) < 0, "compare");
+						TestCase::assert(testee.compare(1, 2, "bc") == 0, "compare range");
+						TestCase::assert(testee.compare(1, 2, Testee("xbc"), 1, 2) == 0, "compare ranges");
+					}),
+
+				TestCase(
+					"operator+",
+					[] {
+						const Testee testee("ab");
+						TestCase::assert(testee + Testee("cd") == "abcd", "string");
+						TestCase::assert(testee + "c" == "abc" && "c" + testee == "cab", "c string");
+						TestCase::assert(testee + 'c' == "abc" && 'c' + testee == "cab", "char");
+						TestCase::assert(Testee("x") + testee + "y" + 'z' == "xabyz", "rvalue chain");
+					}),
+
+				TestCase(
+					"comparison",
+					[] {
+						const Testee lower("ab");
+						const Testee upper("ac");
+						TestCase::assert(lower == lower && lower != upper && lower < upper && lower <= upper, "string lhs");
+						TestCase::assert(upper > lower && upper >= lower, "string rhs");
+						TestCase::assert(lower == "ab" && "ab" == lower && lower < "ac" && "aa" < lower, "c string");
+						TestCase::assert(lower != "ac" && "ac" > lower && lower >= "ab" && "ab" <= lower, "c string reverse");
+					}),
+
+				TestCase(
+					"stream",
+					[] {
+						std::istringstream input("one two\nthree;four");
+						Testee testee;
+						input >> testee;
+						TestCase::assert(testee == "one", "operator>>");
+						getline(input, testee);
+						TestCase::assert(testee == " two", "getline");
+						getline(input, testee, ';');
+						TestCase::assert(testee == "three", "getline delimiter");
+						std::ostringstream output;
+						output << testee;
+						TestCase::assert(output.str() == "three", "operator<<");
+					}),
+
+				TestCase(
+					"hash",
+					[] {
+						const Testee testee("abc");
+						TestCase::assert(std::hash<Testee>()(testee) == std::hash<std::string>()("abc"));
+					}),
+			})
+	{
+	}
+};
+
+/// Test StringType std::basic_string interoperation and overwrite extensions, for CharT char.
+template<template<typename...> class StringType>
+class StringInteropTestSuite : public TestSuite
+{
+public:
+	typedef StringType<char> Testee;
+
+	StringInteropTestSuite(const std::string& stringType) :
+		TestSuite(
+			stringType + " std::basic_string interoperation",
+			{
+
+				TestCase(
+					"conversion",
+					[] {
+						Testee testee("abc");
+						std::string& reference = testee;
+						reference += 'd';
+						TestCase::assert(testee == "abcd", "reference");
+						const std::string copy = testee;
+						TestCase::assert(copy == "abcd", "copy");
+						const Testee other = std::string("efg");
+						TestCase::assert(other == "efg", "construct");
+					}),
+
+				TestCase(
+					"heterogeneous comparison",
+					[] {
+						const Testee testee("ab");
+						const std::string same("ab");
+						const std::string upper("ac");
+						TestCase::assert(testee == same && same == testee, "equal");
+						TestCase::assert(testee != upper && upper != testee, "not equal");
+						TestCase::assert(testee < upper && upper > testee && testee <= same && same >= testee, "ordering");
+					}),
+
+				TestCase(
+					"heterogeneous members",
+					[] {
+						Testee testee("ab");
+						const std::string other("cd");
+						testee += other;
+						testee.append(other, 1, 1).insert(0, other);
+						TestCase::assert(testee == "cdabcdd", "modifiers");
+						TestCase::assert(testee.find(other) == 0 && testee.compare(2, 2, std::string("ab")) == 0, "queries");
+						TestCase::assert(testee + other == "cdabcddcd" && other + testee == "cdcdabcdd", "operator+");
+					}),
+
+				TestCase(
+					"resize_and_overwrite",
+					[] {
+						Testee testee("ab");
+						testee.resize_and_overwrite(8, [](char* p, std::size_t n) {
+							TestCase::assert(n == 8, "n");
+							TestCase::assert(p[0] == 'a' && p[1] == 'b', "prefix kept");
+							std::memcpy(p + 2, "cdef", 4);
+							return std::size_t(6);
+						});
+						TestCase::assert(testee == "abcdef" && testee.size() == 6, "result");
+						TestCase::assert(testee.c_str()[6] == '\0', "terminated");
+					}),
+
+				TestCase(
+					"resize_and_overwrite shrink",
+					[] {
+						Testee testee("abcdef");
+						testee.resize_and_overwrite(3, [](char*, std::size_t) { return std::size_t(1); });
+						TestCase::assert(testee == "a");
+					}),
+
+				TestCase(
+					"small string footprint",
+					[] {
+						// Decorating adds the vtable pointer, but keeps the delegate with its small string buffer in place.
+						TestCase::assert(sizeof(Testee) <= sizeof(std::string) + sizeof(void*), "size");
+						Testee testee;
+						TestCase::assert(testee.capacity() == std::string().capacity(), "default capacity");
+					}),
+			})
+	{
+	}
+};
+
+} // namespace Testee
+
+#endif // Testee_StringTestSuite_INCLUDED
@@ -10,6 +10,7 @@
 
 #include <functional>
 #include <stdexcept>
+#include <string>
 
 namespace Testee {
 
@@ -30,6 +31,11 @@ public:
 		}
 	}
 
+	const std::string& getName() const noexcept
+	{
+		return name;
+	}
+
 	static void assert(bool passed, const char* comment = "")
 	{
 		if (!passed) {
@@ -9,40 +9,215 @@
 #define TestSuite_INCLUDED
 
 #include "TestCase.h"
+#include "Json.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
 #include <iostream>
 #include <list>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace Testee {
 
 class TestSuite
 {
 public:
+	/// Options of run(const Options& options).
+	struct Options
+	{
+		/// Threads running test cases. 1 runs them in order on the calling thread, 0 uses one per hardware thread.
+		unsigned int jobs;
+		/// Number of slowest test cases reported with their wall clock time, none if 0.
+		std::size_t slowest;
+		/// File appending one JSON line per suite run, holding results and wall clock times of all cases, none if empty.
+		std::string json;
+
+		Options() : jobs(1), slowest(0), json()
+		{
+		}
+
+		/// Options set by environment variables TESTEE_JOBS, TESTEE_SLOWEST and TESTEE_JSON, so that test runners
+		/// pick them up unchanged, e.g. by TESTEE_JOBS=0 make check.
+		static Options fromEnvironment()
+		{
+			Options options;
+			if (const char* jobs = std::getenv("TESTEE_JOBS")) {
+				options.jobs = static_cast<unsigned int>(std::strtoul(jobs, nullptr, 10));
+			}
+			if (const char* slowest = std::getenv("TESTEE_SLOWEST")) {
+				options.slowest = static_cast<std::size_t>(std::strtoul(slowest, nullptr, 10));
+			}
+			if (const char* json = std::getenv("TESTEE_JSON")) {
+				options.json = json;
+			}
+			return options;
+		}
+	};
+
 	TestSuite(const std::string& subject, std::list<TestCase>&& testCases) : subject(subject), testCases(std::move(testCases))
 	{
 	}
 
+	/// Run test cases with options from the environment, see Options::fromEnvironment().
 	virtual bool run()
 	{
-		unsigned int passed = 0;
-		unsigned int failed = 0;
+		return run(Options::fromEnvironment());
+	}
+
+	/// Run test cases, distributing them across options.jobs threads unless 1. Test cases run in parallel must not
+	/// share mutable state. Failures are reported in test case order either way. Exceptions other than
+	/// std::runtime_error are rethrown once all test cases have run.
+	bool run(const Options& options)
+	{
 		std::cout << "Testing " << subject << " ..." << std::endl;
+		std::vector<TestCase*> cases;
 		for (auto& testCase : testCases) {
-			try {
-				testCase.run();
+			cases.push_back(&testCase);
+		}
+		std::vector<Result> results(cases.size());
+		auto start = Clock::now();
+		std::size_t jobs = options.jobs != 0 ? options.jobs : std::max(1u, std::thread::hardware_concurrency());
+		jobs = std::min(jobs, cases.size());
+		if (jobs <= 1) {
+			for (std::size_t i = 0; i < cases.size(); ++i) {
+				results[i] = runCase(*cases[i]);
+				if (!results[i].passed) {
+					std::cerr << results[i].message << std::endl;
+				}
+			}
+		} else {
+			std::atomic<std::size_t> next(0);
+			auto work = [&cases, &results, &next] {
+				for (std::size_t i = next++; i < cases.size(); i = next++) {
+					try {
+						results[i] = runCase(*cases[i]);
+					} catch (...) {
+						results[i].exception = std::current_exception();
+					}
+				}
+			};
+			std::vector<std::thread> workers;
+			for (std::size_t i = 1; i < jobs; ++i) {
+				workers.emplace_back(work);
+			}
+			work();
+			for (auto& worker : workers) {
+				worker.join();
+			}
+			for (const auto& result : results) {
+				if (result.exception) {
+					std::rethrow_exception(result.exception);
+				}
+				if (!result.passed) {
+					std::cerr << result.message << std::endl;
+				}
+			}
+		}
+		double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+		unsigned int passed = 0;
+		unsigned int failed = 0;
+		for (const auto& result : results) {
+			if (result.passed) {
 				++passed;
-			} catch (std::runtime_error& e) {
-				std::cerr << e.what() << std::endl;
+			} else {
 				++failed;
 			}
 		}
 		std::cout << "... passed: " << passed << ", failed: " << failed << std::endl;
+		if (options.slowest != 0) {
+			reportSlowest(cases, results, options.slowest);
+		}
+		if (!options.json.empty()) {
+			writeJson(options.json, cases, results, seconds);
+		}
 		return failed == 0;
 	}
 
 protected:
 	std::string subject;
 	std::list<TestCase> testCases;
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	/// Outcome and wall clock time of a test case.
+	struct Result
+	{
+		Result() : passed(false), seconds(0)
+		{
+		}
+
+		bool passed;
+		double seconds;
+		std::string message;
+		std::exception_ptr exception;
+	};
+
+	static Result runCase(TestCase& testCase)
+	{
+		Result result;
+		auto start = Clock::now();
+		try {
+			testCase.run();
+			result.passed = true;
+		} catch (std::runtime_error& e) {
+			result.message = e.what();
+		}
+		result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+		return result;
+	}
+
+	static void reportSlowest(const std::vector<TestCase*>& cases, const std::vector<Result>& results, std::size_t count)
+	{
+		std::vector<std::size_t> order;
+		for (std::size_t i = 0; i < results.size(); ++i) {
+			order.push_back(i);
+		}
+		count = std::min(count, order.size());
+		std::partial_sort(order.begin(), order.begin() + count, order.end(), [&results](std::size_t lhs, std::size_t rhs) {
+			return results[lhs].seconds > results[rhs].seconds;
+		});
+		std::cout << "... slowest:" << std::endl;
+		for (std::size_t i = 0; i < count; ++i) {
+			char milliseconds[32];
+			std::snprintf(milliseconds, sizeof(milliseconds), "%10.3f ms", results[order[i]].seconds * 1000);
+			std::cout << milliseconds << "  " << cases[order[i]]->getName() << std::endl;
+		}
+	}
+
+	void writeJson(
+		const std::string& path, const std::vector<TestCase*>& cases, const std::vector<Result>& results, double seconds) const
+	{
+		std::ostringstream line;
+		line.precision(9);
+		unsigned int failed = 0;
+		for (const auto& result : results) {
+			failed += result.passed ? 0 : 1;
+		}
+		line << "{\"suite\":" << jsonString(subject) << ",\"passed\":" << results.size() - failed << ",\"failed\":" << failed
+			 << ",\"seconds\":" << seconds << ",\"cases\":[";
+		for (std::size_t i = 0; i < results.size(); ++i) {
+			line << (i == 0 ? "" : ",") << "{\"name\":" << jsonString(cases[i]->getName())
+				 << ",\"passed\":" << (results[i].passed ? "true" : "false") << ",\"seconds\":" << results[i].seconds;
+			if (!results[i].passed) {
+				line << ",\"message\":" << jsonString(results[i].message);
+			}
+			line << "}";
+		}
+		line << "]}\n";
+		std::ofstream file(path, std::ios::app);
+		file << line.str();
+		if (!file) {
+			std::cerr << "Cannot append test results to " << path << std::endl;
+		}
+	}
 };
 
 } // namespace Testee
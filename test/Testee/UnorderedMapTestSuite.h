@@ -10,6 +10,7 @@
 
 #include "Testee/TestSuite.h"
 #include <array>
+#include <vector>
 
 namespace Testee {
 
@@ -678,6 +679,47 @@ public:
 						TestCase::assert(newCount > oldCount);
 					}),
 
+				TestCase(
+					"insert range reserves",
+					[] {
+						std::vector<ValueType> values;
+						for (int i = 0; i < 1000; ++i) {
+							values.push_back(ValueType(static_cast<Key>(i), static_cast<T>(i)));
+						}
+						UnorderedMapType<Key, T, Hash, Predicate, Allocator> reference;
+						reference.reserve(values.size());
+						UnorderedMapType<Key, T, Hash, Predicate, Allocator> testee;
+						testee.insert(values.begin(), values.end());
+						TestCase::assert(testee.size() == values.size(), "size");
+						TestCase::assert(testee.bucket_count() == reference.bucket_count(), "insert");
+						UnorderedMapType<Key, T, Hash, Predicate, Allocator> constructed(values.begin(), values.end());
+						TestCase::assert(constructed.size() == values.size(), "constructor");
+						auto oldCount = testee.bucket_count();
+						testee.insert(values.begin(), values.begin() + 1);
+						TestCase::assert(testee.bucket_count() == oldCount, "never shrinks");
+					}),
+
+				TestCase(
+					"shrink_to_fit",
+					[] {
+						UnorderedMapType<Key, T, Hash, Predicate, Allocator> testee;
+						for (int i = 0; i < 1000; ++i) {
+							testee.insert(ValueType(static_cast<Key>(i), static_cast<T>(i)));
+						}
+						for (int i = 10; i < 1000; ++i) {
+							testee.erase(static_cast<Key>(i));
+						}
+						auto oldCount = testee.bucket_count();
+						testee.shrink_to_fit();
+						TestCase::assert(testee.bucket_count() < oldCount, "shrunk");
+						TestCase::assert(testee.load_factor() <= testee.max_load_factor(), "load factor");
+						bool found = testee.size() == 10;
+						for (int i = 0; i < 10; ++i) {
+							found = found && testee.count(static_cast<Key>(i)) == 1;
+						}
+						TestCase::assert(found, "elements");
+					}),
+
 				TestCase(
 					"hash_function",
 					[] {
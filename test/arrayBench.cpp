@@ -0,0 +1,75 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Array.h"
+#include "Polymorphic/Vector.h"
+#include "Testee/BenchSuite.h"
+#include <list>
+#include <numeric>
+#include <string>
+
+namespace {
+
+using Testee::BenchCase;
+using Testee::Stopwatch;
+
+/// Construct count fixed size buffers of n ints as Vector, as done before Array, filling and summing each.
+template<std::size_t n>
+void vector(Stopwatch& stopwatch, std::size_t count)
+{
+	long sum = 0;
+	stopwatch.start();
+	for (std::size_t i = 0; i < count; ++i) {
+		Polymorphic::Vector<int> testee(n);
+		std::iota(testee.begin(), testee.end(), static_cast<int>(i));
+		Testee::escape(testee);
+		sum += std::accumulate(testee.begin(), testee.end(), 0L);
+	}
+	stopwatch.stop();
+	Testee::escape(sum);
+}
+
+/// Construct count fixed size buffers of n ints as Array, filling and summing each.
+template<std::size_t n>
+void array(Stopwatch& stopwatch, std::size_t count)
+{
+	long sum = 0;
+	stopwatch.start();
+	for (std::size_t i = 0; i < count; ++i) {
+		Polymorphic::Array<int, n> testee;
+		std::iota(testee.begin(), testee.end(), static_cast<int>(i));
+		Testee::escape(testee);
+		sum += std::accumulate(testee.begin(), testee.end(), 0L);
+	}
+	stopwatch.stop();
+	Testee::escape(sum);
+}
+
+template<std::size_t n>
+BenchCase benchCase(std::size_t count)
+{
+	return BenchCase(
+		"construct fill sum " + std::to_string(n),
+		count,
+		[count](Stopwatch& stopwatch) { vector<n>(stopwatch, count); },
+		[count](Stopwatch& stopwatch) { array<n>(stopwatch, count); });
+}
+
+} // namespace
+
+int main(int args, char* argv[])
+{
+	// Cases are named by buffer size, times are per buffer.
+	std::list<BenchCase> benchCases;
+	for (std::size_t count : {10000, 1000000}) {
+		benchCases.push_back(benchCase<4>(count));
+		benchCases.push_back(benchCase<64>(count));
+		benchCases.push_back(benchCase<1024>(count));
+	}
+	bool passed = Testee::BenchSuite("fixed size int buffers", "Vector<int>(N)", "Array<int, N>", std::move(benchCases)).run();
+	return passed ? 0 : 1;
+}
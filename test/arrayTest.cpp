@@ -0,0 +1,17 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Array.h"
+#include "Testee/ArrayTestSuite.h"
+#include <iostream>
+
+int main(int args, char* argv[])
+{
+	bool passed = Testee::ArrayTestSuite<std::array, int>("std::array<int, N>").run();
+	passed = Testee::ArrayTestSuite<Polymorphic::Array, int>("Polymorphic::Array<int, N>").run() && passed;
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,15 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Testee/BenchSuiteTestSuite.h"
+#include <iostream>
+
+int main(int args, char* argv[])
+{
+	bool passed = Testee::BenchSuiteTestSuite().run();
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,85 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/BlockDeque.h"
+#include "Testee/DequeBenchSuite.h"
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// Trivially copyable element of Bytes bytes.
+template<std::size_t Bytes>
+struct Padded
+{
+	std::uint32_t bytes[Bytes / sizeof(std::uint32_t)];
+};
+
+} // namespace
+
+namespace Testee {
+
+/// Distinct padded values, every word holding the hashed index.
+template<std::size_t Bytes>
+struct BenchValue<Padded<Bytes>>
+{
+	static Padded<Bytes> make(std::size_t i)
+	{
+		Padded<Bytes> result;
+		std::uint32_t value = BenchValue<std::uint32_t>::make(i);
+		for (auto& word : result.bytes) {
+			word = value;
+		}
+		return result;
+	}
+};
+
+} // namespace Testee
+
+namespace {
+
+/// BlockDeque with recycling enabled from construction.
+template<typename T>
+class RecyclingBlockDeque : public Polymorphic::BlockDeque<T>
+{
+public:
+	RecyclingBlockDeque()
+	{
+		this->set_recycling(true);
+	}
+
+	template<typename InputIterator>
+	RecyclingBlockDeque(InputIterator first, InputIterator last) : Polymorphic::BlockDeque<T>(first, last)
+	{
+		this->set_recycling(true);
+	}
+};
+
+template<typename T>
+bool bench(const std::string& element, const std::vector<std::size_t>& counts)
+{
+	bool passed = Testee::DequeBenchSuite<std::deque<T>, Polymorphic::BlockDeque<T>>(
+					  "BlockDeque<" + element + ">", "std::deque<" + element + ">", "BlockDeque<" + element + ", 4096>", counts)
+					  .run();
+	passed = Testee::DequeBenchSuite<Polymorphic::BlockDeque<T>, RecyclingBlockDeque<T>>(
+				 "BlockDeque<" + element + "> recycling", "freeing blocks", "recycling blocks", counts)
+				 .run() &&
+		passed;
+	return passed;
+}
+
+} // namespace
+
+int main(int args, char* argv[])
+{
+	bool passed = bench<std::uint32_t>("std::uint32_t", {10000, 1000000});
+	passed = bench<Padded<64>>("Padded<64>", {10000, 1000000}) && passed;
+	passed = bench<Padded<1024>>("Padded<1024>", {10000, 50000}) && passed;
+	return passed ? 0 : 1;
+}
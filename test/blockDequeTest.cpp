@@ -0,0 +1,33 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/BlockDeque.h"
+#include "Testee/BlockDequeTestSuite.h"
+#include "Testee/DefaultInitTestSuite.h"
+#include "Testee/DequeTestSuite.h"
+#include <iostream>
+
+template<typename T, typename Allocator = std::allocator<T>>
+using BlockDeque = Polymorphic::BlockDeque<T, 4096, Allocator>;
+
+template<typename T, typename Allocator>
+using SmallBlockDeque = Polymorphic::BlockDeque<T, 64, Allocator>;
+
+template<typename T, typename Allocator>
+using SingleElementBlockDeque = Polymorphic::BlockDeque<T, 1, Allocator>;
+
+int main(int args, char* argv[])
+{
+	bool passed = Testee::DequeTestSuite<BlockDeque, int>("Polymorphic::BlockDeque<int>").run();
+	passed = Testee::DequeTestSuite<SmallBlockDeque, int>("Polymorphic::BlockDeque<int, 64>").run() && passed;
+	passed = Testee::DequeTestSuite<SingleElementBlockDeque, int>("Polymorphic::BlockDeque<int, 1>").run() && passed;
+	passed = Testee::BlockDequeTestSuite<Polymorphic::BlockDeque<int>>("Polymorphic::BlockDeque<int>").run() && passed;
+	passed = Testee::BlockDequeTestSuite<Polymorphic::BlockDeque<int, 64>>("Polymorphic::BlockDeque<int, 64>").run() && passed;
+	passed = Testee::BlockDequeTestSuite<Polymorphic::BlockDeque<int, 1>>("Polymorphic::BlockDeque<int, 1>").run() && passed;
+	passed = Testee::DefaultInitTestSuite<BlockDeque>("Polymorphic::BlockDeque<int>").run() && passed;
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,164 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/List.h"
+#include "Polymorphic/Map.h"
+#include "Polymorphic/Serialization.h"
+#include "Polymorphic/UnorderedMap.h"
+#include "Testee/BenchSuite.h"
+#include <cstdint>
+#include <list>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Testee::BenchCase;
+using Testee::Stopwatch;
+
+typedef std::uint64_t T;
+
+void writeElement(std::ostream& sink, T value)
+{
+	sink.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void writeElement(std::ostream& sink, const std::pair<const T, T>& value)
+{
+	writeElement(sink, value.first);
+	writeElement(sink, value.second);
+}
+
+void readElement(std::istream& source, T& value)
+{
+	source.read(reinterpret_cast<char*>(&value), sizeof(value));
+}
+
+void readElement(std::istream& source, std::pair<T, T>& value)
+{
+	readElement(source, value.first);
+	readElement(source, value.second);
+}
+
+T make(std::size_t i, T*)
+{
+	return Testee::BenchValue<T>::make(i);
+}
+
+std::pair<T, T> make(std::size_t i, std::pair<const T, T>*)
+{
+	return std::pair<T, T>(Testee::BenchValue<T>::make(i), i);
+}
+
+template<typename Container>
+Container container(std::size_t count)
+{
+	Container result;
+	for (std::size_t i = 0; i < count; ++i) {
+		result.insert(result.end(), make(i, static_cast<typename Container::value_type*>(nullptr)));
+	}
+	return result;
+}
+
+/// Write elements one by one, as done before serialize().
+template<typename Container>
+void writeElements(Stopwatch& stopwatch, std::size_t count)
+{
+	const Container testee = container<Container>(count);
+	std::ostringstream sink;
+	stopwatch.start();
+	writeElement(sink, testee.size());
+	for (const auto& element : testee) {
+		writeElement(sink, element);
+	}
+	stopwatch.stop();
+	Testee::escape(sink);
+}
+
+template<typename Container>
+void serialize(Stopwatch& stopwatch, std::size_t count)
+{
+	const Container testee = container<Container>(count);
+	std::ostringstream sink;
+	stopwatch.start();
+	testee.serialize(sink);
+	stopwatch.stop();
+	Testee::escape(sink);
+}
+
+/// Read elements one by one, inserting each at the end, as done before deserialize().
+template<typename Container>
+void readElements(Stopwatch& stopwatch, std::size_t count)
+{
+	std::ostringstream sink;
+	const Container source = container<Container>(count);
+	writeElement(sink, source.size());
+	for (const auto& element : source) {
+		writeElement(sink, element);
+	}
+	std::istringstream stream(sink.str());
+	Container testee;
+	stopwatch.start();
+	T size;
+	readElement(stream, size);
+	for (T i = 0; i < size; ++i) {
+		decltype(make(0, static_cast<typename Container::value_type*>(nullptr))) element;
+		readElement(stream, element);
+		testee.insert(testee.end(), element);
+	}
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+template<typename Container>
+void deserialize(Stopwatch& stopwatch, std::size_t count)
+{
+	std::ostringstream sink;
+	container<Container>(count).serialize(sink);
+	std::istringstream source(sink.str());
+	Container testee;
+	stopwatch.start();
+	testee.deserialize(source);
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+typedef void (*Operation)(Stopwatch&, std::size_t);
+
+BenchCase benchCase(const std::string& name, std::size_t count, Operation reference, Operation candidate)
+{
+	return BenchCase(
+		name,
+		count,
+		[reference, count](Stopwatch& stopwatch) { reference(stopwatch, count); },
+		[candidate, count](Stopwatch& stopwatch) { candidate(stopwatch, count); });
+}
+
+template<typename Container>
+bool bench(const std::string& subject, const std::vector<std::size_t>& counts)
+{
+	std::list<BenchCase> benchCases;
+	for (std::size_t count : counts) {
+		benchCases.push_back(benchCase("serialize", count, &writeElements<Container>, &serialize<Container>));
+		benchCases.push_back(benchCase("deserialize", count, &readElements<Container>, &deserialize<Container>));
+	}
+	return Testee::BenchSuite(subject, "element loop", "chunked", std::move(benchCases)).run();
+}
+
+} // namespace
+
+int main(int args, char* argv[])
+{
+	std::vector<std::size_t> counts{1000, 1000000};
+	bool passed = bench<Polymorphic::List<T>>("List<std::uint64_t> serialization", counts);
+	passed = bench<Polymorphic::Map<T, T>>("Map<std::uint64_t, std::uint64_t> serialization", counts) && passed;
+	passed = bench<Polymorphic::UnorderedMap<T, T>>("UnorderedMap<std::uint64_t, std::uint64_t> serialization", counts) &&
+		passed;
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,97 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+// Translation unit using the specializations of the Polymorphic::Instantiations library, compiled by
+// cmake/CompileBench.cmake with and without extern templates. It is compiled only, never linked.
+
+#include "Polymorphic/Deque.h"
+#include "Polymorphic/ForwardList.h"
+#include "Polymorphic/List.h"
+#include "Polymorphic/Map.h"
+#include "Polymorphic/Set.h"
+#include "Polymorphic/String.h"
+#include "Polymorphic/UnorderedMap.h"
+#include "Polymorphic/UnorderedSet.h"
+#include "Polymorphic/Vector.h"
+#include <string>
+
+namespace {
+
+template<typename Sequence>
+std::size_t useSequence(const typename Sequence::value_type& value)
+{
+	Sequence testee(10, value);
+	testee.push_back(value);
+	testee.insert(testee.begin(), value);
+	testee.erase(testee.begin());
+	testee.resize(20, value);
+	Sequence copy(testee);
+	copy.assign(testee.begin(), testee.end());
+	testee.swap(copy);
+	testee.pop_back();
+	return testee.size() + (testee == copy) + (testee < copy);
+}
+
+template<typename List>
+std::size_t useList(const typename List::value_type& value)
+{
+	List testee(10, value);
+	testee.push_front(value);
+	testee.remove(value);
+	testee.sort();
+	testee.unique();
+	testee.reverse();
+	List copy(testee);
+	testee.merge(copy);
+	return static_cast<std::size_t>(testee == copy);
+}
+
+template<typename Map>
+std::size_t useMap(const typename Map::key_type& key, const typename Map::mapped_type& value)
+{
+	Map testee;
+	testee.emplace(key, value);
+	testee[key] = value;
+	testee.insert(typename Map::value_type(key, value));
+	Map copy(testee);
+	std::size_t result = testee.count(key) + (testee.find(key) != testee.end()) + testee.at(key).size();
+	testee.erase(key);
+	testee.swap(copy);
+	return result + testee.size() + (testee == copy);
+}
+
+template<typename Set>
+std::size_t useSet(const typename Set::value_type& value)
+{
+	Set testee;
+	testee.insert(value);
+	testee.emplace(value);
+	Set copy(testee);
+	std::size_t result = testee.count(value) + (testee.find(value) != testee.end());
+	testee.erase(value);
+	return result + testee.size() + (testee == copy);
+}
+
+} // namespace
+
+std::size_t compileBench()
+{
+	const std::string text("text");
+	std::size_t result = useSequence<Polymorphic::Vector<int>>(1) + useSequence<Polymorphic::Vector<long>>(1) +
+		useSequence<Polymorphic::Vector<double>>(1) + useSequence<Polymorphic::Vector<std::string>>(text) +
+		useSequence<Polymorphic::Deque<int>>(1) + useSequence<Polymorphic::Deque<std::string>>(text);
+	result += useList<Polymorphic::List<int>>(1) + useList<Polymorphic::List<std::string>>(text) +
+		useList<Polymorphic::ForwardList<int>>(1) + useList<Polymorphic::ForwardList<std::string>>(text);
+	result += useMap<Polymorphic::Map<std::string, std::string>>(text, text) +
+		useMap<Polymorphic::UnorderedMap<std::string, std::string>>(text, text);
+	result += useSet<Polymorphic::Set<int>>(1) + useSet<Polymorphic::Set<std::string>>(text) +
+		useSet<Polymorphic::UnorderedSet<int>>(1) + useSet<Polymorphic::UnorderedSet<std::string>>(text);
+	Polymorphic::String string(text);
+	string.append(text);
+	string.insert(0, text);
+	return result + string.find(text) + string.size();
+}
@@ -0,0 +1,107 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Deque.h"
+#include "Polymorphic/ForwardList.h"
+#include "Polymorphic/List.h"
+#include "Polymorphic/Map.h"
+#include "Polymorphic/Multimap.h"
+#include "Polymorphic/Multiset.h"
+#include "Polymorphic/Set.h"
+#include "Polymorphic/UnorderedMap.h"
+#include "Polymorphic/UnorderedMultimap.h"
+#include "Polymorphic/UnorderedMultiset.h"
+#include "Polymorphic/UnorderedSet.h"
+#include "Polymorphic/Vector.h"
+#include "Testee/ForwardListBenchSuite.h"
+#include "Testee/ListBenchSuite.h"
+#include "Testee/MapBenchSuite.h"
+#include "Testee/MultimapBenchSuite.h"
+#include "Testee/SequenceBenchSuite.h"
+#include "Testee/SetBenchSuite.h"
+#include <deque>
+#include <forward_list>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+int main(int args, char* argv[])
+{
+	std::vector<std::size_t> counts{1000, 100000};
+	bool passed = Testee::SequenceBenchSuite<std::vector, Polymorphic::Vector, int>(
+					  "Vector<int>", "std::vector", "Polymorphic::Vector", counts)
+					  .run();
+	passed = Testee::SequenceBenchSuite<std::vector, Polymorphic::Vector, std::string>(
+				 "Vector<std::string>", "std::vector", "Polymorphic::Vector", counts)
+				 .run() &&
+		passed;
+	passed =
+		Testee::SequenceBenchSuite<std::deque, Polymorphic::Deque, int>("Deque<int>", "std::deque", "Polymorphic::Deque", counts)
+			.run() &&
+		passed;
+	passed = Testee::MapBenchSuite<std::map, Polymorphic::Map, int, int>("Map<int, int>", "std::map", "Polymorphic::Map", counts)
+				 .run() &&
+		passed;
+	passed = Testee::MapBenchSuite<std::map, Polymorphic::Map, std::string, int>(
+				 "Map<std::string, int>", "std::map", "Polymorphic::Map", counts)
+				 .run() &&
+		passed;
+	passed = Testee::MapBenchSuite<std::unordered_map, Polymorphic::UnorderedMap, int, int>(
+				 "UnorderedMap<int, int>", "std::unordered_map", "Polymorphic::UnorderedMap", counts)
+				 .run() &&
+		passed;
+	passed = Testee::MapBenchSuite<std::unordered_map, Polymorphic::UnorderedMap, std::string, int>(
+				 "UnorderedMap<std::string, int>", "std::unordered_map", "Polymorphic::UnorderedMap", counts)
+				 .run() &&
+		passed;
+	passed =
+		Testee::ListBenchSuite<std::list, Polymorphic::List, int>("List<int>", "std::list", "Polymorphic::List", counts).run() &&
+		passed;
+	passed = Testee::ListBenchSuite<std::list, Polymorphic::List, std::string>(
+				 "List<std::string>", "std::list", "Polymorphic::List", counts)
+				 .run() &&
+		passed;
+	passed = Testee::ForwardListBenchSuite<std::forward_list<int>, Polymorphic::ForwardList<int>>(
+				 "ForwardList<int>", "std::forward_list", "Polymorphic::ForwardList", counts)
+				 .run() &&
+		passed;
+	passed = Testee::SetBenchSuite<std::set, Polymorphic::Set, int>("Set<int>", "std::set", "Polymorphic::Set", counts).run() &&
+		passed;
+	passed = Testee::SetBenchSuite<std::set, Polymorphic::Set, std::string>(
+				 "Set<std::string>", "std::set", "Polymorphic::Set", counts)
+				 .run() &&
+		passed;
+	passed = Testee::SetBenchSuite<std::multiset, Polymorphic::Multiset, int>(
+				 "Multiset<int>", "std::multiset", "Polymorphic::Multiset", counts)
+				 .run() &&
+		passed;
+	passed = Testee::SetBenchSuite<std::unordered_set, Polymorphic::UnorderedSet, int>(
+				 "UnorderedSet<int>", "std::unordered_set", "Polymorphic::UnorderedSet", counts)
+				 .run() &&
+		passed;
+	passed = Testee::SetBenchSuite<std::unordered_set, Polymorphic::UnorderedSet, std::string>(
+				 "UnorderedSet<std::string>", "std::unordered_set", "Polymorphic::UnorderedSet", counts)
+				 .run() &&
+		passed;
+	passed = Testee::SetBenchSuite<std::unordered_multiset, Polymorphic::UnorderedMultiset, int>(
+				 "UnorderedMultiset<int>", "std::unordered_multiset", "Polymorphic::UnorderedMultiset", counts)
+				 .run() &&
+		passed;
+	passed = Testee::MultimapBenchSuite<std::multimap, Polymorphic::Multimap, int, int>(
+				 "Multimap<int, int>", "std::multimap", "Polymorphic::Multimap", counts)
+				 .run() &&
+		passed;
+	passed = Testee::MultimapBenchSuite<std::unordered_multimap, Polymorphic::UnorderedMultimap, int, int>(
+				 "UnorderedMultimap<int, int>", "std::unordered_multimap", "Polymorphic::UnorderedMultimap", counts)
+				 .run() &&
+		passed;
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,76 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/DefaultInitAllocator.h"
+#include "Polymorphic/Vector.h"
+#include "Testee/BenchSuite.h"
+#include <cstdint>
+#include <list>
+#include <string>
+
+namespace {
+
+using Testee::BenchCase;
+using Testee::Stopwatch;
+
+/// Write element i of [data, data + n), standing in for a read() or a compute kernel.
+template<typename T>
+std::size_t overwrite(T* data, std::size_t n)
+{
+	for (std::size_t i = 0; i < n; ++i) {
+		data[i] = static_cast<T>(i);
+	}
+	return n;
+}
+
+/// Resize to count value initialized elements, then overwrite them, as done before resize_and_overwrite().
+template<typename T>
+void resize(Stopwatch& stopwatch, std::size_t count)
+{
+	stopwatch.start();
+	Polymorphic::Vector<T> testee;
+	testee.resize(count);
+	overwrite(testee.data(), testee.size());
+	Testee::escape(testee);
+	stopwatch.stop();
+}
+
+/// Resize to count uninitialized elements while overwriting them.
+template<typename T>
+void resizeAndOverwrite(Stopwatch& stopwatch, std::size_t count)
+{
+	stopwatch.start();
+	Polymorphic::Vector<T, Polymorphic::DefaultInitAllocator<T>> testee;
+	testee.resize_and_overwrite(count, &overwrite<T>);
+	Testee::escape(testee);
+	stopwatch.stop();
+}
+
+template<typename T>
+bool bench(const std::string& subject)
+{
+	// Counts of elements of 1 MiB, 64 MiB and 512 MiB buffers.
+	std::list<BenchCase> benchCases;
+	for (std::size_t bytes : {std::size_t(1) << 20, std::size_t(64) << 20, std::size_t(512) << 20}) {
+		std::size_t count = bytes / sizeof(T);
+		benchCases.push_back(BenchCase(
+			"fill " + std::to_string(bytes >> 20) + " MiB",
+			count,
+			[count](Stopwatch& stopwatch) { resize<T>(stopwatch, count); },
+			[count](Stopwatch& stopwatch) { resizeAndOverwrite<T>(stopwatch, count); }));
+	}
+	return Testee::BenchSuite(subject, "resize then overwrite", "resize_and_overwrite", std::move(benchCases)).run();
+}
+
+} // namespace
+
+int main(int args, char* argv[])
+{
+	bool passed = bench<std::uint8_t>("Vector<std::uint8_t> buffer");
+	passed = bench<double>("Vector<double> buffer") && passed;
+	return passed ? 0 : 1;
+}
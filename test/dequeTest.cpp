@@ -7,9 +7,19 @@
 
 #include "Polymorphic/Deque.h"
 #include "Testee/DequeTestSuite.h"
+#include "Testee/DefaultInitTestSuite.h"
+#include "Testee/ParallelSequenceTestSuite.h"
+#include "Testee/RelocationTestSuite.h"
+#include "Testee/SerializationTestSuite.h"
 #include <iostream>
 
 int main(int args, char* argv[])
 {
-	return Testee::DequeTestSuite<Polymorphic::Deque, int>("Polymorphic::Deque<int>").run() ? 0 : 1;
+	bool failed = false;
+	failed = !Testee::DequeTestSuite<Polymorphic::Deque, int>("Polymorphic::Deque<int>").run() || failed;
+	failed = !Testee::ParallelSequenceTestSuite<Polymorphic::Deque>("Polymorphic::Deque<int>").run() || failed;
+	failed = !Testee::SerializationTestSuite<Polymorphic::Deque>("Polymorphic::Deque<Point>").run() || failed;
+	failed = !Testee::DefaultInitTestSuite<Polymorphic::Deque>("Polymorphic::Deque<int>").run() || failed;
+	failed = !Testee::RelocationTestSuite<Polymorphic::Deque>("Polymorphic::Deque").run() || failed;
+	return failed ? 1 : 0;
 }
@@ -0,0 +1,27 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/CountedForwardList.h"
+#include "Polymorphic/ForwardList.h"
+#include "Testee/ForwardListBenchSuite.h"
+#include <string>
+#include <vector>
+
+int main(int args, char* argv[])
+{
+	using Polymorphic::CountedForwardList;
+	using Polymorphic::ForwardList;
+	std::vector<std::size_t> counts{1000, 1000000};
+	bool passed = Testee::ForwardListBenchSuite<ForwardList<int>, CountedForwardList<int>>(
+					  "CountedForwardList<int>", "ForwardList<int>", "CountedForwardList<int>", counts)
+					  .run();
+	passed = Testee::ForwardListBenchSuite<ForwardList<std::string>, CountedForwardList<std::string>>(
+				 "CountedForwardList<std::string>", "ForwardList<std::string>", "CountedForwardList<std::string>", counts)
+				 .run() &&
+		passed;
+	return passed ? 0 : 1;
+}
@@ -5,11 +5,36 @@
 //
 
 
+#include "Polymorphic/CountedForwardList.h"
 #include "Polymorphic/ForwardList.h"
+#include "Testee/ChunkedSerializationTestSuite.h"
 #include "Testee/ForwardListTestSuite.h"
+#include "Testee/SortTestSuite.h"
 #include <iostream>
+#include <string>
+#include <vector>
 
 int main(int args, char* argv[])
 {
-	return Testee::ForwardListTestSuite<Polymorphic::ForwardList, int>("Polymorphic::ForwardList<int>").run() ? 0 : 1;
+	bool passed = Testee::ForwardListTestSuite<Polymorphic::ForwardList, int>("Polymorphic::ForwardList<int>").run();
+	passed = Testee::SortTestSuite<Polymorphic::ForwardList>("Polymorphic::ForwardList<std::pair<int, int>>").run() && passed;
+	std::vector<int> values;
+	for (int i = 0; i < 100000; ++i) {
+		values.push_back(i * 7);
+	}
+	passed = Testee::ChunkedSerializationTestSuite<Polymorphic::ForwardList<int>>("Polymorphic::ForwardList<int>", values)
+				 .run() &&
+		passed;
+	passed = Testee::ForwardListTestSuite<Polymorphic::CountedForwardList, int>("Polymorphic::CountedForwardList<int>").run() &&
+		passed;
+	passed = Testee::CountedForwardListTestSuite<Polymorphic::CountedForwardList>("Polymorphic::CountedForwardList<int>").run() &&
+		passed;
+	passed =
+		Testee::SortTestSuite<Polymorphic::CountedForwardList>("Polymorphic::CountedForwardList<std::pair<int, int>>").run() &&
+		passed;
+	passed = Testee::ChunkedSerializationTestSuite<Polymorphic::CountedForwardList<int>>(
+				 "Polymorphic::CountedForwardList<int>", values)
+				 .run() &&
+		passed;
+	return passed ? 0 : 1;
 }
@@ -0,0 +1,125 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Hash.h"
+#include "Polymorphic/UnorderedMap.h"
+#include "Testee/BenchSuite.h"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Testee::BenchCase;
+using Testee::Stopwatch;
+
+/// Keys 0, stride, 2 * stride and so on, in ascending order or shuffled.
+std::vector<std::uint64_t> makeIntegers(std::size_t count, std::uint64_t stride, bool shuffled)
+{
+	std::vector<std::uint64_t> keys;
+	keys.reserve(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		keys.push_back(i * stride);
+	}
+	if (shuffled) {
+		std::shuffle(keys.begin(), keys.end(), std::mt19937_64(count));
+	}
+	return keys;
+}
+
+/// Distinct keys of bytes characters each, differing in their leading digits.
+std::vector<std::string> makeStrings(std::size_t count, std::size_t bytes)
+{
+	std::vector<std::string> keys;
+	keys.reserve(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		std::string key(bytes, 'x');
+		std::string digits = std::to_string(i);
+		key.replace(0, digits.size(), digits);
+		keys.push_back(std::move(key));
+	}
+	return keys;
+}
+
+/// Find all keys in a map of them.
+template<typename Key, typename Hash>
+void find(Stopwatch& stopwatch, const std::vector<Key>& keys)
+{
+	Polymorphic::UnorderedMap<Key, std::size_t, Hash> testee;
+	testee.reserve(keys.size());
+	for (std::size_t i = 0; i < keys.size(); ++i) {
+		testee.emplace(keys[i], i);
+	}
+	std::size_t sum = 0;
+	stopwatch.start();
+	for (const Key& key : keys) {
+		sum += testee.find(key)->second;
+	}
+	stopwatch.stop();
+	Testee::escape(sum);
+}
+
+/// Hash all keys.
+template<typename Key, typename Hash>
+void hash(Stopwatch& stopwatch, const std::vector<Key>& keys)
+{
+	Hash hasher;
+	std::size_t sum = 0;
+	stopwatch.start();
+	for (const Key& key : keys) {
+		sum += hasher(key);
+	}
+	stopwatch.stop();
+	Testee::escape(sum);
+}
+
+/// Case running reference and candidate on keys, which both copy.
+template<typename Key>
+BenchCase benchCase(
+	const std::string& name,
+	const std::vector<Key>& keys,
+	void (*reference)(Stopwatch&, const std::vector<Key>&),
+	void (*candidate)(Stopwatch&, const std::vector<Key>&))
+{
+	return BenchCase(
+		name,
+		keys.size(),
+		[keys, reference](Stopwatch& stopwatch) { reference(stopwatch, keys); },
+		[keys, candidate](Stopwatch& stopwatch) { candidate(stopwatch, keys); });
+}
+
+} // namespace
+
+int main(int args, char* argv[])
+{
+	typedef std::uint64_t Integer;
+	typedef std::string String;
+	std::list<BenchCase> benchCases;
+	for (bool shuffled : {false, true}) {
+		for (std::uint64_t stride : {1, 4096}) {
+			benchCases.push_back(benchCase(
+				std::string(shuffled ? "shuffled" : "find") + " uint64 stride " + std::to_string(stride),
+				makeIntegers(1000000, stride, shuffled),
+				&find<Integer, std::hash<Integer>>,
+				&find<Integer, Polymorphic::Hash<Integer>>));
+		}
+	}
+	for (std::size_t bytes : {16, 64, 256, 1024}) {
+		std::vector<String> keys = makeStrings(20000, bytes);
+		std::string suffix = " " + std::to_string(bytes) + " B string";
+		benchCases.push_back(
+			benchCase("find" + suffix, keys, &find<String, std::hash<String>>, &find<String, Polymorphic::Hash<String>>));
+		benchCases.push_back(
+			benchCase("hash" + suffix, keys, &hash<String, std::hash<String>>, &hash<String, Polymorphic::Hash<String>>));
+	}
+	bool passed = Testee::BenchSuite("UnorderedMap keys", "std::hash", "Polymorphic::Hash", std::move(benchCases)).run();
+	return passed ? 0 : 1;
+}
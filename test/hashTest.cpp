@@ -0,0 +1,16 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Hash.h"
+#include "Testee/HashTestSuite.h"
+#include <iostream>
+
+int main(int args, char* argv[])
+{
+	bool passed = Testee::HashTestSuite().run();
+	return passed ? 0 : 1;
+}
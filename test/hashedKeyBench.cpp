@@ -0,0 +1,149 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/UnorderedMap.h"
+#include "Testee/BenchSuite.h"
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Testee::BenchCase;
+using Testee::Stopwatch;
+
+typedef Polymorphic::UnorderedMap<std::string, int> Plain;
+typedef Polymorphic::CachedHashUnorderedMap<std::string, int> Cached;
+
+/// Distinct keys of bytes characters each, differing in their leading digits.
+std::vector<std::string> makeKeys(std::size_t count, std::size_t bytes)
+{
+	std::vector<std::string> keys;
+	keys.reserve(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		std::string key(bytes, 'x');
+		std::string digits = std::to_string(i);
+		key.replace(0, digits.size(), digits);
+		keys.push_back(std::move(key));
+	}
+	return keys;
+}
+
+/// Hash codes of keys, computed upstream of the map, e.g. by a request router.
+std::vector<std::size_t> makeHashes(const std::vector<std::string>& keys)
+{
+	std::vector<std::size_t> hashes;
+	hashes.reserve(keys.size());
+	for (const std::string& key : keys) {
+		hashes.push_back(std::hash<std::string>()(key));
+	}
+	return hashes;
+}
+
+/// Emplace all keys, hashing each.
+void emplace(Stopwatch& stopwatch, const std::vector<std::string>& keys, const std::vector<std::size_t>&)
+{
+	Plain testee;
+	stopwatch.start();
+	for (std::size_t i = 0; i < keys.size(); ++i) {
+		testee.emplace(keys[i], static_cast<int>(i));
+	}
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+/// Emplace all keys by their precomputed hash codes.
+void emplaceHashed(Stopwatch& stopwatch, const std::vector<std::string>& keys, const std::vector<std::size_t>& hashes)
+{
+	Cached testee;
+	stopwatch.start();
+	for (std::size_t i = 0; i < keys.size(); ++i) {
+		testee.emplace_hashed(keys[i], hashes[i], static_cast<int>(i));
+	}
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+/// Find all keys, hashing each.
+void find(Stopwatch& stopwatch, const std::vector<std::string>& keys, const std::vector<std::size_t>&)
+{
+	Plain testee;
+	for (std::size_t i = 0; i < keys.size(); ++i) {
+		testee.emplace(keys[i], static_cast<int>(i));
+	}
+	long sum = 0;
+	stopwatch.start();
+	for (const std::string& key : keys) {
+		sum += testee.find(key)->second;
+	}
+	stopwatch.stop();
+	Testee::escape(sum);
+}
+
+/// Find all keys by their precomputed hash codes.
+void findHashed(Stopwatch& stopwatch, const std::vector<std::string>& keys, const std::vector<std::size_t>& hashes)
+{
+	Cached testee;
+	for (std::size_t i = 0; i < keys.size(); ++i) {
+		testee.emplace_hashed(keys[i], hashes[i], static_cast<int>(i));
+	}
+	long sum = 0;
+	stopwatch.start();
+	for (std::size_t i = 0; i < keys.size(); ++i) {
+		sum += testee.find(keys[i], hashes[i])->second;
+	}
+	stopwatch.stop();
+	Testee::escape(sum);
+}
+
+/// Rehash a map of all keys to four times its buckets.
+template<typename Map>
+void rehash(Stopwatch& stopwatch, const std::vector<std::string>& keys, const std::vector<std::size_t>& hashes)
+{
+	Map testee;
+	for (std::size_t i = 0; i < keys.size(); ++i) {
+		testee.emplace_hashed(keys[i], hashes[i], static_cast<int>(i));
+	}
+	stopwatch.start();
+	testee.rehash(testee.bucket_count() * 4);
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+typedef void (*Operation)(Stopwatch&, const std::vector<std::string>&, const std::vector<std::size_t>&);
+
+BenchCase benchCase(const std::string& name, std::size_t bytes, Operation reference, Operation candidate)
+{
+	std::size_t count = 20000;
+	std::vector<std::string> keys = makeKeys(count, bytes);
+	std::vector<std::size_t> hashes = makeHashes(keys);
+	return BenchCase(
+		name + " " + std::to_string(bytes) + " B keys",
+		count,
+		[reference, keys, hashes](Stopwatch& stopwatch) { reference(stopwatch, keys, hashes); },
+		[candidate, keys, hashes](Stopwatch& stopwatch) { candidate(stopwatch, keys, hashes); });
+}
+
+} // namespace
+
+int main(int args, char* argv[])
+{
+	std::list<BenchCase> benchCases;
+	for (std::size_t bytes : {64, 256, 1024, 4096}) {
+		benchCases.push_back(benchCase("emplace", bytes, &emplace, &emplaceHashed));
+		benchCases.push_back(benchCase("find", bytes, &find, &findHashed));
+		benchCases.push_back(benchCase("rehash", bytes, &rehash<Plain>, &rehash<Cached>));
+	}
+	bool passed = Testee::BenchSuite(
+					  "string keyed maps",
+					  "UnorderedMap<std::string, int>",
+					  "CachedHashUnorderedMap<std::string, int>",
+					  std::move(benchCases))
+					  .run();
+	return passed ? 0 : 1;
+}
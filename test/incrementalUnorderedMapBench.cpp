@@ -0,0 +1,28 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/IncrementalUnorderedMap.h"
+#include "Polymorphic/UnorderedMap.h"
+#include "Testee/MapLatencyBenchSuite.h"
+#include <cstdint>
+#include <vector>
+
+int main(int args, char* argv[])
+{
+	std::vector<std::size_t> counts{1000000, 4000000};
+	bool passed = Testee::MapLatencyBenchSuite<
+					  Polymorphic::UnorderedMap,
+					  Polymorphic::IncrementalUnorderedMap,
+					  std::uint32_t,
+					  std::uint32_t>(
+					  "IncrementalUnorderedMap<uint32_t, uint32_t>",
+					  "Polymorphic::UnorderedMap",
+					  "Polymorphic::IncrementalUnorderedMap",
+					  counts)
+					  .run();
+	return passed ? 0 : 1;
+}
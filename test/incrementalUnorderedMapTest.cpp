@@ -0,0 +1,27 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/IncrementalUnorderedMap.h"
+#include "Testee/ChunkedSerializationTestSuite.h"
+#include "Testee/IncrementalUnorderedMapTestSuite.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int args, char* argv[])
+{
+	bool passed = Testee::IncrementalUnorderedMapTestSuite().run();
+	std::vector<std::pair<const int, std::string>> values;
+	for (int i = 0; i < 1000; ++i) {
+		values.emplace_back(i, std::to_string(i));
+	}
+	passed = Testee::ChunkedSerializationTestSuite<Polymorphic::IncrementalUnorderedMap<int, std::string>>(
+				 "Polymorphic::IncrementalUnorderedMap<int, std::string>", values)
+				 .run() &&
+		passed;
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,87 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Execution.h"
+#include "Polymorphic/ForwardList.h"
+#include "Polymorphic/List.h"
+#include "Testee/BenchSuite.h"
+#include <list>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Testee::BenchCase;
+using Testee::Stopwatch;
+
+template<typename List>
+List scattered(std::size_t count)
+{
+	List result;
+	for (std::size_t i = 0; i < count; ++i) {
+		result.push_front(Testee::BenchValue<typename List::value_type>::make(i));
+	}
+	return result;
+}
+
+/// Merge sort of the std delegate.
+template<typename List>
+void sort(Stopwatch& stopwatch, std::size_t count)
+{
+	List testee = scattered<List>(count);
+	stopwatch.start();
+	testee.sort();
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+/// Sort gathering nodes into a contiguous buffer, sorted per policy.
+template<typename List, typename Policy>
+void sortPer(const Policy& policy, Stopwatch& stopwatch, std::size_t count)
+{
+	List testee = scattered<List>(count);
+	stopwatch.start();
+	testee.sort(policy);
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+/// Suites timing sort() against sort(seq) and sort(par).
+template<typename List>
+bool bench(const std::string& subject, const std::vector<std::size_t>& counts)
+{
+	std::list<BenchCase> sequential;
+	std::list<BenchCase> parallel;
+	for (std::size_t count : counts) {
+		sequential.push_back(BenchCase(
+			"sort",
+			count,
+			[count](Stopwatch& stopwatch) { sort<List>(stopwatch, count); },
+			[count](Stopwatch& stopwatch) { sortPer<List>(Polymorphic::execution::seq, stopwatch, count); }));
+		parallel.push_back(BenchCase(
+			"sort",
+			count,
+			[count](Stopwatch& stopwatch) { sort<List>(stopwatch, count); },
+			[count](Stopwatch& stopwatch) { sortPer<List>(Polymorphic::execution::par, stopwatch, count); }));
+	}
+	bool passed = Testee::BenchSuite(subject, "sort()", "sort(seq)", std::move(sequential)).run();
+	return Testee::BenchSuite(subject, "sort()", "sort(par)", std::move(parallel)).run() && passed;
+}
+
+} // namespace
+
+int main(int args, char* argv[])
+{
+	using Polymorphic::ForwardList;
+	using Polymorphic::List;
+	std::vector<std::size_t> counts{10000, 1000000};
+	bool passed = bench<List<int>>("List<int>", counts);
+	passed = bench<List<std::string>>("List<std::string>", counts) && passed;
+	passed = bench<ForwardList<int>>("ForwardList<int>", counts) && passed;
+	passed = bench<ForwardList<std::string>>("ForwardList<std::string>", counts) && passed;
+	return passed ? 0 : 1;
+}
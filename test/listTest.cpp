@@ -6,10 +6,23 @@
 
 
 #include "Polymorphic/List.h"
+#include "Testee/ChunkedSerializationTestSuite.h"
 #include "Testee/ListTestSuite.h"
+#include "Testee/SortTestSuite.h"
 #include <iostream>
+#include <string>
+#include <vector>
 
 int main(int args, char* argv[])
 {
-	return Testee::ListTestSuite<Polymorphic::List, int>("Polymorphic::List<int>").run() ? 0 : 1;
+	bool passed = Testee::ListTestSuite<Polymorphic::List, int>("Polymorphic::List<int>").run();
+	passed = Testee::SortTestSuite<Polymorphic::List>("Polymorphic::List<std::pair<int, int>>").run() && passed;
+	std::vector<std::string> values;
+	for (int i = 0; i < 1000; ++i) {
+		values.push_back(std::string(i % 50, 'x'));
+	}
+	passed = Testee::ChunkedSerializationTestSuite<Polymorphic::List<std::string>>("Polymorphic::List<std::string>", values)
+				 .run() &&
+		passed;
+	return passed ? 0 : 1;
 }
@@ -0,0 +1,160 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/List.h"
+#include "Polymorphic/LruCache.h"
+#include "Polymorphic/UnorderedMap.h"
+#include "Testee/BenchSuite.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+typedef std::uint64_t Key;
+typedef std::uint64_t Value;
+
+/// Keys 0 to keys - 1 drawn with probability proportional to 1 / (rank + 1)^exponent, from a fixed seed.
+std::vector<Key> zipfian(std::size_t count, std::size_t keys, double exponent)
+{
+	std::vector<double> cumulative(keys);
+	double sum = 0;
+	for (std::size_t i = 0; i < keys; ++i) {
+		sum += 1 / std::pow(static_cast<double>(i + 1), exponent);
+		cumulative[i] = sum;
+	}
+	std::mt19937_64 engine(42);
+	std::uniform_real_distribution<double> uniform(0, sum);
+	std::vector<Key> result;
+	result.reserve(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		auto found = std::lower_bound(cumulative.begin(), cumulative.end(), uniform(engine));
+		// Scatter ranks, so that hot keys do not share their low bits.
+		Key rank = static_cast<Key>(std::min<std::ptrdiff_t>(found - cumulative.begin(), keys - 1));
+		result.push_back(rank * 0x9e3779b97f4a7c15ULL);
+	}
+	return result;
+}
+
+/// LRU cache as built by hand before LruCache, from an UnorderedMap indexing a List in recency order.
+class HandBuiltCache
+{
+public:
+	explicit HandBuiltCache(std::size_t capacity) : capacity(capacity)
+	{
+	}
+
+	const Value* get(Key key)
+	{
+		auto found = index.find(key);
+		if (found == index.end()) {
+			return nullptr;
+		}
+		entries.splice(entries.begin(), entries, found->second);
+		return &found->second->second;
+	}
+
+	void put(Key key, Value value)
+	{
+		entries.emplace_front(key, value);
+		index.emplace(key, entries.begin());
+		if (entries.size() > capacity) {
+			index.erase(entries.back().first);
+			entries.pop_back();
+		}
+	}
+
+private:
+	typedef Polymorphic::List<std::pair<Key, Value>> Entries;
+
+	std::size_t capacity;
+	Entries entries;
+	Polymorphic::UnorderedMap<Key, Entries::iterator> index;
+};
+
+/// Look up each key, inserting it on a miss, as a read through cache does.
+void handBuilt(Testee::Stopwatch& stopwatch, const std::vector<Key>& keys, std::size_t capacity)
+{
+	HandBuiltCache cache(capacity);
+	stopwatch.start();
+	for (Key key : keys) {
+		const Value* found = cache.get(key);
+		if (found == nullptr) {
+			cache.put(key, key);
+		} else {
+			Testee::escape(*found);
+		}
+	}
+	stopwatch.stop();
+}
+
+void lruCache(Testee::Stopwatch& stopwatch, const std::vector<Key>& keys, std::size_t capacity)
+{
+	Polymorphic::LruCache<Key, Value> cache(capacity);
+	stopwatch.start();
+	for (Key key : keys) {
+		auto found = cache.find(key);
+		if (found == cache.end()) {
+			cache.emplace(key, key);
+		} else {
+			Testee::escape(found->second);
+		}
+	}
+	stopwatch.stop();
+}
+
+} // namespace
+
+int main(int args, char* argv[])
+{
+	using Testee::BenchCase;
+	using Testee::Stopwatch;
+	const std::size_t keyCount = 1000000;
+	// Cases are named by Zipf exponent, capacity in percent of the key count and resulting hit ratio.
+	std::list<BenchCase> benchCases;
+	for (std::size_t count : {100000, 1000000}) {
+		for (double exponent : {0.8, 0.99}) {
+			auto keys = std::make_shared<std::vector<Key>>(zipfian(count, keyCount, exponent));
+			for (std::size_t capacity : {keyCount / 100, keyCount / 10}) {
+				Polymorphic::LruCache<Key, Value> cache(capacity);
+				for (Key key : *keys) {
+					if (cache.find(key) == cache.end()) {
+						cache.emplace(key, key);
+					}
+				}
+				char name[64];
+				std::snprintf(
+					name,
+					sizeof(name),
+					"s=%.2f %zu%% hit %.0f%%",
+					exponent,
+					100 * capacity / keyCount,
+					100.0 * cache.statistics().hits / count);
+				benchCases.push_back(BenchCase(
+					name,
+					count,
+					[keys, capacity](Stopwatch& stopwatch) { handBuilt(stopwatch, *keys, capacity); },
+					[keys, capacity](Stopwatch& stopwatch) { lruCache(stopwatch, *keys, capacity); }));
+			}
+		}
+	}
+	bool passed = Testee::BenchSuite(
+					  "LruCache<std::uint64_t, std::uint64_t>",
+					  "UnorderedMap and List by hand",
+					  "LruCache",
+					  std::move(benchCases))
+					  .run();
+	return passed ? 0 : 1;
+}
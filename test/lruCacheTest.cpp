@@ -0,0 +1,19 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/LruCache.h"
+#include "Testee/LruCacheTestSuite.h"
+#include <iostream>
+
+int main(int args, char* argv[])
+{
+	bool passed = Testee::LruCacheTestSuite<Polymorphic::LruCache, int, int>("Polymorphic::LruCache<int, int>").run();
+	passed = Testee::ShardedLruCacheTestSuite<Polymorphic::ShardedLruCache, int, int>("Polymorphic::ShardedLruCache<int, int>")
+				 .run() &&
+		passed;
+	return passed ? 0 : 1;
+}
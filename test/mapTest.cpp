@@ -6,10 +6,22 @@
 
 
 #include "Polymorphic/Map.h"
+#include "Testee/ChunkedSerializationTestSuite.h"
 #include "Testee/MapTestSuite.h"
 #include <iostream>
+#include <string>
+#include <vector>
 
 int main(int args, char* argv[])
 {
-	return Testee::MapTestSuite<Polymorphic::Map, int, int>("Polymorphic::Map<int, int>").run() ? 0 : 1;
+	bool passed = Testee::MapTestSuite<Polymorphic::Map, int, int>("Polymorphic::Map<int, int>").run();
+	std::vector<std::pair<const std::string, int>> values;
+	for (int i = 0; i < 1000; ++i) {
+		values.emplace_back(std::to_string(i), i);
+	}
+	passed = Testee::ChunkedSerializationTestSuite<Polymorphic::Map<std::string, int>>(
+				 "Polymorphic::Map<std::string, int>", values)
+				 .run() &&
+		passed;
+	return passed ? 0 : 1;
 }
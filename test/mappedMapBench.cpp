@@ -0,0 +1,156 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Map.h"
+#include "Polymorphic/MappedMap.h"
+#include "Polymorphic/Serialization.h"
+#include "Testee/BenchSuite.h"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Testee::BenchCase;
+using Testee::Stopwatch;
+
+typedef std::uint64_t Key;
+typedef std::uint64_t Value;
+typedef Polymorphic::Map<Key, Value> HeapMap;
+typedef Polymorphic::MappedMap<Key, Value> MappedMap;
+
+/// Key of entry i, scattered over the key space.
+Key key(std::size_t i)
+{
+	return i * 0x9e3779b97f4a7c15ULL;
+}
+
+/// Chunked stream of a Map, and sorted run image of a MappedMap, of the same count entries in the working directory,
+/// removed on destruction.
+class ImageFiles
+{
+public:
+	explicit ImageFiles(std::size_t count) :
+		streamPath("mappedMapBench" + std::to_string(count) + ".stream"),
+		imagePath("mappedMapBench" + std::to_string(count) + ".image")
+	{
+		HeapMap source;
+		for (std::size_t i = 0; i < count; ++i) {
+			source.emplace(key(i), i);
+		}
+		std::ofstream stream(streamPath, std::ios::binary | std::ios::trunc);
+		source.serialize(stream);
+		MappedMap::build(imagePath, source.begin(), source.end());
+	}
+
+	~ImageFiles()
+	{
+		std::remove(streamPath.c_str());
+		std::remove(imagePath.c_str());
+	}
+
+	const std::string streamPath;
+	const std::string imagePath;
+};
+
+void load(Stopwatch& stopwatch, const ImageFiles& files)
+{
+	stopwatch.start();
+	std::ifstream stream(files.streamPath, std::ios::binary);
+	HeapMap testee;
+	testee.deserialize(stream);
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+void open(Stopwatch& stopwatch, const ImageFiles& files)
+{
+	stopwatch.start();
+	MappedMap testee(files.imagePath);
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+/// Look up keys, about half of them present, in testee.
+template<typename Map>
+void find(Stopwatch& stopwatch, const Map& testee, const std::vector<Key>& keys)
+{
+	Value sum = 0;
+	stopwatch.start();
+	for (Key k : keys) {
+		auto found = testee.find(k);
+		if (found != testee.end()) {
+			sum += found->second;
+		}
+	}
+	stopwatch.stop();
+	Testee::escape(sum);
+}
+
+/// Find the first entry not below each of keys in testee.
+template<typename Map>
+void lowerBound(Stopwatch& stopwatch, const Map& testee, const std::vector<Key>& keys)
+{
+	Value sum = 0;
+	stopwatch.start();
+	for (Key k : keys) {
+		auto found = testee.lower_bound(k);
+		if (found != testee.end()) {
+			sum += found->second;
+		}
+	}
+	stopwatch.stop();
+	Testee::escape(sum);
+}
+
+} // namespace
+
+int main(int args, char* argv[])
+{
+	std::list<BenchCase> startupCases;
+	std::list<BenchCase> lookupCases;
+	for (std::size_t count : {10000, 1000000, 4000000}) {
+		auto files = std::make_shared<ImageFiles>(count);
+		startupCases.push_back(BenchCase(
+			"startup",
+			count,
+			[files](Stopwatch& stopwatch) { load(stopwatch, *files); },
+			[files](Stopwatch& stopwatch) { open(stopwatch, *files); }));
+
+		auto heapMap = std::make_shared<HeapMap>();
+		{
+			std::ifstream stream(files->streamPath, std::ios::binary);
+			heapMap->deserialize(stream);
+		}
+		auto mappedMap = std::make_shared<MappedMap>(files->imagePath);
+		auto keys = std::make_shared<std::vector<Key>>();
+		std::mt19937_64 engine(42);
+		std::uniform_int_distribution<std::size_t> index(0, 2 * count - 1);
+		for (std::size_t i = 0; i < count; ++i) {
+			keys->push_back(key(index(engine)));
+		}
+		lookupCases.push_back(BenchCase(
+			"find",
+			count,
+			[heapMap, keys](Stopwatch& stopwatch) { find(stopwatch, *heapMap, *keys); },
+			[mappedMap, keys](Stopwatch& stopwatch) { find(stopwatch, *mappedMap, *keys); }));
+		lookupCases.push_back(BenchCase(
+			"lower_bound",
+			count,
+			[heapMap, keys](Stopwatch& stopwatch) { lowerBound(stopwatch, *heapMap, *keys); },
+			[mappedMap, keys](Stopwatch& stopwatch) { lowerBound(stopwatch, *mappedMap, *keys); }));
+	}
+	const std::string subject = "Map<std::uint64_t, std::uint64_t>";
+	bool passed = Testee::BenchSuite(subject + " file", "deserialize", "MappedMap", std::move(startupCases)).run();
+	passed = Testee::BenchSuite(subject + " lookup", "Map", "MappedMap", std::move(lookupCases)).run() && passed;
+	return passed ? 0 : 1;
+}
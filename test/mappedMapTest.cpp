@@ -0,0 +1,18 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/MappedMap.h"
+#include "Polymorphic/MappedSet.h"
+#include "Testee/MappedMapTestSuite.h"
+#include <iostream>
+
+int main(int args, char* argv[])
+{
+	bool passed = Testee::MappedMapTestSuite<Polymorphic::MappedMap, int, int>("Polymorphic::MappedMap<int, int>").run();
+	passed = Testee::MappedSetTestSuite<Polymorphic::MappedSet, int>("Polymorphic::MappedSet<int>").run() && passed;
+	return passed ? 0 : 1;
+}
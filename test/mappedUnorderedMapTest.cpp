@@ -0,0 +1,18 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/MappedUnorderedMap.h"
+#include "Testee/MappedUnorderedMapTestSuite.h"
+#include <iostream>
+
+int main(int args, char* argv[])
+{
+	bool passed = Testee::MappedUnorderedMapTestSuite<Polymorphic::MappedUnorderedMap, int, int>(
+					  "Polymorphic::MappedUnorderedMap<int, int>")
+					  .run();
+	return passed ? 0 : 1;
+}
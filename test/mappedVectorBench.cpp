@@ -0,0 +1,114 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/MappedVector.h"
+#include "Polymorphic/Serialization.h"
+#include "Polymorphic/Vector.h"
+#include "Testee/BenchSuite.h"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+using Testee::BenchCase;
+using Testee::Stopwatch;
+
+typedef std::uint64_t T;
+
+/// Serialized Vector image of count elements in the working directory, removed on destruction.
+class ImageFile
+{
+public:
+	explicit ImageFile(std::size_t count) : path("mappedVectorBench" + std::to_string(count) + ".dat")
+	{
+		Polymorphic::Vector<T> source;
+		for (std::size_t i = 0; i < count; ++i) {
+			source.push_back(Testee::BenchValue<T>::make(i));
+		}
+		std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+		source.serialize(stream);
+	}
+
+	~ImageFile()
+	{
+		std::remove(path.c_str());
+	}
+
+	/// Drop the file's pages from the page cache, so that the next access reads them from disk.
+	void evict() const
+	{
+		int descriptor = ::open(path.c_str(), O_RDONLY);
+		if (descriptor >= 0) {
+			::fdatasync(descriptor);
+			::posix_fadvise(descriptor, 0, 0, POSIX_FADV_DONTNEED);
+			::close(descriptor);
+		}
+	}
+
+	const std::string path;
+};
+
+void load(Stopwatch& stopwatch, const ImageFile& file, bool cold, bool sum)
+{
+	if (cold) {
+		file.evict();
+	}
+	stopwatch.start();
+	std::ifstream stream(file.path, std::ios::binary);
+	Polymorphic::Vector<T> testee;
+	testee.deserialize(stream);
+	T result = sum ? std::accumulate(testee.begin(), testee.end(), T(0)) : testee.size();
+	stopwatch.stop();
+	Testee::escape(result);
+}
+
+void open(Stopwatch& stopwatch, const ImageFile& file, bool cold, bool sum)
+{
+	if (cold) {
+		file.evict();
+	}
+	stopwatch.start();
+	Polymorphic::MappedVector<T> testee(file.path);
+	if (sum) {
+		testee.advise(Polymorphic::MappedVector<T>::Advice::sequential);
+	}
+	T result = sum ? std::accumulate(testee.begin(), testee.end(), T(0)) : testee.size();
+	stopwatch.stop();
+	Testee::escape(result);
+}
+
+} // namespace
+
+int main(int args, char* argv[])
+{
+	// Cold cases drop the image from the page cache before each run, warm cases find it cached by the previous one.
+	std::list<BenchCase> benchCases;
+	for (std::size_t count : {1000, 1000000, 16000000}) {
+		auto file = std::make_shared<ImageFile>(count);
+		for (bool cold : {false, true}) {
+			for (bool sum : {false, true}) {
+				std::string name = std::string(cold ? "cold " : "warm ") + (sum ? "open and sum" : "open");
+				benchCases.push_back(BenchCase(
+					name,
+					count,
+					[file, cold, sum](Stopwatch& stopwatch) { load(stopwatch, *file, cold, sum); },
+					[file, cold, sum](Stopwatch& stopwatch) { open(stopwatch, *file, cold, sum); }));
+			}
+		}
+	}
+	bool passed =
+		Testee::BenchSuite("Vector<std::uint64_t> image file", "deserialize", "MappedVector", std::move(benchCases)).run();
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,15 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/MappedVector.h"
+#include "Testee/MappedVectorTestSuite.h"
+#include <iostream>
+
+int main(int args, char* argv[])
+{
+	return Testee::MappedVectorTestSuite<Polymorphic::MappedVector, int>("Polymorphic::MappedVector<int>").run() ? 0 : 1;
+}
@@ -0,0 +1,144 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Deque.h"
+#include "Polymorphic/Execution.h"
+#include "Polymorphic/Vector.h"
+#include "Testee/BenchSuite.h"
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Testee::BenchCase;
+using Testee::Stopwatch;
+
+/// Bulk operations of Sequence, sequential by the std delegate and per policy.
+template<typename Sequence>
+struct Operations
+{
+	typedef typename Sequence::value_type T;
+	typedef Polymorphic::execution::parallel_policy Policy;
+
+	static std::vector<T> values(std::size_t count)
+	{
+		std::vector<T> result;
+		for (std::size_t i = 0; i < count; ++i) {
+			result.push_back(Testee::BenchValue<T>::make(i));
+		}
+		return result;
+	}
+
+	static void assign(const Policy* policy, Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Sequence testee;
+		stopwatch.start();
+		if (policy != nullptr) {
+			testee.assign(*policy, source.begin(), source.end());
+		} else {
+			testee.assign(source.begin(), source.end());
+		}
+		stopwatch.stop();
+		Testee::escape(testee);
+	}
+
+	/// Insert in the middle of as many elements.
+	static void insert(const Policy* policy, Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Sequence testee(source.begin(), source.end());
+		stopwatch.start();
+		if (policy != nullptr) {
+			testee.insert(*policy, testee.begin() + count / 2, source.begin(), source.end());
+		} else {
+			testee.insert(testee.begin() + count / 2, source.begin(), source.end());
+		}
+		stopwatch.stop();
+		Testee::escape(testee);
+	}
+
+	static void resize(const Policy* policy, Stopwatch& stopwatch, std::size_t count)
+	{
+		T value = Testee::BenchValue<T>::make(count);
+		Sequence testee;
+		stopwatch.start();
+		if (policy != nullptr) {
+			testee.resize(*policy, count, value);
+		} else {
+			testee.resize(count, value);
+		}
+		stopwatch.stop();
+		Testee::escape(testee);
+	}
+
+	static void copy(const Policy* policy, Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		const Sequence original(source.begin(), source.end());
+		stopwatch.start();
+		Sequence testee = policy != nullptr ? Sequence(*policy, original) : Sequence(original);
+		stopwatch.stop();
+		Testee::escape(testee);
+	}
+
+	/// Erase about every second element, selected by hash.
+	static void eraseIf(const Policy* policy, Stopwatch& stopwatch, std::size_t count)
+	{
+		std::vector<T> source = values(count);
+		Sequence testee(source.begin(), source.end());
+		auto predicate = [](const T& value) { return std::hash<T>()(value) % 2 != 0; };
+		stopwatch.start();
+		if (policy != nullptr) {
+			testee.erase_if(*policy, predicate);
+		} else {
+			testee.erase(std::remove_if(testee.begin(), testee.end(), predicate), testee.end());
+		}
+		stopwatch.stop();
+		Testee::escape(testee);
+	}
+};
+
+template<typename Sequence>
+bool bench(const std::string& subject, const std::vector<std::size_t>& counts)
+{
+	typedef Operations<Sequence> Ops;
+	typedef void (*Operation)(const typename Ops::Policy*, Stopwatch&, std::size_t);
+	static const Polymorphic::execution::parallel_policy policy = Polymorphic::execution::par;
+	std::list<BenchCase> benchCases;
+	auto add = [&benchCases](const std::string& name, std::size_t count, Operation operation) {
+		benchCases.push_back(BenchCase(
+			name,
+			count,
+			[operation, count](Stopwatch& stopwatch) { operation(nullptr, stopwatch, count); },
+			[operation, count](Stopwatch& stopwatch) { operation(&policy, stopwatch, count); }));
+	};
+	for (std::size_t count : counts) {
+		add("assign", count, &Ops::assign);
+		add("insert", count, &Ops::insert);
+		add("resize", count, &Ops::resize);
+		add("copy", count, &Ops::copy);
+		add("erase_if", count, &Ops::eraseIf);
+	}
+	return Testee::BenchSuite(subject, "sequential", "par", std::move(benchCases)).run();
+}
+
+} // namespace
+
+int main(int args, char* argv[])
+{
+	using Polymorphic::Deque;
+	using Polymorphic::Vector;
+	std::vector<std::size_t> counts{1000, 100000, 10000000};
+	bool passed = bench<Vector<int>>("Vector<int>", counts);
+	passed = bench<Vector<std::string>>("Vector<std::string>", {1000, 100000, 1000000}) && passed;
+	passed = bench<Deque<int>>("Deque<int>", counts) && passed;
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,37 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/PriorityQueue.h"
+#include "Testee/PriorityQueueBenchSuite.h"
+#include <functional>
+#include <queue>
+#include <string>
+#include <vector>
+
+template<typename T, std::size_t Arity>
+using PriorityQueue = Polymorphic::PriorityQueue<T, Polymorphic::Vector<T>, std::less<T>, Arity>;
+
+int main(int args, char* argv[])
+{
+	std::vector<std::size_t> counts{1000, 1000000};
+	bool passed = Testee::PriorityQueueBenchSuite<std::priority_queue<int>, PriorityQueue<int, 2>>(
+					  "PriorityQueue<int>", "std::priority_queue", "arity 2", counts)
+					  .run();
+	passed = Testee::PriorityQueueBenchSuite<PriorityQueue<int, 2>, PriorityQueue<int, 4>>(
+				 "PriorityQueue<int>", "arity 2", "arity 4", counts)
+				 .run() &&
+		passed;
+	passed = Testee::PriorityQueueBenchSuite<PriorityQueue<int, 2>, PriorityQueue<int, 8>>(
+				 "PriorityQueue<int>", "arity 2", "arity 8", counts)
+				 .run() &&
+		passed;
+	passed = Testee::PriorityQueueBenchSuite<PriorityQueue<std::string, 2>, PriorityQueue<std::string, 4>>(
+				 "PriorityQueue<std::string>", "arity 2", "arity 4", counts)
+				 .run() &&
+		passed;
+	return passed ? 0 : 1;
+}
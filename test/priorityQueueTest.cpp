@@ -0,0 +1,31 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/PriorityQueue.h"
+#include "Testee/PriorityQueueTestSuite.h"
+#include <deque>
+#include <iostream>
+#include <queue>
+
+typedef Polymorphic::PriorityQueue<int, Polymorphic::Vector<int>, std::less<int>, 4> QuaternaryQueue;
+typedef Polymorphic::PriorityQueue<int, Polymorphic::Vector<int>, std::greater<int>, 8> OctonaryMinQueue;
+typedef Polymorphic::PriorityQueue<int, std::deque<int>, std::less<int>, 3> TernaryDequeQueue;
+
+int main(int args, char* argv[])
+{
+	using Polymorphic::IndexedPriorityQueue;
+	bool passed = Testee::PriorityQueueTestSuite<std::priority_queue<int>>("std::priority_queue<int>").run();
+	passed = Testee::PriorityQueueTestSuite<Polymorphic::PriorityQueue<int>>("Polymorphic::PriorityQueue<int>").run() && passed;
+	passed = Testee::PriorityQueueTestSuite<QuaternaryQueue>("Polymorphic::PriorityQueue<int, 4>").run() && passed;
+	passed = Testee::PriorityQueueTestSuite<OctonaryMinQueue>("Polymorphic::PriorityQueue<int, greater, 8>").run() && passed;
+	passed = Testee::PriorityQueueTestSuite<TernaryDequeQueue>("Polymorphic::PriorityQueue<int, deque, 3>").run() && passed;
+	passed =
+		Testee::IndexedPriorityQueueTestSuite<IndexedPriorityQueue, 2>("Polymorphic::IndexedPriorityQueue<int>").run() && passed;
+	passed =
+		Testee::IndexedPriorityQueueTestSuite<IndexedPriorityQueue, 4>("Polymorphic::IndexedPriorityQueue<int, 4>").run() && passed;
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,27 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/List.h"
+#include "Polymorphic/Queue.h"
+#include "Polymorphic/RingBuffer.h"
+#include "Testee/QueueTestSuite.h"
+#include <iostream>
+#include <queue>
+
+typedef Polymorphic::Queue<int, Polymorphic::List<int>> ListQueue;
+typedef Polymorphic::Queue<int, Polymorphic::RingBuffer<int>> RingBufferQueue;
+
+int main(int args, char* argv[])
+{
+	bool passed = Testee::QueueTestSuite<std::queue<int>>("std::queue<int>").run();
+	passed = Testee::QueueTestSuite<Polymorphic::Queue<int>>("Polymorphic::Queue<int>").run() && passed;
+	passed = Testee::QueueTestSuite<ListQueue>("Polymorphic::Queue<int, List>").run() && passed;
+	passed = Testee::QueueTestSuite<RingBufferQueue>("Polymorphic::Queue<int, RingBuffer>").run() && passed;
+	passed = Testee::QueueExtensionsTestSuite<Polymorphic::Queue<int>>("Polymorphic::Queue<int>").run() && passed;
+	passed = Testee::QueueExtensionsTestSuite<RingBufferQueue>("Polymorphic::Queue<int, RingBuffer>").run() && passed;
+	return passed ? 0 : 1;
+}
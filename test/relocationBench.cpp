@@ -0,0 +1,86 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Vector.h"
+#include "Testee/BenchSuite.h"
+#include <list>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Testee::BenchCase;
+using Testee::Stopwatch;
+
+/// Vector of size inner vectors of 4 ints. std::vector<int> elements are moved one by one on insert and erase, while
+/// Polymorphic::Vector<int> elements are trivially relocatable and moved by a single memmove.
+template<typename Inner>
+Polymorphic::Vector<Inner> make(std::size_t size)
+{
+	Polymorphic::Vector<Inner> testee;
+	testee.reserve(size + 1);
+	for (std::size_t i = 0; i < size; ++i) {
+		testee.push_back(Inner(4, static_cast<int>(i)));
+	}
+	return testee;
+}
+
+/// Insert an inner vector at the front of a vector of size ones and erase it again, count times.
+template<typename Inner>
+void insertErase(Stopwatch& stopwatch, std::size_t count, std::size_t size)
+{
+	Polymorphic::Vector<Inner> testee = make<Inner>(size);
+	Inner value(4, 1);
+	stopwatch.start();
+	for (std::size_t i = 0; i < count; ++i) {
+		testee.insert(testee.begin(), value);
+		testee.erase(testee.begin());
+	}
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+/// Erase the front inner vector of a vector of count ones until it is empty.
+template<typename Inner>
+void eraseFront(Stopwatch& stopwatch, std::size_t count, std::size_t)
+{
+	Polymorphic::Vector<Inner> testee = make<Inner>(count);
+	stopwatch.start();
+	while (!testee.empty()) {
+		testee.erase(testee.begin());
+	}
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+} // namespace
+
+int main(int args, char* argv[])
+{
+	// Times are per inserted and erased, or erased element.
+	typedef std::vector<int> Plain;
+	typedef Polymorphic::Vector<int> Relocated;
+	std::list<BenchCase> benchCases;
+	for (std::size_t size : {100, 10000}) {
+		std::size_t count = 1000000 / size;
+		benchCases.push_back(BenchCase(
+			"insert erase front of " + std::to_string(size),
+			count,
+			[count, size](Stopwatch& stopwatch) { insertErase<Plain>(stopwatch, count, size); },
+			[count, size](Stopwatch& stopwatch) { insertErase<Relocated>(stopwatch, count, size); }));
+	}
+	for (std::size_t count : {100, 10000}) {
+		benchCases.push_back(BenchCase(
+			"erase front of " + std::to_string(count),
+			count,
+			[count](Stopwatch& stopwatch) { eraseFront<Plain>(stopwatch, count, 0); },
+			[count](Stopwatch& stopwatch) { eraseFront<Relocated>(stopwatch, count, 0); }));
+	}
+	bool passed = Testee::BenchSuite(
+		"Vector of 4 int vectors", "Vector<std::vector<int>>", "Vector<Vector<int>>", std::move(benchCases)).run();
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,26 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Deque.h"
+#include "Polymorphic/RingBuffer.h"
+#include "Testee/DequeBenchSuite.h"
+#include <string>
+#include <vector>
+
+int main(int args, char* argv[])
+{
+	using Polymorphic::Deque;
+	using Polymorphic::RingBuffer;
+	std::vector<std::size_t> counts{10000, 1000000};
+	bool passed = Testee::DequeBenchSuite<Deque<int>, RingBuffer<int>>("RingBuffer<int>", "Deque<int>", "RingBuffer<int>", counts)
+					  .run();
+	passed = Testee::DequeBenchSuite<Deque<std::string>, RingBuffer<std::string>>(
+				 "RingBuffer<std::string>", "Deque<std::string>", "RingBuffer<std::string>", counts)
+				 .run() &&
+		passed;
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,18 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/RingBuffer.h"
+#include "Testee/DequeTestSuite.h"
+#include "Testee/RingBufferTestSuite.h"
+#include <iostream>
+
+int main(int args, char* argv[])
+{
+	bool passed = Testee::DequeTestSuite<Polymorphic::RingBuffer, int>("Polymorphic::RingBuffer<int>").run();
+	passed = Testee::RingBufferTestSuite<Polymorphic::RingBuffer, int>("Polymorphic::RingBuffer<int>").run() && passed;
+	return passed ? 0 : 1;
+}
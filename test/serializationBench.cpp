@@ -0,0 +1,162 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Deque.h"
+#include "Polymorphic/Serialization.h"
+#include "Polymorphic/Vector.h"
+#include "Testee/BenchSuite.h"
+#include <cstdint>
+#include <list>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Testee::BenchCase;
+using Testee::Stopwatch;
+
+typedef std::uint64_t T;
+
+template<typename Sequence>
+Sequence sequence(std::size_t count)
+{
+	Sequence result;
+	for (std::size_t i = 0; i < count; ++i) {
+		result.push_back(Testee::BenchValue<T>::make(i));
+	}
+	return result;
+}
+
+/// Write elements one by one, as done before serialize().
+template<typename Sequence>
+void writeElements(Stopwatch& stopwatch, std::size_t count)
+{
+	const Sequence testee = sequence<Sequence>(count);
+	std::ostringstream sink;
+	stopwatch.start();
+	std::uint64_t size = testee.size();
+	sink.write(reinterpret_cast<const char*>(&size), sizeof(size));
+	for (const auto& element : testee) {
+		sink.write(reinterpret_cast<const char*>(&element), sizeof(element));
+	}
+	stopwatch.stop();
+	Testee::escape(sink);
+}
+
+template<typename Sequence>
+void serialize(Stopwatch& stopwatch, std::size_t count)
+{
+	const Sequence testee = sequence<Sequence>(count);
+	std::ostringstream sink;
+	stopwatch.start();
+	testee.serialize(sink);
+	stopwatch.stop();
+	Testee::escape(sink);
+}
+
+/// Read elements one by one, as done before deserialize().
+template<typename Sequence>
+void readElements(Stopwatch& stopwatch, std::size_t count)
+{
+	std::ostringstream sink;
+	std::uint64_t size = count;
+	sink.write(reinterpret_cast<const char*>(&size), sizeof(size));
+	for (const auto& element : sequence<Sequence>(count)) {
+		sink.write(reinterpret_cast<const char*>(&element), sizeof(element));
+	}
+	std::istringstream source(sink.str());
+	Sequence testee;
+	stopwatch.start();
+	source.read(reinterpret_cast<char*>(&size), sizeof(size));
+	for (std::uint64_t i = 0; i < size; ++i) {
+		T element;
+		source.read(reinterpret_cast<char*>(&element), sizeof(element));
+		testee.push_back(element);
+	}
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+template<typename Sequence>
+void deserialize(Stopwatch& stopwatch, std::size_t count)
+{
+	std::ostringstream sink;
+	sequence<Sequence>(count).serialize(sink);
+	std::istringstream source(sink.str());
+	Sequence testee;
+	stopwatch.start();
+	testee.deserialize(source);
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+/// Deserialize an image held in memory and sum its elements.
+void loadSum(Stopwatch& stopwatch, std::size_t count)
+{
+	std::ostringstream sink;
+	sequence<Polymorphic::Vector<T>>(count).serialize(sink);
+	std::istringstream source(sink.str());
+	Polymorphic::Vector<T> testee;
+	stopwatch.start();
+	testee.deserialize(source);
+	T sum = std::accumulate(testee.begin(), testee.end(), T(0));
+	stopwatch.stop();
+	Testee::escape(sum);
+}
+
+/// View an image held in memory in place and sum its elements.
+void viewSum(Stopwatch& stopwatch, std::size_t count)
+{
+	std::ostringstream sink;
+	sequence<Polymorphic::Vector<T>>(count).serialize(sink);
+	std::string image = sink.str();
+	stopwatch.start();
+	Polymorphic::SerializedView<T> testee(image.data(), image.size());
+	T sum = std::accumulate(testee.begin(), testee.end(), T(0));
+	stopwatch.stop();
+	Testee::escape(sum);
+}
+
+typedef void (*Operation)(Stopwatch&, std::size_t);
+
+BenchCase benchCase(const std::string& name, std::size_t count, Operation reference, Operation candidate)
+{
+	return BenchCase(
+		name,
+		count,
+		[reference, count](Stopwatch& stopwatch) { reference(stopwatch, count); },
+		[candidate, count](Stopwatch& stopwatch) { candidate(stopwatch, count); });
+}
+
+template<typename Sequence>
+bool bench(const std::string& subject, const std::vector<std::size_t>& counts)
+{
+	std::list<BenchCase> benchCases;
+	for (std::size_t count : counts) {
+		benchCases.push_back(benchCase("serialize", count, &writeElements<Sequence>, &serialize<Sequence>));
+		benchCases.push_back(benchCase("deserialize", count, &readElements<Sequence>, &deserialize<Sequence>));
+	}
+	return Testee::BenchSuite(subject, "element loop", "bulk", std::move(benchCases)).run();
+}
+
+} // namespace
+
+int main(int args, char* argv[])
+{
+	std::vector<std::size_t> counts{1000, 1000000, 16000000};
+	bool passed = bench<Polymorphic::Vector<T>>("Vector<std::uint64_t> serialization", counts);
+	passed = bench<Polymorphic::Deque<T>>("Deque<std::uint64_t> serialization", counts) && passed;
+	std::list<BenchCase> benchCases;
+	for (std::size_t count : counts) {
+		benchCases.push_back(benchCase("load and sum", count, &loadSum, &viewSum));
+	}
+	passed = Testee::BenchSuite("Vector<std::uint64_t> image", "deserialize", "SerializedView", std::move(benchCases)).run() &&
+		passed;
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,26 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/SlabList.h"
+#include "Testee/ListBenchSuite.h"
+#include <list>
+#include <string>
+#include <vector>
+
+int main(int args, char* argv[])
+{
+	// Millions of elements span thousands of chunks, exposing the cost of growing the chunk table.
+	std::vector<std::size_t> counts{1000, 100000, 4000000};
+	bool passed =
+		Testee::ListBenchSuite<std::list, Polymorphic::SlabList, int>("SlabList<int>", "std::list", "Polymorphic::SlabList", counts)
+			.run();
+	passed = Testee::ListBenchSuite<std::list, Polymorphic::SlabList, std::string>(
+				 "SlabList<std::string>", "std::list", "Polymorphic::SlabList", {1000, 100000})
+				 .run() &&
+		passed;
+	return passed ? 0 : 1;
+}
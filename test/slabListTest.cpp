@@ -0,0 +1,20 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/SlabList.h"
+#include "Testee/ListTestSuite.h"
+#include "Testee/SlabListTestSuite.h"
+#include "Testee/SortTestSuite.h"
+#include <iostream>
+
+int main(int args, char* argv[])
+{
+	bool passed = Testee::ListTestSuite<Polymorphic::SlabList, int>("Polymorphic::SlabList<int>").run();
+	passed = Testee::SlabListTestSuite<Polymorphic::SlabList, int>("Polymorphic::SlabList<int>").run() && passed;
+	passed = Testee::SortTestSuite<Polymorphic::SlabList>("Polymorphic::SlabList<std::pair<int, int>>").run() && passed;
+	return passed ? 0 : 1;
+}
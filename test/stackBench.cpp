@@ -0,0 +1,27 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/Deque.h"
+#include "Polymorphic/Stack.h"
+#include "Polymorphic/Vector.h"
+#include "Testee/StackBenchSuite.h"
+#include <string>
+#include <vector>
+
+int main(int args, char* argv[])
+{
+	using Polymorphic::Stack;
+	std::vector<std::size_t> counts{1000, 100000};
+	bool passed = Testee::StackBenchSuite<Stack<int>, Stack<int, Polymorphic::Vector<int>>>(
+					  "Stack<int>", "Stack<int, Deque<int>>", "Stack<int, Vector<int>>", counts)
+					  .run();
+	passed = Testee::StackBenchSuite<Stack<std::string>, Stack<std::string, Polymorphic::Vector<std::string>>>(
+				 "Stack<std::string>", "Stack<std::string, Deque<std::string>>", "Stack<std::string, Vector<std::string>>", counts)
+				 .run() &&
+		passed;
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,27 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/List.h"
+#include "Polymorphic/Stack.h"
+#include "Polymorphic/Vector.h"
+#include "Testee/StackTestSuite.h"
+#include <iostream>
+#include <stack>
+
+typedef Polymorphic::Stack<int, Polymorphic::Vector<int>> VectorStack;
+typedef Polymorphic::Stack<int, Polymorphic::List<int>> ListStack;
+
+int main(int args, char* argv[])
+{
+	bool passed = Testee::StackTestSuite<std::stack<int>>("std::stack<int>").run();
+	passed = Testee::StackTestSuite<Polymorphic::Stack<int>>("Polymorphic::Stack<int>").run() && passed;
+	passed = Testee::StackTestSuite<VectorStack>("Polymorphic::Stack<int, Vector>").run() && passed;
+	passed = Testee::StackTestSuite<ListStack>("Polymorphic::Stack<int, List>").run() && passed;
+	passed = Testee::StackExtensionsTestSuite<Polymorphic::Stack<int>>("Polymorphic::Stack<int>").run() && passed;
+	passed = Testee::StackExtensionsTestSuite<VectorStack>("Polymorphic::Stack<int, Vector>").run() && passed;
+	return passed ? 0 : 1;
+}
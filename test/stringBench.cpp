@@ -0,0 +1,85 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/String.h"
+#include "Testee/BenchSuite.h"
+#include <list>
+#include <string>
+
+namespace {
+
+using Testee::BenchCase;
+using Testee::Stopwatch;
+
+/// Construct count strings of the first n characters of a 64 character text. Up to 15 characters fit the small string
+/// buffer of libstdc++ and libc++, so only longer strings allocate.
+template<typename String, std::size_t n>
+void construct(Stopwatch& stopwatch, std::size_t count)
+{
+	static const char text[] = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ.,";
+	std::size_t sum = 0;
+	stopwatch.start();
+	for (std::size_t i = 0; i < count; ++i) {
+		String testee(text, n);
+		Testee::escape(testee);
+		sum += testee.size();
+	}
+	stopwatch.stop();
+	Testee::escape(sum);
+}
+
+/// Append count characters one by one.
+template<typename String>
+void pushBack(Stopwatch& stopwatch, std::size_t count)
+{
+	String testee;
+	stopwatch.start();
+	for (std::size_t i = 0; i < count; ++i) {
+		testee.push_back(static_cast<char>('a' + i % 26));
+	}
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+/// Append count characters in pieces of 8.
+template<typename String>
+void append(Stopwatch& stopwatch, std::size_t count)
+{
+	String testee;
+	stopwatch.start();
+	for (std::size_t i = 0; i < count; i += 8) {
+		testee.append("abcdefgh", 8);
+	}
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+template<void (*reference)(Stopwatch&, std::size_t), void (*candidate)(Stopwatch&, std::size_t)>
+BenchCase benchCase(const std::string& name, std::size_t count)
+{
+	return BenchCase(
+		name,
+		count,
+		[count](Stopwatch& stopwatch) { reference(stopwatch, count); },
+		[count](Stopwatch& stopwatch) { candidate(stopwatch, count); });
+}
+
+} // namespace
+
+int main(int args, char* argv[])
+{
+	using Polymorphic::String;
+	std::list<BenchCase> benchCases;
+	for (std::size_t count : {1000, 1000000}) {
+		benchCases.push_back(benchCase<&construct<std::string, 15>, &construct<String, 15>>("construct 15 chars", count));
+		benchCases.push_back(benchCase<&construct<std::string, 64>, &construct<String, 64>>("construct 64 chars", count));
+		benchCases.push_back(benchCase<&pushBack<std::string>, &pushBack<String>>("push_back", count));
+		benchCases.push_back(benchCase<&append<std::string>, &append<String>>("append", count));
+	}
+	bool passed = Testee::BenchSuite("String", "std::string", "Polymorphic::String", std::move(benchCases)).run();
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,18 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/String.h"
+#include "Testee/StringTestSuite.h"
+#include <iostream>
+
+int main(int args, char* argv[])
+{
+	bool passed = Testee::StringTestSuite<std::basic_string>("std::string").run();
+	passed = Testee::StringTestSuite<Polymorphic::BasicString>("Polymorphic::String").run() && passed;
+	passed = Testee::StringInteropTestSuite<Polymorphic::BasicString>("Polymorphic::String").run() && passed;
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,131 @@
+//
+// Copyright (C) 2018 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Polymorphic/UnorderedMap.h"
+#include "Polymorphic/UnorderedSet.h"
+#include "Testee/BenchSuite.h"
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Testee::BenchCase;
+using Testee::Stopwatch;
+
+/// Elements of count distinct keys.
+template<typename Value>
+struct Elements;
+
+template<>
+struct Elements<std::size_t>
+{
+	static std::vector<std::size_t> make(std::size_t count)
+	{
+		std::vector<std::size_t> elements;
+		elements.reserve(count);
+		for (std::size_t i = 0; i < count; ++i) {
+			elements.push_back(i * 7919);
+		}
+		return elements;
+	}
+};
+
+template<>
+struct Elements<std::pair<const std::size_t, std::size_t>>
+{
+	static std::vector<std::pair<const std::size_t, std::size_t>> make(std::size_t count)
+	{
+		std::vector<std::pair<const std::size_t, std::size_t>> elements;
+		elements.reserve(count);
+		for (std::size_t i = 0; i < count; ++i) {
+			elements.push_back(std::make_pair(i * 7919, i));
+		}
+		return elements;
+	}
+};
+
+/// Insert elements one by one, growing the bucket array as needed.
+template<typename Container>
+void insertEach(Stopwatch& stopwatch, const std::vector<typename Container::value_type>& elements)
+{
+	stopwatch.start();
+	Container testee;
+	for (const typename Container::value_type& element : elements) {
+		testee.insert(element);
+	}
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+/// Insert elements by insert(first, last).
+template<typename Container>
+void insertRange(Stopwatch& stopwatch, const std::vector<typename Container::value_type>& elements)
+{
+	stopwatch.start();
+	Container testee;
+	testee.insert(elements.begin(), elements.end());
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+/// Construct from elements by the range constructor.
+template<typename Container>
+void construct(Stopwatch& stopwatch, const std::vector<typename Container::value_type>& elements)
+{
+	stopwatch.start();
+	Container testee(elements.begin(), elements.end());
+	stopwatch.stop();
+	Testee::escape(testee);
+}
+
+template<typename Value>
+BenchCase benchCase(
+	const std::string& name,
+	std::size_t count,
+	void (*reference)(Stopwatch&, const std::vector<Value>&),
+	void (*candidate)(Stopwatch&, const std::vector<Value>&))
+{
+	std::vector<Value> elements = Elements<Value>::make(count);
+	return BenchCase(
+		name,
+		count,
+		[elements, reference](Stopwatch& stopwatch) { reference(stopwatch, elements); },
+		[elements, candidate](Stopwatch& stopwatch) { candidate(stopwatch, elements); });
+}
+
+/// Compare inserting one by one into Decorator with loading it from a range, and loading std::unordered_* Standard
+/// from a range with loading Decorator, which reserves buckets for the range first.
+template<typename Standard, typename Decorator>
+bool bench(const std::string& subject)
+{
+	typedef typename Decorator::value_type Value;
+	std::list<BenchCase> growing;
+	std::list<BenchCase> delegated;
+	for (std::size_t count : {1000, 1000000}) {
+		growing.push_back(benchCase<Value>("insert(first, last)", count, &insertEach<Decorator>, &insertRange<Decorator>));
+		growing.push_back(benchCase<Value>("range constructor", count, &insertEach<Decorator>, &construct<Decorator>));
+		delegated.push_back(benchCase<Value>("insert(first, last)", count, &insertRange<Standard>, &insertRange<Decorator>));
+		delegated.push_back(benchCase<Value>("range constructor", count, &construct<Standard>, &construct<Decorator>));
+	}
+	bool passed = Testee::BenchSuite(subject, "insert one by one", "load range", std::move(growing)).run();
+	return Testee::BenchSuite(subject, "std::unordered_*", "decorator", std::move(delegated)).run() && passed;
+}
+
+} // namespace
+
+int main(int args, char* argv[])
+{
+	typedef std::size_t Key;
+	bool passed = bench<std::unordered_set<Key>, Polymorphic::UnorderedSet<Key>>("UnorderedSet<std::size_t>");
+	passed = bench<std::unordered_map<Key, Key>, Polymorphic::UnorderedMap<Key, Key>>("UnorderedMap<std::size_t, std::size_t>") &&
+		passed;
+	return passed ? 0 : 1;
+}
@@ -6,10 +6,27 @@
 
 
 #include "Polymorphic/UnorderedMap.h"
+#include "Testee/CachedHashTestSuite.h"
+#include "Testee/ChunkedSerializationTestSuite.h"
 #include "Testee/UnorderedMapTestSuite.h"
 #include <iostream>
+#include <string>
+#include <vector>
 
 int main(int args, char* argv[])
 {
-	return Testee::UnorderedMapTestSuite<Polymorphic::UnorderedMap, int, int>("Polymorphic::UnorderedMap<int, int>").run() ? 0 : 1;
+	bool passed = Testee::UnorderedMapTestSuite<Polymorphic::UnorderedMap, int, int>("Polymorphic::UnorderedMap<int, int>").run();
+	std::vector<std::pair<const int, std::string>> values;
+	for (int i = 0; i < 1000; ++i) {
+		values.emplace_back(i, std::to_string(i));
+	}
+	passed = Testee::ChunkedSerializationTestSuite<Polymorphic::UnorderedMap<int, std::string>>(
+				 "Polymorphic::UnorderedMap<int, std::string>", values)
+				 .run() &&
+		passed;
+	typedef Polymorphic::UnorderedMap<std::string, int> UnorderedType;
+	typedef Polymorphic::CachedHashUnorderedMap<std::string, int, Testee::CountingHash> CachedHashType;
+	passed = Testee::CachedHashTestSuite<UnorderedType, CachedHashType>("Polymorphic::UnorderedMap<std::string, int>").run() &&
+		passed;
+	return passed ? 0 : 1;
 }
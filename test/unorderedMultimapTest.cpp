@@ -6,13 +6,21 @@
 
 
 #include "Polymorphic/UnorderedMultimap.h"
+#include "Testee/CachedHashTestSuite.h"
 #include "Testee/UnorderedMapTestSuite.h"
 #include <iostream>
+#include <string>
 
 int main(int args, char* argv[])
 {
-	return Testee::UnorderedMapTestSuite<Polymorphic::UnorderedMultimap, int, int, true>("Polymorphic::UnorderedMultimap<int, int>")
-				   .run() ?
-			   0 :
-			   1;
+	bool passed = Testee::UnorderedMapTestSuite<Polymorphic::UnorderedMultimap, int, int, true>(
+		"Polymorphic::UnorderedMultimap<int, int>")
+					  .run();
+	typedef Polymorphic::UnorderedMultimap<std::string, int> UnorderedType;
+	typedef Polymorphic::CachedHashUnorderedMultimap<std::string, int, Testee::CountingHash> CachedHashType;
+	passed = Testee::CachedHashTestSuite<UnorderedType, CachedHashType, true>(
+				 "Polymorphic::UnorderedMultimap<std::string, int>")
+				 .run() &&
+		passed;
+	return passed ? 0 : 1;
 }
@@ -6,12 +6,20 @@
 
 
 #include "Polymorphic/UnorderedMultiset.h"
+#include "Testee/CachedHashTestSuite.h"
 #include "Testee/UnorderedSetTestSuite.h"
 #include <iostream>
+#include <string>
 
 int main(int args, char* argv[])
 {
-	return Testee::UnorderedSetTestSuite<Polymorphic::UnorderedMultiset, int, true>("Polymorphic::UnorderedMultiset<int>").run() ?
-			   0 :
-			   1;
+	bool passed =
+		Testee::UnorderedSetTestSuite<Polymorphic::UnorderedMultiset, int, true>("Polymorphic::UnorderedMultiset<int>").run();
+	typedef Polymorphic::UnorderedMultiset<std::string> UnorderedType;
+	typedef Polymorphic::CachedHashUnorderedMultiset<std::string, Testee::CountingHash> CachedHashType;
+	passed = Testee::CachedHashTestSuite<UnorderedType, CachedHashType, true>(
+				 "Polymorphic::UnorderedMultiset<std::string>")
+				 .run() &&
+		passed;
+	return passed ? 0 : 1;
 }
@@ -6,10 +6,16 @@
 
 
 #include "Polymorphic/UnorderedSet.h"
+#include "Testee/CachedHashTestSuite.h"
 #include "Testee/UnorderedSetTestSuite.h"
 #include <iostream>
+#include <string>
 
 int main(int args, char* argv[])
 {
-	return Testee::UnorderedSetTestSuite<Polymorphic::UnorderedSet, int>("Polymorphic::UnorderedSet<int>").run() ? 0 : 1;
+	bool passed = Testee::UnorderedSetTestSuite<Polymorphic::UnorderedSet, int>("Polymorphic::UnorderedSet<int>").run();
+	typedef Polymorphic::UnorderedSet<std::string> UnorderedType;
+	typedef Polymorphic::CachedHashUnorderedSet<std::string, Testee::CountingHash> CachedHashType;
+	passed = Testee::CachedHashTestSuite<UnorderedType, CachedHashType>("Polymorphic::UnorderedSet<std::string>").run() && passed;
+	return passed ? 0 : 1;
 }
@@ -6,6 +6,10 @@
 
 
 #include "Polymorphic/Vector.h"
+#include "Testee/DefaultInitTestSuite.h"
+#include "Testee/ParallelSequenceTestSuite.h"
+#include "Testee/RelocationTestSuite.h"
+#include "Testee/SerializationTestSuite.h"
 #include "Testee/VectorTestSuite.h"
 #include <iostream>
 
@@ -14,5 +18,9 @@ int main(int args, char* argv[])
 	bool failed = false;
 	failed = !Testee::VectorTestSuite<Polymorphic::Vector, int>("Polymorphic::Vector<int>").run() || failed;
 	failed = !Testee::VectorTestSuite<Polymorphic::Vector, bool>("Polymorphic::Vector<bool>").run() || failed;
+	failed = !Testee::ParallelSequenceTestSuite<Polymorphic::Vector>("Polymorphic::Vector<int>").run() || failed;
+	failed = !Testee::SerializationTestSuite<Polymorphic::Vector>("Polymorphic::Vector<Point>").run() || failed;
+	failed = !Testee::DefaultInitTestSuite<Polymorphic::Vector>("Polymorphic::Vector<int>").run() || failed;
+	failed = !Testee::RelocationTestSuite<Polymorphic::Vector>("Polymorphic::Vector").run() || failed;
 	return failed ? 1 : 0;
 }